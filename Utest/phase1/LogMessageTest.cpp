@@ -84,3 +84,13 @@ TEST_F(LogMessageTest, StreamOperatorWorks)
     EXPECT_NE(output.find("TestApp"), std::string::npos);
 }
 
+// Test: Value constructor keeps the unit and the given severity
+TEST_F(LogMessageTest, ValueConstructorFormatsValueAndUnit)
+{
+    logging::LogMessage msg("sda", logging::Context::DISK, logging::Severity::INFO, 1520.54, "kB/s");
+
+    EXPECT_EQ(msg.getContext(), logging::Context::DISK);
+    EXPECT_EQ(msg.getSeverity(), logging::Severity::INFO);
+    EXPECT_NE(msg.getText().find("[DISK]"), std::string::npos);
+    EXPECT_NE(msg.getText().find("Value is: 1520.5 kB/s"), std::string::npos);
+}
@@ -0,0 +1,212 @@
+// Utest/phase2/BatchReaderTest.cc
+
+#include <gtest/gtest.h>
+#include "SmartDataHub/BatchReader.hpp"
+#include "SmartDataHub/FileTelemetrySourceImpl.hpp"
+#include "SmartDataHub/SocketTelemetrySourceImpl.hpp"
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <vector>
+
+using namespace SmartDataHub;
+
+class BatchReaderTest : public ::testing::Test
+{
+protected:
+    std::map<std::size_t, std::string> samples;
+
+    BatchReader::SampleHandler recorder()
+    {
+        return [this](std::size_t index, const std::string &data) { samples[index] = data; };
+    }
+
+    static std::vector<std::unique_ptr<FileTelemetrySourceImpl>> openProcFiles(int count)
+    {
+        const char *paths[] = {"/proc/stat", "/proc/loadavg", "/proc/meminfo", "/proc/uptime"};
+        std::vector<std::unique_ptr<FileTelemetrySourceImpl>> sources;
+        for (int i = 0; i < count; ++i)
+        {
+            sources.push_back(std::make_unique<FileTelemetrySourceImpl>(paths[i % 4]));
+            EXPECT_TRUE(sources.back()->openSource());
+        }
+        return sources;
+    }
+
+    template <typename T>
+    static std::vector<ITelemetrySource *> pointers(const std::vector<std::unique_ptr<T>> &sources)
+    {
+        std::vector<ITelemetrySource *> result;
+        for (const auto &source : sources)
+        {
+            result.push_back(source.get());
+        }
+        return result;
+    }
+};
+
+// ══════════════════════════════════════════════════════════════════════
+// io_uring Path
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(BatchReaderTest, ProcFiles_OneSubmissionForAll)
+{
+    BatchReader reader;
+    if (!reader.usesIoUring())
+    {
+        GTEST_SKIP() << "io_uring not available";
+    }
+
+    auto sources = openProcFiles(32);
+    reader.readAll(pointers(sources), recorder());
+
+    EXPECT_EQ(samples.size(), 32u);
+    EXPECT_EQ(reader.getSubmissions(), 1u);
+    EXPECT_EQ(reader.getBatchedReads(), 32u);
+    EXPECT_EQ(reader.getPlainReads(), 0u);
+    EXPECT_EQ(samples[0].rfind("cpu ", 0), 0u);
+    EXPECT_EQ(samples[2].rfind("MemTotal:", 0), 0u);
+}
+
+TEST_F(BatchReaderTest, ProcFiles_SameFirstLineAsReadSource)
+{
+    BatchReader reader;
+    auto sources = openProcFiles(3);
+    reader.readAll(pointers(sources), recorder());
+
+    // meminfo's first line does not change between the two reads
+    FileTelemetrySourceImpl plain("/proc/meminfo");
+    ASSERT_TRUE(plain.openSource());
+    std::string expected;
+    ASSERT_TRUE(plain.readSource(expected));
+    EXPECT_EQ(samples[2], expected);
+}
+
+TEST_F(BatchReaderTest, QueueDepthExceeded_SplitIntoSeveralSubmissions)
+{
+    BatchReader reader(true, 4);
+    if (!reader.usesIoUring())
+    {
+        GTEST_SKIP() << "io_uring not available";
+    }
+
+    auto sources = openProcFiles(10);
+    reader.readAll(pointers(sources), recorder());
+
+    EXPECT_EQ(samples.size(), 10u);
+    EXPECT_EQ(reader.getSubmissions(), 3u);
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Fallback Path
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(BatchReaderTest, Disabled_PlainReadsSameSamples)
+{
+    BatchReader reader(false);
+    EXPECT_FALSE(reader.usesIoUring());
+
+    auto sources = openProcFiles(8);
+    reader.readAll(pointers(sources), recorder());
+
+    EXPECT_EQ(samples.size(), 8u);
+    EXPECT_EQ(reader.getSubmissions(), 0u);
+    EXPECT_EQ(reader.getPlainReads(), 8u);
+    EXPECT_EQ(samples[0].rfind("cpu ", 0), 0u);
+}
+
+TEST_F(BatchReaderTest, RegularFile_KeepsLineByLineReads)
+{
+    const std::string path = "/tmp/telemetry_batch_reader_test.txt";
+    std::ofstream(path) << "1\n2\n";
+
+    std::vector<std::unique_ptr<FileTelemetrySourceImpl>> sources;
+    sources.push_back(std::make_unique<FileTelemetrySourceImpl>(path));
+    ASSERT_TRUE(sources[0]->openSource());
+
+    BatchReader reader;
+    reader.readAll(pointers(sources), recorder());
+    EXPECT_EQ(samples[0], "1");
+    reader.readAll(pointers(sources), recorder());
+    EXPECT_EQ(samples[0], "2");
+    EXPECT_EQ(reader.getPlainReads(), 2u);
+
+    std::remove(path.c_str());
+}
+
+TEST_F(BatchReaderTest, FailedRingRead_RetriedWithReadSource)
+{
+    // Describes a read the kernel rejects (-EBADF) but reads fine itself
+    struct BrokenFdSource : ITelemetrySource
+    {
+        char buffer[16];
+        bool openSource() override { return true; }
+        bool readSource(std::string &out) override
+        {
+            out = "plain";
+            return true;
+        }
+        bool prepareRead(ReadRequest &request) override
+        {
+            request.fd = -1;
+            request.buffer = buffer;
+            request.length = sizeof(buffer);
+            request.offset = 0;
+            return true;
+        }
+    };
+
+    BatchReader reader;
+    if (!reader.usesIoUring())
+    {
+        GTEST_SKIP() << "io_uring not available";
+    }
+
+    BrokenFdSource broken;
+    std::vector<ITelemetrySource *> sources{&broken};
+    reader.readAll(sources, recorder());
+    EXPECT_EQ(samples[0], "plain");
+    EXPECT_EQ(reader.getBatchedReads(), 0u);
+    EXPECT_EQ(reader.getPlainReads(), 1u);
+
+    // Not an unsupported opcode: the ring stays in use
+    EXPECT_TRUE(reader.usesIoUring());
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Socket Sources
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(BatchReaderTest, StreamSocket_FramesReadThroughRing)
+{
+    const std::string path = "/tmp/telemetry_batch_reader_test.sock";
+    SafeSocket server;
+    ASSERT_TRUE(server.createSocket());
+    ASSERT_TRUE(server.listenSocket(path));
+
+    std::vector<std::unique_ptr<SocketTelemetrySourceImpl>> sources;
+    sources.push_back(std::make_unique<SocketTelemetrySourceImpl>(path, FramingMode::Newline));
+    ASSERT_TRUE(sources[0]->openSource());
+    SafeSocket peer;
+    ASSERT_TRUE(server.acceptConnection(peer));
+
+    BatchReader reader;
+    // Nothing sent yet: completes with EAGAIN instead of blocking
+    reader.readAll(pointers(sources), recorder());
+    EXPECT_TRUE(samples.empty());
+
+    peer.sendData("17\n18\n");
+    reader.readAll(pointers(sources), recorder());
+    EXPECT_EQ(samples[0], "17");
+
+    // Second frame is already buffered: served without any I/O
+    uint64_t batched = reader.getBatchedReads();
+    reader.readAll(pointers(sources), recorder());
+    EXPECT_EQ(samples[0], "18");
+    EXPECT_EQ(reader.getBatchedReads(), batched);
+
+    peer.closeSocket();
+    reader.readAll(pointers(sources), recorder());
+    EXPECT_TRUE(sources[0]->isPeerClosed());
+}
@@ -0,0 +1,231 @@
+// Utest/phase2/CgroupCollectorsTest.cc
+
+#include <gtest/gtest.h>
+#include "SmartDataHub/CgroupCollectors.hpp"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SmartDataHub;
+
+class CgroupCollectorsTest : public ::testing::Test
+{
+protected:
+    const std::string path = "/tmp/test_cgroup_collector.txt";
+
+    void TearDown() override
+    {
+        std::remove(path.c_str());
+    }
+
+    // Rewrites the file in place; the collector keeps its fd open
+    void write(const std::string &content)
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << content;
+    }
+
+    static std::map<std::string, Metric> byName(const std::vector<Metric> &metrics)
+    {
+        std::map<std::string, Metric> result;
+        for (const Metric &metric : metrics)
+        {
+            result[std::string(metric.name)] = metric;
+        }
+        return result;
+    }
+
+    static void pause()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+};
+
+// ══════════════════════════════════════════════════════════════════════
+// Discovery Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(CgroupCollectorsTest, Resolve_NamespacedContainer)
+{
+    std::string dir;
+    ASSERT_TRUE(resolveCgroupDir("0::/\n",
+                                 "22 1 0:21 / /proc rw,nosuid - proc proc rw\n"
+                                 "31 22 0:27 / /sys/fs/cgroup ro,nosuid shared:9 - cgroup2 cgroup2 rw,nsdelegate\n",
+                                 dir));
+    EXPECT_EQ(dir, "/sys/fs/cgroup");
+}
+
+TEST_F(CgroupCollectorsTest, Resolve_HostService)
+{
+    std::string dir;
+    ASSERT_TRUE(resolveCgroupDir("0::/system.slice/agent.service\n",
+                                 "31 22 0:27 / /sys/fs/cgroup/ rw - cgroup2 cgroup2 rw\n", dir));
+    EXPECT_EQ(dir, "/sys/fs/cgroup/system.slice/agent.service");
+}
+
+TEST_F(CgroupCollectorsTest, Resolve_SubtreeMountAndHybridHost)
+{
+    // Hybrid host: v1 controllers plus the unified hierarchy elsewhere
+    std::string dir;
+    ASSERT_TRUE(resolveCgroupDir("12:memory:/docker/abc\n1:name=systemd:/docker/abc\n0::/docker/abc/worker\n",
+                                 "40 32 0:35 / /sys/fs/cgroup/memory rw - cgroup cgroup rw,memory\n"
+                                 "42 32 0:38 /docker/abc /sys/fs/cgroup\\040unified rw - cgroup2 cgroup2 rw\n",
+                                 dir));
+    EXPECT_EQ(dir, "/sys/fs/cgroup unified/worker");
+
+    // Outside the mounted sub-tree the mount is the closest view
+    ASSERT_TRUE(resolveCgroupDir("0::/other\n", "42 32 0:38 /docker/abc /mnt/cg rw - cgroup2 cgroup2 rw\n", dir));
+    EXPECT_EQ(dir, "/mnt/cg");
+}
+
+TEST_F(CgroupCollectorsTest, Resolve_BackslashWithoutOctalKept)
+{
+    // Only \ooo with three octal digits is an escape
+    std::string dir;
+    ASSERT_TRUE(resolveCgroupDir("0::/\n", "42 32 0:38 / /mnt/a\\08x\\1z2\\134b rw - cgroup2 cgroup2 rw\n", dir));
+    EXPECT_EQ(dir, "/mnt/a\\08x\\1z2\\b");
+}
+
+TEST_F(CgroupCollectorsTest, Resolve_NoUnifiedHierarchy)
+{
+    std::string dir;
+    EXPECT_FALSE(resolveCgroupDir("4:cpu,cpuacct:/\n", "40 32 0:35 / /sys/fs/cgroup/cpu rw - cgroup cgroup rw\n", dir));
+    EXPECT_FALSE(resolveCgroupDir("0::/\n", "40 32 0:35 / /sys/fs/cgroup/cpu rw - cgroup cgroup rw\n", dir));
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Collector Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(CgroupCollectorsTest, CpuStat_UsageAndThrottling)
+{
+    write("usage_usec 1000000\nuser_usec 800000\nsystem_usec 200000\n"
+          "nr_periods 100\nnr_throttled 10\nthrottled_usec 5000\nnr_bursts 0\nburst_usec 0\n");
+    CgroupCpuStatCollector collector(path);
+    ASSERT_TRUE(collector.open());
+
+    std::vector<Metric> metrics;
+    ASSERT_TRUE(collector.collect(metrics));
+    EXPECT_TRUE(metrics.empty()); // baseline only
+
+    pause();
+    write("usage_usec 1100000\nuser_usec 860000\nsystem_usec 240000\n"
+          "nr_periods 120\nnr_throttled 15\nthrottled_usec 9000\nnr_bursts 0\nburst_usec 0\n");
+    ASSERT_TRUE(collector.collect(metrics));
+    auto found = byName(metrics);
+    ASSERT_EQ(found.size(), 5u);
+
+    // 100 ms of CPU over the interval, recovered from usage
+    double elapsed = 100000.0 / 1e4 / found["usage"].value;
+    ASSERT_GT(elapsed, 0.04);
+    EXPECT_NEAR(found["user"].value, 6.0 / elapsed, 1e-6);
+    EXPECT_NEAR(found["system"].value, 4.0 / elapsed, 1e-6);
+    EXPECT_NEAR(found["throttled"].value, 25.0, 1e-9); // 5 of 20 periods
+    EXPECT_NEAR(found["throttled_ms"].value, 4.0 / elapsed, 1e-6);
+    EXPECT_EQ(found["usage"].unit, "%cpu");
+    EXPECT_TRUE(found["throttled"].unit.empty());
+}
+
+TEST_F(CgroupCollectorsTest, CpuStat_RootCgroupHasNoThrottling)
+{
+    write("usage_usec 5000\nuser_usec 3000\nsystem_usec 2000\n");
+    CgroupCpuStatCollector collector(path);
+    ASSERT_TRUE(collector.open());
+
+    std::vector<Metric> metrics;
+    ASSERT_TRUE(collector.collect(metrics));
+    pause();
+    ASSERT_TRUE(collector.collect(metrics));
+    auto found = byName(metrics);
+    EXPECT_EQ(found.size(), 3u);
+    EXPECT_EQ(found.count("throttled"), 0u);
+
+    write("garbage\n");
+    EXPECT_FALSE(collector.collect(metrics));
+}
+
+TEST_F(CgroupCollectorsTest, Memory_CurrentAndStat)
+{
+    write("1323491328\n");
+    CgroupMemoryCollector current(path);
+    ASSERT_TRUE(current.open());
+    std::vector<Metric> metrics;
+    ASSERT_TRUE(current.collect(metrics));
+    ASSERT_EQ(metrics.size(), 1u);
+    EXPECT_EQ(metrics[0].name, "current");
+    EXPECT_DOUBLE_EQ(metrics[0].value, 1292472.0);
+    EXPECT_EQ(metrics[0].unit, "kB");
+
+    write("anon 1048576\nfile 2097152\nkernel 4096\nkernel_stack 8192\nshmem 0\n"
+          "file_dirty 12288\nfile_writeback 0\nslab_reclaimable 4096\nslab 8192\n"
+          "pgfault 1000\npgmajfault 4\nworkingset_refault_file 3\n");
+    CgroupMemoryStatCollector stat(path);
+    ASSERT_TRUE(stat.open());
+    metrics.clear();
+    ASSERT_TRUE(stat.collect(metrics));
+    auto found = byName(metrics);
+    EXPECT_EQ(found.size(), 7u); // fault rates need two samples
+    EXPECT_DOUBLE_EQ(found["anon"].value, 1024.0);
+    EXPECT_DOUBLE_EQ(found["file"].value, 2048.0);
+    EXPECT_DOUBLE_EQ(found["file_dirty"].value, 12.0);
+    EXPECT_DOUBLE_EQ(found["slab"].value, 8.0); // not slab_reclaimable
+
+    pause();
+    write("anon 1048576\nfile 2097152\npgfault 1100\npgmajfault 6\n");
+    metrics.clear();
+    ASSERT_TRUE(stat.collect(metrics));
+    found = byName(metrics);
+    EXPECT_EQ(found.size(), 4u); // missing keys are not reported
+    ASSERT_EQ(found.count("pgfault"), 1u);
+    double elapsed = 100.0 / found["pgfault"].value;
+    ASSERT_GT(elapsed, 0.04);
+    EXPECT_NEAR(found["pgmajfault"].value, 2.0 / elapsed, 1e-6);
+    EXPECT_EQ(found["pgfault"].unit, "/s");
+}
+
+TEST_F(CgroupCollectorsTest, IoStat_PerDeviceRatesWithFilter)
+{
+    write("8:0 rbytes=1048576 wbytes=0 rios=10 wios=0 dbytes=0 dios=0\n"
+          "259:0 rbytes=0 wbytes=2048 rios=0 wios=1 dbytes=0 dios=0\n");
+    CgroupIoStatCollector collector(path);
+    collector.setFilter({"8:0"});
+    ASSERT_TRUE(collector.open());
+
+    std::vector<Metric> metrics;
+    ASSERT_TRUE(collector.collect(metrics));
+    EXPECT_TRUE(metrics.empty());
+
+    pause();
+    write("8:0 rbytes=2097152 wbytes=4096 rios=110 wios=1 dbytes=0 dios=0\n"
+          "259:0 rbytes=0 wbytes=4096 rios=0 wios=2 dbytes=0 dios=0\n");
+    ASSERT_TRUE(collector.collect(metrics));
+    auto found = byName(metrics);
+    ASSERT_EQ(found.size(), 4u); // 259:0 filtered out
+
+    double elapsed = 100.0 / found["8:0.read_iops"].value;
+    ASSERT_GT(elapsed, 0.04);
+    EXPECT_NEAR(found["8:0.read_kBps"].value, 1024.0 / elapsed, 1e-6);
+    EXPECT_NEAR(found["8:0.write_kBps"].value, 4.0 / elapsed, 1e-6);
+    EXPECT_NEAR(found["8:0.write_iops"].value, 1.0 / elapsed, 1e-6);
+    EXPECT_EQ(found["8:0.read_kBps"].unit, "kB/s");
+}
+
+TEST_F(CgroupCollectorsTest, Discover_OwnCgroupIsReadable)
+{
+    std::string dir = discoverCgroupDir();
+    if (dir.empty())
+    {
+        GTEST_SKIP() << "no cgroup v2 hierarchy";
+    }
+    CgroupCpuStatCollector collector(dir + "/cpu.stat");
+    if (!collector.open())
+    {
+        GTEST_SKIP() << "cpu.stat not readable in " << dir;
+    }
+    std::vector<Metric> metrics;
+    EXPECT_TRUE(collector.collect(metrics));
+}
@@ -4,6 +4,8 @@
 #include "SmartDataHub/FileTelemetrySourceImpl.hpp"
 #include <fstream>
 #include <cstdio>
+#include <chrono>
+#include <thread>
 
 using namespace SmartDataHub;
 
@@ -91,6 +93,165 @@ TEST_F(FileTelemetrySourceImplTest, ReadSource_NotOpened_ReturnsFalse)
     EXPECT_FALSE(source.readSource(line));
 }
 
+TEST_F(FileTelemetrySourceImplTest, ReadSource_WrapsAroundAtEndOfFile)
+{
+    FileTelemetrySourceImpl source(testFilePath);
+    source.openSource();
+
+    std::string line;
+    EXPECT_TRUE(source.readSource(line));
+    EXPECT_TRUE(source.readSource(line));
+    EXPECT_TRUE(source.readSource(line));
+    EXPECT_TRUE(source.readSource(line));
+    EXPECT_EQ(line, "Line 1: Data");
+}
+
+TEST_F(FileTelemetrySourceImplTest, ReadSource_SeesRewrittenContent)
+{
+    FileTelemetrySourceImpl source(testFilePath);
+    source.openSource();
+
+    std::string line;
+    EXPECT_TRUE(source.readSource(line));
+    EXPECT_TRUE(source.readSource(line));
+    EXPECT_TRUE(source.readSource(line));
+
+    std::ofstream(testFilePath) << "42\n";
+
+    EXPECT_TRUE(source.readSource(line));
+    EXPECT_EQ(line, "42");
+}
+
+TEST_F(FileTelemetrySourceImplTest, ReadSource_StringView)
+{
+    FileTelemetrySourceImpl source(testFilePath);
+    source.openSource();
+
+    std::string_view line;
+    EXPECT_TRUE(source.readSource(line));
+    EXPECT_EQ(line, "Line 1: Data");
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// readLine / rewind Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(FileTelemetrySourceImplTest, ReadLine_StopsAtEndOfFile)
+{
+    FileTelemetrySourceImpl source(testFilePath);
+    source.openSource();
+
+    std::string_view line;
+    EXPECT_TRUE(source.readLine(line));
+    EXPECT_TRUE(source.readLine(line));
+    EXPECT_TRUE(source.readLine(line));
+    EXPECT_EQ(line, "Line 3: Final Data");
+    EXPECT_FALSE(source.readLine(line));
+}
+
+TEST_F(FileTelemetrySourceImplTest, Rewind_RestartsFromFirstLine)
+{
+    FileTelemetrySourceImpl source(testFilePath);
+    source.openSource();
+
+    std::string_view line;
+    EXPECT_TRUE(source.readLine(line));
+    EXPECT_TRUE(source.readLine(line));
+
+    source.rewind();
+    EXPECT_TRUE(source.readLine(line));
+    EXPECT_EQ(line, "Line 1: Data");
+}
+
+TEST_F(FileTelemetrySourceImplTest, ReadSnapshot_SeesRewrittenContent)
+{
+    FileTelemetrySourceImpl source(testFilePath);
+    source.openSource();
+
+    std::string_view content;
+    EXPECT_TRUE(source.readSnapshot(content));
+    EXPECT_EQ(content, testContent);
+
+    std::ofstream(testFilePath) << "42\n";
+
+    EXPECT_TRUE(source.readSnapshot(content));
+    EXPECT_EQ(content, "42\n");
+}
+
+TEST_F(FileTelemetrySourceImplTest, ReadSnapshot_NotOpened_ReturnsFalse)
+{
+    FileTelemetrySourceImpl source(testFilePath);
+    std::string_view content;
+    EXPECT_FALSE(source.isOpen());
+    EXPECT_FALSE(source.readSnapshot(content));
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Event-driven (waitForData) Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(FileTelemetrySourceImplTest, WaitForData_NoWatch_PollsAndReturnsTrue)
+{
+    FileTelemetrySourceImpl source(testFilePath);
+    source.openSource();
+    EXPECT_FALSE(source.isWatching());
+    EXPECT_TRUE(source.waitForData(10));
+}
+
+TEST_F(FileTelemetrySourceImplTest, WaitForData_NoChange_ReturnsFalse)
+{
+    FileTelemetrySourceImpl source(testFilePath);
+    source.openSource();
+    EXPECT_TRUE(source.enableWatch());
+
+    EXPECT_FALSE(source.waitForData(30));
+}
+
+TEST_F(FileTelemetrySourceImplTest, WaitForData_Rewrite_ReadsNewValue)
+{
+    FileTelemetrySourceImpl source(testFilePath);
+    source.openSource();
+    source.enableWatch();
+
+    std::string line;
+    EXPECT_TRUE(source.readSource(line));
+
+    std::thread writer([this] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        std::ofstream(testFilePath) << "100\n";
+    });
+
+    // Truncate and write may arrive as separate wakeups
+    bool gotValue = false;
+    for (int i = 0; i < 10 && !gotValue; ++i)
+    {
+        if (source.waitForData(1000) && source.readSource(line))
+        {
+            gotValue = (line == "100");
+        }
+    }
+    EXPECT_TRUE(gotValue);
+
+    writer.join();
+}
+
+TEST_F(FileTelemetrySourceImplTest, WaitForData_Replaced_ReopensFile)
+{
+    FileTelemetrySourceImpl source(testFilePath);
+    source.openSource();
+    source.enableWatch();
+
+    const std::string tmpPath = testFilePath + ".new";
+    std::ofstream(tmpPath) << "replacement\n";
+    std::rename(tmpPath.c_str(), testFilePath.c_str());
+
+    EXPECT_TRUE(source.waitForData(1000));
+
+    std::string line;
+    EXPECT_TRUE(source.readSource(line));
+    EXPECT_EQ(line, "replacement");
+}
+
 // ══════════════════════════════════════════════════════════════════════
 // Interface Tests
 // ══════════════════════════════════════════════════════════════════════
@@ -135,6 +296,19 @@ TEST_F(FileTelemetrySourceImplTest, ReadProcStat)
     EXPECT_TRUE(line.find("cpu") == 0);
 }
 
+TEST_F(FileTelemetrySourceImplTest, ReadProcStat_AlwaysFirstLine)
+{
+    FileTelemetrySourceImpl source("/proc/stat");
+    EXPECT_TRUE(source.openSource());
+
+    std::string line;
+    EXPECT_TRUE(source.readSource(line));
+    EXPECT_TRUE(source.readSource(line));
+
+    // Pseudo-files are re-sampled from the top on every read
+    EXPECT_TRUE(line.find("cpu ") == 0);
+}
+
 TEST_F(FileTelemetrySourceImplTest, ReadProcMeminfo)
 {
     FileTelemetrySourceImpl source("/proc/meminfo");
@@ -0,0 +1,131 @@
+// Utest/phase2/FileWatchTest.cc
+
+#include <gtest/gtest.h>
+#include "SmartDataHub/FileWatch.hpp"
+#include <fstream>
+#include <cstdio>
+#include <chrono>
+#include <thread>
+
+using namespace SmartDataHub;
+
+class FileWatchTest : public ::testing::Test
+{
+protected:
+    const std::string testFilePath = "/tmp/file_watch_test.txt";
+
+    void SetUp() override
+    {
+        std::ofstream(testFilePath) << "0\n";
+    }
+
+    void TearDown() override
+    {
+        std::remove(testFilePath.c_str());
+        std::remove((testFilePath + ".new").c_str());
+    }
+};
+
+// ══════════════════════════════════════════════════════════════════════
+// watch Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(FileWatchTest, DefaultConstructor_NotWatching)
+{
+    FileWatch watch;
+    EXPECT_FALSE(watch.isWatching());
+    EXPECT_EQ(watch.getFd(), -1);
+    EXPECT_EQ(watch.wait(0), FileWatch::Event::None);
+}
+
+TEST_F(FileWatchTest, Watch_ExistingFile_ReturnsTrue)
+{
+    FileWatch watch;
+    EXPECT_TRUE(watch.watch(testFilePath));
+    EXPECT_TRUE(watch.isWatching());
+    EXPECT_GE(watch.getFd(), 0);
+}
+
+TEST_F(FileWatchTest, Watch_MissingFile_ReturnsFalse)
+{
+    FileWatch watch;
+    EXPECT_FALSE(watch.watch("/nonexistent/path/file.txt"));
+    EXPECT_FALSE(watch.isWatching());
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// wait Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(FileWatchTest, Wait_NoChange_TimesOut)
+{
+    FileWatch watch;
+    watch.watch(testFilePath);
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(watch.wait(50), FileWatch::Event::None);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(40));
+}
+
+TEST_F(FileWatchTest, Wait_Write_ReportsModified)
+{
+    FileWatch watch;
+    watch.watch(testFilePath);
+
+    std::ofstream(testFilePath) << "42\n";
+
+    EXPECT_EQ(watch.wait(1000), FileWatch::Event::Modified);
+    // All events of that write were drained
+    EXPECT_EQ(watch.wait(0), FileWatch::Event::None);
+}
+
+TEST_F(FileWatchTest, Wait_WakesBlockedWaiterImmediately)
+{
+    FileWatch watch;
+    watch.watch(testFilePath);
+
+    std::thread writer([this] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        std::ofstream(testFilePath) << "7\n";
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(watch.wait(-1), FileWatch::Event::Modified);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+
+    writer.join();
+}
+
+TEST_F(FileWatchTest, Wait_RenamedOver_ReportsReplacedAndRearms)
+{
+    FileWatch watch;
+    watch.watch(testFilePath);
+
+    std::ofstream(testFilePath + ".new") << "99\n";
+    std::rename((testFilePath + ".new").c_str(), testFilePath.c_str());
+
+    EXPECT_EQ(watch.wait(1000), FileWatch::Event::Replaced);
+
+    // The watch now follows the new file
+    std::ofstream(testFilePath) << "100\n";
+    EXPECT_EQ(watch.wait(1000), FileWatch::Event::Modified);
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Move Semantics Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(FileWatchTest, MoveConstructor_TransfersOwnership)
+{
+    FileWatch watch1;
+    watch1.watch(testFilePath);
+    int originalFd = watch1.getFd();
+
+    FileWatch watch2(std::move(watch1));
+
+    EXPECT_FALSE(watch1.isWatching());
+    EXPECT_EQ(watch2.getFd(), originalFd);
+
+    std::ofstream(testFilePath) << "1\n";
+    EXPECT_EQ(watch2.wait(1000), FileWatch::Event::Modified);
+}
@@ -0,0 +1,153 @@
+// Utest/phase2/FrameParserTest.cc
+
+#include <gtest/gtest.h>
+#include "SmartDataHub/FrameParser.hpp"
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace SmartDataHub;
+
+class FrameParserTest : public ::testing::Test
+{
+protected:
+    // Feeds bytes as if they came from one recv()
+    static void feed(FrameParser &parser, std::string_view bytes)
+    {
+        char *space = parser.prepareWrite(bytes.size());
+        std::memcpy(space, bytes.data(), bytes.size());
+        parser.commit(bytes.size());
+    }
+
+    static std::vector<std::string> drain(FrameParser &parser)
+    {
+        std::vector<std::string> frames;
+        std::string_view frame;
+        while (parser.nextFrame(frame))
+        {
+            frames.emplace_back(frame);
+        }
+        return frames;
+    }
+
+    static std::string lengthPrefixed(std::string_view payload)
+    {
+        std::vector<char> out;
+        FrameParser::appendLengthPrefixed(out, payload);
+        return std::string(out.begin(), out.end());
+    }
+};
+
+// ══════════════════════════════════════════════════════════════════════
+// Newline Framing
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(FrameParserTest, Newline_CoalescedFramesSplit)
+{
+    FrameParser parser(FramingMode::Newline);
+    feed(parser, "a\nbb\nccc\n");
+    EXPECT_EQ(drain(parser), (std::vector<std::string>{"a", "bb", "ccc"}));
+    EXPECT_EQ(parser.bufferedBytes(), 0u);
+}
+
+TEST_F(FrameParserTest, Newline_StraddlingFrameReassembled)
+{
+    FrameParser parser(FramingMode::Newline);
+    feed(parser, "CPU: 4");
+    EXPECT_TRUE(drain(parser).empty());
+    EXPECT_FALSE(parser.hasCompleteFrame());
+
+    feed(parser, "5.5%\nRAM");
+    EXPECT_TRUE(parser.hasCompleteFrame());
+    EXPECT_EQ(drain(parser), (std::vector<std::string>{"CPU: 45.5%"}));
+    EXPECT_EQ(parser.bufferedBytes(), 3u);
+
+    feed(parser, "\n");
+    EXPECT_EQ(drain(parser), (std::vector<std::string>{"RAM"}));
+}
+
+TEST_F(FrameParserTest, Newline_EmptyLineIsAFrame)
+{
+    FrameParser parser(FramingMode::Newline);
+    feed(parser, "\nx\n");
+    EXPECT_EQ(drain(parser), (std::vector<std::string>{"", "x"}));
+}
+
+TEST_F(FrameParserTest, Newline_OversizedLineDropped)
+{
+    FrameParser parser(FramingMode::Newline, 8);
+    feed(parser, "0123456789abcdef");  // no newline, over the limit
+    EXPECT_TRUE(drain(parser).empty());
+    feed(parser, "tail\nok\n");
+    EXPECT_EQ(drain(parser), (std::vector<std::string>{"ok"}));
+    EXPECT_EQ(parser.getDroppedBytes(), 21u);
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Length-prefixed Framing
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(FrameParserTest, LengthPrefixed_FramesWithEmbeddedNewlinesAndNul)
+{
+    FrameParser parser(FramingMode::LengthPrefixed);
+    std::string payload("a\nb\0c", 5);
+    feed(parser, lengthPrefixed(payload) + lengthPrefixed("second"));
+    EXPECT_EQ(drain(parser), (std::vector<std::string>{payload, "second"}));
+}
+
+TEST_F(FrameParserTest, LengthPrefixed_ByteByByte)
+{
+    FrameParser parser(FramingMode::LengthPrefixed);
+    std::string wire = lengthPrefixed("hello") + lengthPrefixed("");
+
+    std::vector<std::string> frames;
+    for (char c : wire)
+    {
+        feed(parser, std::string_view(&c, 1));
+        auto got = drain(parser);
+        frames.insert(frames.end(), got.begin(), got.end());
+    }
+    EXPECT_EQ(frames, (std::vector<std::string>{"hello", ""}));
+}
+
+TEST_F(FrameParserTest, LengthPrefixed_OversizedMarksCorrupt)
+{
+    FrameParser parser(FramingMode::LengthPrefixed, 16);
+    feed(parser, lengthPrefixed(std::string(17, 'x')));
+    EXPECT_TRUE(drain(parser).empty());
+    EXPECT_TRUE(parser.isCorrupt());
+
+    parser.reset();
+    EXPECT_FALSE(parser.isCorrupt());
+    feed(parser, lengthPrefixed("fine"));
+    EXPECT_EQ(drain(parser), (std::vector<std::string>{"fine"}));
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Raw Mode / Buffer Management
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(FrameParserTest, Raw_EachChunkIsOneFrame)
+{
+    FrameParser parser(FramingMode::Raw);
+    feed(parser, "abc");
+    EXPECT_EQ(drain(parser), (std::vector<std::string>{"abc"}));
+    feed(parser, "de\nf");
+    EXPECT_EQ(drain(parser), (std::vector<std::string>{"de\nf"}));
+}
+
+TEST_F(FrameParserTest, Buffer_CompactsInsteadOfGrowing)
+{
+    FrameParser parser(FramingMode::Newline);
+    std::string line(100, 'x');
+    line += '\n';
+
+    // 100 KB through a buffer that starts at 4 KB: consumed space
+    // must be reused rather than the buffer growing
+    for (int i = 0; i < 1000; ++i)
+    {
+        feed(parser, line);
+        EXPECT_EQ(drain(parser).size(), 1u);
+    }
+    EXPECT_LE(parser.writableSize(), 4096u);
+}
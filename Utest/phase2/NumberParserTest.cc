@@ -0,0 +1,292 @@
+// Utest/phase2/NumberParserTest.cc
+
+#include <gtest/gtest.h>
+#include "SmartDataHub/NumberParser.hpp"
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace SmartDataHub;
+
+namespace
+{
+    float fromChars(const std::string &text)
+    {
+        float value = 0.0f;
+        std::from_chars(text.data(), text.data() + text.size(), value);
+        return value;
+    }
+
+    struct Parsed
+    {
+        std::vector<float> values;
+        std::vector<NumberStatus> status;
+        NumberBatch batch;
+    };
+
+    Parsed parseAll(std::string_view text, size_t capacity = 64)
+    {
+        Parsed parsed;
+        parsed.values.resize(capacity);
+        parsed.status.resize(capacity);
+        parsed.batch = parseFloats(text, parsed.values.data(), parsed.status.data(), capacity);
+        parsed.values.resize(parsed.batch.count);
+        parsed.status.resize(parsed.batch.count);
+        return parsed;
+    }
+} // namespace
+
+// ══════════════════════════════════════════════════════════════════════
+// scanFloat Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST(NumberParserTest, ScanFloat_StopsAfterTheNumber)
+{
+    std::string text = "17.5xyz";
+    const char *pos = text.data();
+    float value = 0.0f;
+    ASSERT_EQ(scanFloat(pos, text.data() + text.size(), value), NumberStatus::Ok);
+    EXPECT_FLOAT_EQ(value, 17.5f);
+    EXPECT_EQ(pos, text.data() + 4);
+
+    text = "42%";
+    pos = text.data();
+    ASSERT_EQ(scanFloat(pos, text.data() + text.size(), value), NumberStatus::Ok);
+    EXPECT_FLOAT_EQ(value, 42.0f);
+    EXPECT_EQ(*pos, '%');
+}
+
+TEST(NumberParserTest, ScanFloat_ErrorsLeavePositionUnchanged)
+{
+    float value = 3.0f;
+    for (std::string text : {"abc", "-", "", "1e99", "-1e99"})
+    {
+        const char *pos = text.data();
+        NumberStatus expected = text.find('e') != std::string::npos ? NumberStatus::OutOfRange : NumberStatus::Invalid;
+        EXPECT_EQ(scanFloat(pos, text.data() + text.size(), value), expected) << text;
+        EXPECT_EQ(pos, text.data()) << text;
+    }
+    EXPECT_FLOAT_EQ(value, 3.0f);
+}
+
+TEST(NumberParserTest, ScanFloat_MatchesFromChars)
+{
+    std::vector<std::string> samples = {"0",        "7",         "-3",           "12345678",  "123456789",
+                                        "0.5",      "-0.25",     "99.99999999",  "1.0e3",     "2.5E-2",
+                                        "1.",       "inf",       "-nan",         "3.4e38",    "0.000001",
+                                        "00042.10", "1234.5678", "12345678.125", "1.17549435e-38"};
+
+    // Plus random short decimals, the common telemetry case
+    std::mt19937 rng(7);
+    for (int i = 0; i < 2000; ++i)
+    {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.*f", static_cast<int>(rng() % 7),
+                      static_cast<double>(rng() % 100000000) / std::pow(10.0, rng() % 6));
+        samples.push_back(buffer);
+    }
+
+    for (const std::string &text : samples)
+    {
+        const char *pos = text.data();
+        float value = 0.0f;
+        ASSERT_EQ(scanFloat(pos, text.data() + text.size(), value), NumberStatus::Ok) << text;
+        float expected = fromChars(text);
+        if (std::isnan(expected))
+        {
+            EXPECT_TRUE(std::isnan(value)) << text;
+        }
+        else
+        {
+            EXPECT_EQ(value, expected) << text;
+        }
+    }
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// parseFloats Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST(NumberParserTest, ParseFloats_DelimitersAndPerElementErrors)
+{
+    auto parsed = parseAll("  12, 13.5;-4\t\tbad\n1e99 7x\r\n0.125,,  ");
+    ASSERT_EQ(parsed.batch.count, 7u);
+    EXPECT_EQ(parsed.batch.errors, 3u);
+
+    EXPECT_FLOAT_EQ(parsed.values[0], 12.0f);
+    EXPECT_FLOAT_EQ(parsed.values[1], 13.5f);
+    EXPECT_FLOAT_EQ(parsed.values[2], -4.0f);
+    EXPECT_EQ(parsed.status[3], NumberStatus::Invalid);
+    EXPECT_EQ(parsed.status[4], NumberStatus::OutOfRange);
+    EXPECT_EQ(parsed.status[5], NumberStatus::Invalid); // trailing "x"
+    EXPECT_FLOAT_EQ(parsed.values[5], 0.0f);
+    EXPECT_EQ(parsed.status[6], NumberStatus::Ok);
+    EXPECT_FLOAT_EQ(parsed.values[6], 0.125f);
+}
+
+TEST(NumberParserTest, ParseFloats_LongTokensAndLongDelimiterRuns)
+{
+    std::string text = "1.00000000000000000001" + std::string(40, ' ') + "123456789012.5" +
+                       std::string(17, '\n') + "abcdefghijklmnopqrstuvwxyz 5";
+    auto parsed = parseAll(text);
+    ASSERT_EQ(parsed.batch.count, 4u);
+    EXPECT_FLOAT_EQ(parsed.values[0], 1.0f);
+    EXPECT_EQ(parsed.values[1], fromChars("123456789012.5"));
+    EXPECT_EQ(parsed.status[2], NumberStatus::Invalid);
+    EXPECT_FLOAT_EQ(parsed.values[3], 5.0f);
+    EXPECT_EQ(parsed.batch.consumed, text.size());
+}
+
+TEST(NumberParserTest, ParseFloats_ResumesAfterCapacity)
+{
+    std::string text;
+    for (int i = 0; i < 1000; ++i)
+    {
+        text += std::to_string(i) + "." + std::to_string(i % 10) + (i % 3 == 0 ? "\n" : " ");
+    }
+
+    std::vector<float> values;
+    float chunk[64];
+    NumberStatus status[64];
+    std::string_view rest = text;
+    while (true)
+    {
+        NumberBatch batch = parseFloats(rest, chunk, status, 64);
+        EXPECT_EQ(batch.errors, 0u);
+        values.insert(values.end(), chunk, chunk + batch.count);
+        rest.remove_prefix(batch.consumed);
+        if (batch.count < 64)
+        {
+            break;
+        }
+    }
+
+    ASSERT_EQ(values.size(), 1000u);
+    for (int i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(values[i], fromChars(std::to_string(i) + "." + std::to_string(i % 10))) << i;
+    }
+    EXPECT_TRUE(rest.empty());
+}
+
+TEST(NumberParserTest, ParseFloats_MatchesTokenByTokenReference)
+{
+    // Random tokens and delimiter runs, so tokens straddle every window
+    // and block position
+    static const char *const Pieces[] = {"0", "-7", "12.5", "99.99", "1e3", "-2.5E-3", "x", "4.2.1",
+                                         "123456789", "0.000001", "nan", "-", "7.", "1e99"};
+    static const char Delimiters[] = {' ', '\n', ',', ';', '\t', '\r'};
+    std::mt19937 rng(11);
+    std::string text;
+    std::vector<std::string> tokens;
+    for (int i = 0; i < 5000; ++i)
+    {
+        std::string token = Pieces[rng() % (sizeof(Pieces) / sizeof(Pieces[0]))];
+        if (rng() % 50 == 0)
+        {
+            token = std::string(70 + rng() % 10, '0') + "1"; // longer than a window
+        }
+        tokens.push_back(token);
+        text += token;
+        for (unsigned n = 1 + rng() % 3; n > 0; --n)
+        {
+            text += Delimiters[rng() % sizeof(Delimiters)];
+        }
+    }
+
+    auto parsed = parseAll(text, tokens.size() + 1);
+    ASSERT_EQ(parsed.batch.count, tokens.size());
+    for (size_t i = 0; i < tokens.size(); ++i)
+    {
+        const std::string &token = tokens[i];
+        float expected = 0.0f;
+        auto result = std::from_chars(token.data(), token.data() + token.size(), expected);
+        NumberStatus expectedStatus = result.ec == std::errc::result_out_of_range ? NumberStatus::OutOfRange
+                                      : result.ec != std::errc() || result.ptr != token.data() + token.size()
+                                          ? NumberStatus::Invalid
+                                          : NumberStatus::Ok;
+        ASSERT_EQ(parsed.status[i], expectedStatus) << i << ": " << token;
+        if (expectedStatus == NumberStatus::Ok && !std::isnan(expected))
+        {
+            ASSERT_EQ(parsed.values[i], expected) << i << ": " << token;
+        }
+    }
+}
+
+TEST(NumberParserTest, ParseFloats_EmptyInput)
+{
+    float value = 0.0f;
+    NumberStatus status = NumberStatus::Ok;
+    NumberBatch batch = parseFloats({}, &value, &status, 1);
+    EXPECT_EQ(batch.count, 0u);
+    batch = parseFloats(" ,; \n", &value, &status, 1);
+    EXPECT_EQ(batch.count, 0u);
+    EXPECT_EQ(batch.consumed, 5u);
+    batch = parseFloats("1 2", &value, &status, 0);
+    EXPECT_EQ(batch.count, 0u);
+    EXPECT_EQ(batch.consumed, 0u);
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// RecordValues Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST(NumberParserTest, RecordValues_FirstTokenOfEachRecord)
+{
+    // Empty and blank records, several tokens per record, errors: none of
+    // them may shift a value onto another record
+    std::vector<std::string> records = {"42", "", "1 2 3", "\r", "cpu=7", "-3.5", "1e99", " 8,9", "12abc", "0.25"};
+    RecordValues values;
+    for (int round = 0; round < 2; ++round) // buffers reused
+    {
+        values.clear();
+        for (const std::string &record : records)
+        {
+            values.add(record);
+        }
+        values.parse();
+
+        ASSERT_EQ(values.size(), records.size());
+        EXPECT_FLOAT_EQ(values.value(0), 42.0f);
+        EXPECT_EQ(values.status(1), NumberStatus::Ok);
+        EXPECT_FLOAT_EQ(values.value(1), 0.0f);
+        EXPECT_FLOAT_EQ(values.value(2), 1.0f);
+        EXPECT_FLOAT_EQ(values.value(3), 0.0f);
+        EXPECT_EQ(values.status(4), NumberStatus::Invalid);
+        EXPECT_FLOAT_EQ(values.value(5), -3.5f);
+        EXPECT_EQ(values.status(6), NumberStatus::OutOfRange);
+        EXPECT_FLOAT_EQ(values.value(7), 8.0f);
+        EXPECT_EQ(values.status(8), NumberStatus::Invalid);
+        EXPECT_FLOAT_EQ(values.value(9), 0.25f);
+    }
+
+    // parseOne applies the same rule
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        float value = -1.0f;
+        EXPECT_EQ(RecordValues::parseOne(records[i], value), values.status(i)) << records[i];
+        EXPECT_EQ(value, values.value(i)) << records[i];
+    }
+}
+
+TEST(NumberParserTest, RecordValues_ManyTokensPerRecord)
+{
+    // More tokens than records: parsed in several parseFloats() calls
+    std::string wide;
+    for (int i = 0; i < 100; ++i)
+    {
+        wide += std::to_string(i) + " ";
+    }
+    RecordValues values;
+    values.add(wide);
+    values.add("7");
+    values.add(wide.substr(3));
+    values.parse();
+    ASSERT_EQ(values.size(), 3u);
+    EXPECT_FLOAT_EQ(values.value(0), 0.0f);
+    EXPECT_FLOAT_EQ(values.value(1), 7.0f);
+    EXPECT_FLOAT_EQ(values.value(2), 2.0f);
+}
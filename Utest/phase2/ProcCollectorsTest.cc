@@ -0,0 +1,263 @@
+// Utest/phase2/ProcCollectorsTest.cc
+
+#include <gtest/gtest.h>
+#include "SmartDataHub/ProcCollectors.hpp"
+#include "SmartDataHub/ProcSampler.hpp"
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SmartDataHub;
+
+class ProcCollectorsTest : public ::testing::Test
+{
+protected:
+    const std::string path = "/tmp/test_proc_collector.txt";
+
+    void TearDown() override
+    {
+        std::remove(path.c_str());
+    }
+
+    // Rewrites the file in place; the collector keeps its fd open
+    void write(const std::string &content)
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << content;
+    }
+
+    static std::map<std::string, Metric> byName(const std::vector<Metric> &metrics)
+    {
+        std::map<std::string, Metric> result;
+        for (const Metric &metric : metrics)
+        {
+            result[std::string(metric.name)] = metric;
+        }
+        return result;
+    }
+
+    static void pause()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+};
+
+// ══════════════════════════════════════════════════════════════════════
+// Rate Collectors
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(ProcCollectorsTest, DiskStats_RatesFromTwoSamples)
+{
+    write("   8       0 sda 1000 0 8000 0 500 0 4000 0 0 100 0\n"
+          "   7       0 loop0 5 0 10 0 0 0 0 0 0 0 0\n");
+    DiskStatsCollector collector(path);
+    ASSERT_TRUE(collector.open());
+
+    std::vector<Metric> metrics;
+    ASSERT_TRUE(collector.collect(metrics));
+    EXPECT_TRUE(metrics.empty()); // baseline only
+
+    pause();
+    write("   8       0 sda 1100 0 8400 0 520 0 4200 0 0 120 0\n"
+          "   7       0 loop0 9 0 20 0 0 0 0 0 0 0 0\n");
+    ASSERT_TRUE(collector.collect(metrics));
+    auto found = byName(metrics);
+    ASSERT_EQ(found.size(), 5u); // loop0 skipped
+
+    // Every rate is over the same interval, recovered from the read count
+    double elapsed = 100.0 / found["sda.read_iops"].value;
+    ASSERT_GT(elapsed, 0.04);
+    EXPECT_NEAR(found["sda.write_iops"].value, 20.0 / elapsed, 1e-6);
+    EXPECT_NEAR(found["sda.read_kBps"].value, 200.0 / elapsed, 1e-6);
+    EXPECT_NEAR(found["sda.write_kBps"].value, 100.0 / elapsed, 1e-6);
+    EXPECT_NEAR(found["sda.util"].value, std::min(2.0 / elapsed, 100.0), 1e-6);
+    EXPECT_EQ(found["sda.read_iops"].unit, "IOPS");
+    EXPECT_TRUE(found["sda.util"].unit.empty());
+}
+
+TEST_F(ProcCollectorsTest, DiskStats_FilterAndDeviceChange)
+{
+    write("   8       0 sda 1 0 2 0 3 0 4 0 0 5 0\n"
+          "   8      16 sdb 1 0 2 0 3 0 4 0 0 5 0\n");
+    DiskStatsCollector collector(path);
+    collector.setFilter({"sdb"});
+    ASSERT_TRUE(collector.open());
+
+    std::vector<Metric> metrics;
+    ASSERT_TRUE(collector.collect(metrics));
+    pause();
+    ASSERT_TRUE(collector.collect(metrics));
+    ASSERT_EQ(metrics.size(), 5u);
+    EXPECT_EQ(metrics[0].name, "sdb.read_iops");
+    EXPECT_EQ(metrics[0].value, 0.0);
+
+    // A device appearing in between gives no baseline, so no rates
+    write("   8      16 sdb 1 0 2 0 3 0 4 0 0 5 0\n"
+          "   8      32 sdc 1 0 2 0 3 0 4 0 0 5 0\n");
+    collector.setFilter({"sdb", "sdc"});
+    metrics.clear();
+    ASSERT_TRUE(collector.collect(metrics));
+    EXPECT_TRUE(metrics.empty());
+    pause();
+    ASSERT_TRUE(collector.collect(metrics));
+    EXPECT_EQ(metrics.size(), 10u);
+}
+
+TEST_F(ProcCollectorsTest, NetDev_RatesPerInterface)
+{
+    const std::string header = "Inter-|   Receive                            |  Transmit\n"
+                               " face |bytes    packets errs drop fifo frame compressed multicast|bytes ...\n";
+    write(header + "    lo: 1000 10 0 0 0 0 0 0 1000 10 0 0 0 0 0 0\n"
+                   "  eth0: 2048 4 0 0 0 0 0 0 4096 8 0 0 0 0 0 0\n");
+    NetDevCollector collector(path);
+    ASSERT_TRUE(collector.open());
+
+    std::vector<Metric> metrics;
+    ASSERT_TRUE(collector.collect(metrics));
+    EXPECT_TRUE(metrics.empty());
+
+    pause();
+    write(header + "    lo: 1000 10 0 0 0 0 0 0 1000 10 0 0 0 0 0 0\n"
+                   "  eth0: 12288 14 0 0 0 0 0 0 24576 48 0 0 0 0 0 0\n");
+    ASSERT_TRUE(collector.collect(metrics));
+    auto found = byName(metrics);
+    ASSERT_EQ(found.size(), 8u);
+
+    double elapsed = 10.0 / found["eth0.rx_pps"].value;
+    EXPECT_NEAR(found["eth0.tx_pps"].value, 40.0 / elapsed, 1e-6);
+    EXPECT_NEAR(found["eth0.rx_kBps"].value, 10.0 / elapsed, 1e-6);
+    EXPECT_NEAR(found["eth0.tx_kBps"].value, 20.0 / elapsed, 1e-6);
+    EXPECT_EQ(found["lo.rx_kBps"].value, 0.0);
+    EXPECT_EQ(found["eth0.rx_pps"].unit, "pkt/s");
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Snapshot Collectors
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(ProcCollectorsTest, LoadAvg_ParsesAveragesAndTasks)
+{
+    write("1.02 2.23 12.40 3/172 19912\n");
+    LoadAvgCollector collector(path);
+    ASSERT_TRUE(collector.open());
+
+    std::vector<Metric> metrics;
+    ASSERT_TRUE(collector.collect(metrics));
+    auto found = byName(metrics);
+    EXPECT_DOUBLE_EQ(found["load1"].value, 1.02);
+    EXPECT_DOUBLE_EQ(found["load5"].value, 2.23);
+    EXPECT_DOUBLE_EQ(found["load15"].value, 12.40);
+    EXPECT_EQ(found["running"].value, 3.0);
+    EXPECT_EQ(found["total_tasks"].value, 172.0);
+
+    write("garbage\n");
+    EXPECT_FALSE(collector.collect(metrics));
+}
+
+TEST_F(ProcCollectorsTest, Pressure_AveragesAndStallShare)
+{
+    write("some avg10=0.89 avg60=13.52 avg300=29.87 total=1000000\n"
+          "full avg10=0.00 avg60=0.00 avg300=0.00 total=0\n");
+    PressureCollector collector(path);
+    ASSERT_TRUE(collector.open());
+
+    std::vector<Metric> metrics;
+    ASSERT_TRUE(collector.collect(metrics));
+    auto found = byName(metrics);
+    EXPECT_EQ(found.size(), 6u); // stall needs two samples
+    EXPECT_DOUBLE_EQ(found["some.avg60"].value, 13.52);
+
+    pause();
+    // 10 ms of stall in the interval
+    write("some avg10=1.00 avg60=13.52 avg300=29.87 total=1010000\n"
+          "full avg10=0.00 avg60=0.00 avg300=0.00 total=0\n");
+    metrics.clear();
+    ASSERT_TRUE(collector.collect(metrics));
+    found = byName(metrics);
+    ASSERT_EQ(found.size(), 8u);
+    EXPECT_GT(found["some.stall"].value, 0.0);
+    EXPECT_LE(found["some.stall"].value, 20.0); // at most 10 ms over >= 50 ms
+    EXPECT_EQ(found["full.stall"].value, 0.0);
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// ProcSampler
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(ProcCollectorsTest, Sampler_SamplesDueCollectorsOnce)
+{
+    for (bool useIoUring : {false, true})
+    {
+        ProcSampler sampler(useIoUring);
+        for (int i = 0; i < 3; ++i)
+        {
+            auto collector = std::make_unique<LoadAvgCollector>();
+            ASSERT_TRUE(collector->open());
+            sampler.add(std::move(collector), i == 2 ? 60000 : 1);
+        }
+
+        std::map<std::size_t, int> samples;
+        auto onMetrics = [&samples](std::size_t index, const std::vector<Metric> &metrics) {
+            EXPECT_EQ(metrics.size(), 5u);
+            ++samples[index];
+        };
+
+        auto next = sampler.sampleDue(onMetrics);
+        EXPECT_EQ(samples.size(), 3u);
+        EXPECT_LE(next, ProcSampler::Clock::now() + std::chrono::milliseconds(1));
+
+        // Only the 1 ms collectors are due again
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        sampler.sampleDue(onMetrics);
+        EXPECT_EQ(samples[0], 2);
+        EXPECT_EQ(samples[1], 2);
+        EXPECT_EQ(samples[2], 1);
+
+        if (sampler.usesIoUring())
+        {
+            EXPECT_EQ(sampler.getSubmissions(), 2u); // one per pass
+        }
+    }
+}
+
+TEST_F(ProcCollectorsTest, Sampler_FailedBatchedReadStillSampled)
+{
+    // What a kernel without IORING_OP_READ hands back for the batched read
+    LoadAvgCollector collector;
+    ASSERT_TRUE(collector.open());
+    ReadRequest request;
+    ASSERT_TRUE(collector.prepareRead(request));
+
+    std::vector<Metric> metrics;
+    EXPECT_TRUE(collector.completeRead(-EINVAL, metrics));
+    EXPECT_EQ(metrics.size(), 5u);
+}
+
+TEST_F(ProcCollectorsTest, Sampler_GrowsBufferForLargeFiles)
+{
+    // Bigger than the first read buffer: the batched read comes back full
+    std::string content;
+    for (int i = 0; i < 200; ++i)
+    {
+        content += "  dev" + std::to_string(i) + ": 1 2 0 0 0 0 0 0 3 4 0 0 0 0 0 0\n";
+    }
+    write(content);
+
+    ProcSampler sampler(true);
+    auto collector = std::make_unique<NetDevCollector>(path);
+    ASSERT_TRUE(collector->open());
+    sampler.add(std::move(collector), 1);
+
+    size_t count = 0;
+    auto onMetrics = [&count](std::size_t, const std::vector<Metric> &metrics) { count = metrics.size(); };
+    sampler.sampleDue(onMetrics);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    sampler.sampleDue(onMetrics);
+    EXPECT_EQ(count, 800u);
+}
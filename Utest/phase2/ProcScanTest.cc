@@ -0,0 +1,214 @@
+// Utest/phase2/ProcScanTest.cc
+
+#include <gtest/gtest.h>
+#include "SmartDataHub/ProcScan.hpp"
+#include "SmartDataHub/TelemetryParser.hpp"
+#include <string>
+
+using namespace SmartDataHub;
+
+// Runs scanUnsigned over `text`; consumed = bytes it advanced
+static bool scanOne(const std::string &text, uint64_t &value, size_t &consumed)
+{
+    const char *pos = text.data();
+    bool ok = scanUnsigned(pos, text.data() + text.size(), value);
+    consumed = static_cast<size_t>(pos - text.data());
+    return ok;
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// scanUnsigned
+// ══════════════════════════════════════════════════════════════════════
+
+TEST(ProcScanTest, ScanUnsigned_EveryLengthWithAndWithoutPadding)
+{
+    // Lengths 1..20, both at the end of the buffer (from_chars tail) and
+    // followed by enough bytes for the SWAR path
+    std::string digits = "18446744073709551615";
+    for (size_t length = 1; length <= digits.size(); ++length)
+    {
+        std::string number = digits.substr(0, length);
+        uint64_t expected = std::stoull(number);
+        for (const std::string &text : {number, "  " + number + " 0123456789 trailing"})
+        {
+            uint64_t value = 0;
+            size_t consumed = 0;
+            ASSERT_TRUE(scanOne(text, value, consumed)) << text;
+            EXPECT_EQ(value, expected) << text;
+            EXPECT_EQ(consumed, text.find(number) + length) << text;
+        }
+    }
+}
+
+TEST(ProcScanTest, ScanUnsigned_StopsAtNonDigits)
+{
+    const std::string cases[] = {"12:34567890", "7/89012345", "42kB     ", "9\n1234567"};
+    const uint64_t expected[] = {12, 7, 42, 9};
+    for (size_t i = 0; i < 4; ++i)
+    {
+        uint64_t value = 0;
+        size_t consumed = 0;
+        ASSERT_TRUE(scanOne(cases[i], value, consumed)) << cases[i];
+        EXPECT_EQ(value, expected[i]) << cases[i];
+    }
+}
+
+TEST(ProcScanTest, ScanUnsigned_RejectsMissingOrOverflowingNumber)
+{
+    uint64_t value = 5;
+    size_t consumed = 0;
+    EXPECT_FALSE(scanOne("", value, consumed));
+    EXPECT_FALSE(scanOne("   ", value, consumed));
+    EXPECT_FALSE(scanOne("  abcdefghijkl", value, consumed));
+    EXPECT_FALSE(scanOne("-1          ", value, consumed));
+    EXPECT_FALSE(scanOne("18446744073709551616   ", value, consumed));
+    EXPECT_EQ(value, 5u);
+    EXPECT_EQ(consumed, 0u);
+}
+
+TEST(ProcScanTest, ScanFields_CountsConsecutiveFields)
+{
+    uint64_t fields[4] = {};
+    EXPECT_EQ(scanFields(" 1 22\t333 4444 55555", fields, 4), 4u);
+    EXPECT_EQ(fields[3], 4444u);
+    EXPECT_EQ(scanFields(" 1 2 x 4", fields, 4), 2u);
+}
+
+TEST(ProcScanTest, ScanDecimal_ReadsProcfsFixedPoint)
+{
+    const std::string text = "1.02 0.05 12 29.875 3/72";
+    const char *pos = text.data();
+    const char *end = pos + text.size();
+    const double expected[] = {1.02, 0.05, 12.0, 29.875, 3.0};
+    for (double want : expected)
+    {
+        double value = -1.0;
+        ASSERT_TRUE(scanDecimal(pos, end, value));
+        EXPECT_DOUBLE_EQ(value, want);
+    }
+    EXPECT_EQ(*pos, '/');
+
+    double value = 7.0;
+    const char *none = end;
+    EXPECT_FALSE(scanDecimal(none, end, value));
+    EXPECT_EQ(value, 7.0);
+}
+
+TEST(ProcScanTest, ScanLabeledValue_MatchesWholeLabelAtLineStart)
+{
+    const std::string content = "MemTotal:       16000 kB\n"
+                                "MemFree:         1000 kB\n"
+                                "XMemAvailable:      1 kB\n"
+                                "MemAvailable:    8000 kB\n";
+    size_t from = 0;
+    uint64_t value = 0;
+    ASSERT_TRUE(scanLabeledValue(content, from, "MemTotal:", value));
+    EXPECT_EQ(value, 16000u);
+    ASSERT_TRUE(scanLabeledValue(content, from, "MemAvailable:", value));
+    EXPECT_EQ(value, 8000u);
+    EXPECT_FALSE(scanLabeledValue(content, from, "MemTotal:", value)); // already passed
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// TelemetryParser scanners
+// ══════════════════════════════════════════════════════════════════════
+
+TEST(ProcScanTest, ParseCpuLine_ReadsEightCounters)
+{
+    TelemetryParser::CpuStats stats;
+    ASSERT_TRUE(TelemetryParser::parseCpuLine(
+        "cpu  4705 356 584 3699176 23060 0 1277 0 0 0", stats));
+    EXPECT_EQ(stats.user, 4705u);
+    EXPECT_EQ(stats.idle, 3699176u);
+    EXPECT_EQ(stats.softirq, 1277u);
+    EXPECT_EQ(stats.getTotal(), 4705u + 356 + 584 + 3699176 + 23060 + 1277);
+
+    EXPECT_FALSE(TelemetryParser::parseCpuLine("cpu  1 2 3", stats));
+    EXPECT_FALSE(TelemetryParser::parseCpuLine("garbage", stats));
+}
+
+TEST(ProcScanTest, ParseMemInfo_ReadsTotalAndAvailable)
+{
+    uint64_t total = 0;
+    uint64_t available = 0;
+    ASSERT_TRUE(TelemetryParser::parseMemInfo(
+        "MemTotal:       32780028 kB\nMemFree:  100 kB\nMemAvailable:   20123456 kB\n", total, available));
+    EXPECT_EQ(total, 32780028u);
+    EXPECT_EQ(available, 20123456u);
+    EXPECT_FALSE(TelemetryParser::parseMemInfo("MemTotal: 1 kB\n", total, available));
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// /proc/meminfo fields
+// ══════════════════════════════════════════════════════════════════════
+
+TEST(ProcScanTest, LookupMemField_EveryKeyAndNothingElse)
+{
+    for (std::size_t i = 0; i < MemFieldCount; ++i)
+    {
+        MemField field = MemField::Count;
+        ASSERT_TRUE(lookupMemField(MemFieldKeys[i], field)) << MemFieldKeys[i];
+        EXPECT_EQ(static_cast<std::size_t>(field), i);
+    }
+
+    MemField field = MemField::Count;
+    EXPECT_FALSE(lookupMemField("Bounce", field));
+    EXPECT_FALSE(lookupMemField("MemTota", field));
+    EXPECT_FALSE(lookupMemField("", field));
+    EXPECT_EQ(field, MemField::Count);
+}
+
+TEST(ProcScanTest, ParseMemInfoFields_WantedFieldsOnly)
+{
+    const std::string content = "MemTotal:       1000 kB\n"
+                                "MemFree:          100 kB\n"
+                                "Cached:           300 kB\n"
+                                "Active(anon):      50 kB\n"
+                                "Bounce:             0 kB\n"
+                                "SwapTotal:        200 kB\n"
+                                "SwapFree:          50 kB\n"
+                                "HugePages_Total:    4\n"
+                                "HugePages_Free:     1\n"
+                                "Hugepagesize:      50 kB\n";
+    MemInfo info;
+    const MemFieldMask wanted = memFieldBit(MemField::Cached) | memFieldBit(MemField::ActiveAnon) |
+                                memFieldBit(MemField::HugePagesFree) | memFieldBit(MemField::SwapFree) |
+                                MemPercentBases;
+    ASSERT_TRUE(TelemetryParser::parseMemInfoFields(content, wanted, info));
+    EXPECT_EQ(info.found, wanted);
+    EXPECT_FALSE(info.has(MemField::MemFree));
+    EXPECT_EQ(info.get(MemField::Cached), 300u);
+    EXPECT_EQ(info.get(MemField::ActiveAnon), 50u);
+    EXPECT_EQ(info.get(MemField::HugePagesFree), 1u);
+
+    EXPECT_DOUBLE_EQ(info.percent(MemField::Cached), 30.0);
+    EXPECT_DOUBLE_EQ(info.percent(MemField::HugePagesFree), 25.0);
+    EXPECT_DOUBLE_EQ(info.percent(MemField::HugePagesTotal), 20.0); // 4 * 50 kB of 1000 kB
+    EXPECT_DOUBLE_EQ(info.percent(MemField::SwapFree), 25.0);
+
+    // Totals and fields that are no part of one have no percent
+    EXPECT_EQ(memPercentBase(MemField::ActiveAnon), MemField::MemTotal);
+    EXPECT_EQ(memPercentBase(MemField::Zswapped), MemField::SwapTotal);
+    EXPECT_EQ(memPercentBase(MemField::HugePagesRsvd), MemField::HugePagesTotal);
+    for (MemField absolute : {MemField::MemTotal, MemField::SwapTotal, MemField::CommitLimit, MemField::CommittedAS,
+                              MemField::VmallocTotal, MemField::Hugepagesize, MemField::DirectMap2M})
+    {
+        EXPECT_EQ(memPercentBase(absolute), MemField::Count) << MemFieldKeys[static_cast<std::size_t>(absolute)];
+    }
+    EXPECT_DOUBLE_EQ(info.percent(MemField::Hugepagesize), 0.0);
+
+    // A field this kernel does not have
+    EXPECT_FALSE(TelemetryParser::parseMemInfoFields(content, memFieldBit(MemField::Zswap), info));
+    EXPECT_EQ(info.found, 0u);
+}
+
+TEST(ProcScanTest, ParseMemInfoFields_ThisMachine)
+{
+    TelemetryParser parser;
+    MemInfo info;
+    ASSERT_TRUE(parser.getMemInfo(info));
+    ASSERT_TRUE(info.has(MemField::MemTotal));
+    ASSERT_TRUE(info.has(MemField::MemAvailable));
+    EXPECT_GT(info.get(MemField::MemTotal), info.get(MemField::MemAvailable));
+    EXPECT_GT(info.percent(MemField::MemFree), 0.0);
+}
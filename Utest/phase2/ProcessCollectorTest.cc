@@ -0,0 +1,269 @@
+// Utest/phase2/ProcessCollectorTest.cc
+
+#include <gtest/gtest.h>
+#include "SmartDataHub/ProcessCollector.hpp"
+#include "inc/AsyncLogging/ThreadPool.hpp"
+#include <chrono>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <sys/resource.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace SmartDataHub;
+
+class ProcessCollectorTest : public ::testing::Test
+{
+protected:
+    const std::string root = "/tmp/test_process_collector";
+
+    void SetUp() override
+    {
+        std::filesystem::remove_all(root);
+        std::filesystem::create_directories(root + "/self");
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(root);
+    }
+
+    // A /proc/<pid>/stat line with the fields the collector reads
+    void writeStat(int pid, const std::string &comm, uint64_t utime, uint64_t stime, uint64_t startTime = 100,
+                   uint64_t rssPages = 25)
+    {
+        std::filesystem::create_directories(root + "/" + std::to_string(pid));
+        std::ofstream file(root + "/" + std::to_string(pid) + "/stat", std::ios::trunc);
+        file << pid << " (" << comm << ") S 1 " << pid << " " << pid << " 0 -1 4194560 100 0 0 0 " << utime << " "
+             << stime << " 0 0 20 -5 1 0 " << startTime << " 1234567 " << rssPages << " 18446744073709551615\n";
+    }
+
+    void removeProcess(int pid)
+    {
+        std::filesystem::remove_all(root + "/" + std::to_string(pid));
+    }
+
+    static void pause()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+};
+
+// ══════════════════════════════════════════════════════════════════════
+// parseStat
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(ProcessCollectorTest, ParseStat_CommWithSpacesAndParens)
+{
+    const std::string line = "42 (tmux: server) (x)) R 1 42 42 0 -1 4194560 10 0 0 0 700 300 0 0 20 0 1 0 "
+                             "5555 1000 77 18446744073709551615 1 1";
+    ProcessCollector::StatFields fields;
+    ASSERT_TRUE(ProcessCollector::parseStat(line, fields));
+    EXPECT_EQ(fields.comm, "tmux: server) (x)");
+    EXPECT_EQ(fields.ticks, 1000u);
+    EXPECT_EQ(fields.startTime, 5555u);
+    EXPECT_EQ(fields.rssPages, 77u);
+
+    EXPECT_FALSE(ProcessCollector::parseStat("42 (short) R 1 2 3", fields));
+    EXPECT_FALSE(ProcessCollector::parseStat("no parens here", fields));
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Top-N
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(ProcessCollectorTest, Sample_TopNBusiestFirst)
+{
+    for (int pid = 1; pid <= 20; ++pid)
+    {
+        writeStat(pid, "proc" + std::to_string(pid), 1000, 0);
+    }
+    ProcessCollector collector(root);
+    ASSERT_TRUE(collector.open());
+
+    std::vector<ProcessUsage> top;
+    ASSERT_TRUE(collector.sample(3, top));
+    EXPECT_TRUE(top.empty()); // baseline only
+    EXPECT_EQ(collector.getProcessCount(), 20u); // "self" is not a pid
+
+    pause();
+    for (int pid = 1; pid <= 20; ++pid)
+    {
+        writeStat(pid, "proc" + std::to_string(pid), 1000 + pid, static_cast<uint64_t>(pid % 3));
+    }
+    ASSERT_TRUE(collector.sample(3, top));
+    ASSERT_EQ(top.size(), 3u);
+    EXPECT_EQ(top[0].pid, 20); // 22 ticks
+    EXPECT_EQ(top[1].pid, 19); // 20 ticks
+    EXPECT_EQ(top[2].pid, 17); // 19 ticks, ahead of 18 (18)
+    EXPECT_EQ(top[0].name, "proc20");
+    EXPECT_GT(top[0].cpuPercent, top[1].cpuPercent);
+    EXPECT_EQ(top[0].rssKb, 25u * static_cast<uint64_t>(sysconf(_SC_PAGESIZE) / 1024));
+}
+
+TEST_F(ProcessCollectorTest, Sample_ShardedMatchesSingleThread)
+{
+    // Enough pids for several shards
+    const int count = 3000;
+    for (int pid = 1; pid <= count; ++pid)
+    {
+        writeStat(pid, "p", 0, 0);
+    }
+    async_logging::ThreadPool pool(3);
+    ProcessCollector sharded(root);
+    ProcessCollector single(root);
+    ASSERT_TRUE(sharded.open());
+    ASSERT_TRUE(single.open());
+    sharded.setThreadPool(&pool);
+
+    std::vector<ProcessUsage> shardedTop;
+    std::vector<ProcessUsage> singleTop;
+    ASSERT_TRUE(sharded.sample(10, shardedTop));
+    ASSERT_TRUE(single.sample(10, singleTop));
+
+    pause();
+    for (int pid = 1; pid <= count; ++pid)
+    {
+        writeStat(pid, "p", static_cast<uint64_t>((pid * 7919) % count), 0);
+    }
+    ASSERT_TRUE(sharded.sample(10, shardedTop));
+    ASSERT_TRUE(single.sample(10, singleTop));
+    ASSERT_EQ(shardedTop.size(), 10u);
+    ASSERT_EQ(singleTop.size(), 10u);
+    for (size_t i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(shardedTop[i].pid, singleTop[i].pid) << i;
+    }
+    EXPECT_EQ((shardedTop[0].pid * 7919) % count, count - 1);
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Incremental Tracking
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(ProcessCollectorTest, Sample_TracksExitsNewAndReusedPids)
+{
+    writeStat(10, "old", 100, 0, 100);
+    writeStat(11, "exiting", 100, 0, 100);
+    ProcessCollector collector(root, 1); // one kept fd, the rest open per read
+    ASSERT_TRUE(collector.open());
+
+    std::vector<ProcessUsage> top;
+    ASSERT_TRUE(collector.sample(10, top));
+    EXPECT_EQ(collector.getOpenFdCount(), 1u);
+
+    pause();
+    removeProcess(11);
+    writeStat(10, "old", 150, 0, 100);
+    // Started after the previous sample: all of its time counts
+    writeStat(12, "new", 30, 0, ~uint64_t{0} / 2);
+    // Started before it but never seen: no baseline yet
+    writeStat(13, "unseen", 500, 0, 1);
+    ASSERT_TRUE(collector.sample(10, top));
+    EXPECT_EQ(collector.getProcessCount(), 3u);
+    ASSERT_EQ(top.size(), 2u);
+    EXPECT_EQ(top[0].name, "old");
+    EXPECT_EQ(top[1].name, "new");
+
+    // Pid 10 reused by another process: a new baseline, not a delta
+    pause();
+    writeStat(10, "reused", 5, 0, 200);
+    writeStat(12, "new", 40, 0, ~uint64_t{0} / 2);
+    writeStat(13, "unseen", 505, 0, 1);
+    ASSERT_TRUE(collector.sample(10, top));
+    ASSERT_EQ(top.size(), 2u);
+    EXPECT_EQ(top[0].pid, 12);
+    EXPECT_EQ(top[1].pid, 13);
+}
+
+TEST_F(ProcessCollectorTest, Sample_FollowsExecAndRename)
+{
+    // Seen between fork and exec: still the parent's name
+    writeStat(20, "bash", 10, 0);
+    ProcessCollector collector(root);
+    ASSERT_TRUE(collector.open());
+    std::vector<ProcessUsage> top;
+    ASSERT_TRUE(collector.sample(1, top));
+
+    pause();
+    writeStat(20, "cc1plus", 60, 0); // same pid and starttime
+    ASSERT_TRUE(collector.sample(1, top));
+    ASSERT_EQ(top.size(), 1u);
+    EXPECT_EQ(top[0].name, "cc1plus");
+
+    pause();
+    writeStat(20, "worker-3", 70, 0); // prctl(PR_SET_NAME)
+    ASSERT_TRUE(collector.sample(1, top));
+    ASSERT_EQ(top.size(), 1u);
+    EXPECT_EQ(top[0].name, "worker-3");
+}
+
+TEST_F(ProcessCollectorTest, Sample_FdBudgetFollowsRlimitAndSurvivesEmfile)
+{
+    rlimit saved{};
+    ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &saved), 0);
+    if (saved.rlim_cur != RLIM_INFINITY && saved.rlim_cur < 128)
+    {
+        GTEST_SKIP() << "fd limit below 128";
+    }
+    rlimit lowered = saved;
+    lowered.rlim_cur = 128;
+    ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &lowered), 0);
+
+    const int count = 100;
+    for (int pid = 1; pid <= count; ++pid)
+    {
+        writeStat(pid, "p", 0, 0);
+    }
+    ProcessCollector collector(root); // asks for 1024
+    EXPECT_EQ(collector.getMaxOpenFds(), 32u);
+    ASSERT_TRUE(collector.open());
+    std::vector<ProcessUsage> top;
+    ASSERT_TRUE(collector.sample(count, top));
+    EXPECT_EQ(collector.getOpenFdCount(), 32u);
+
+    pause();
+    for (int pid = 1; pid <= count; ++pid)
+    {
+        writeStat(pid, "p", static_cast<uint64_t>(pid), 0);
+    }
+    // The rest of the process takes every remaining fd
+    std::vector<int> hogs;
+    for (int fd = ::open("/dev/null", O_RDONLY); fd >= 0; fd = ::open("/dev/null", O_RDONLY))
+    {
+        hogs.push_back(fd);
+    }
+    ASSERT_FALSE(hogs.empty());
+    bool sampled = collector.sample(count, top);
+    std::size_t kept = collector.getOpenFdCount();
+
+    for (int fd : hogs)
+    {
+        close(fd);
+    }
+    setrlimit(RLIMIT_NOFILE, &saved);
+
+    // Every pid was still read, with kept fds given up for it
+    ASSERT_TRUE(sampled);
+    EXPECT_EQ(top.size(), static_cast<size_t>(count));
+    EXPECT_LT(kept, 32u);
+}
+
+TEST_F(ProcessCollectorTest, Sample_ThisHost)
+{
+    ProcessCollector collector;
+    ASSERT_TRUE(collector.open());
+    std::vector<ProcessUsage> top;
+    ASSERT_TRUE(collector.sample(5, top));
+    pause();
+    ASSERT_TRUE(collector.sample(5, top));
+    EXPECT_GT(collector.getProcessCount(), 0u);
+    EXPECT_LE(top.size(), 5u);
+    for (size_t i = 1; i < top.size(); ++i)
+    {
+        EXPECT_GE(top[i - 1].cpuPercent, top[i].cpuPercent);
+    }
+}
@@ -0,0 +1,283 @@
+// Utest/phase2/ReplayTelemetrySourceImplTest.cc
+
+#include <gtest/gtest.h>
+#include "SmartDataHub/ReplayTelemetrySourceImpl.hpp"
+#include "SmartDataHub/ReplayTrace.hpp"
+#include "SmartDataHub/TelemetryReactor.hpp"
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SmartDataHub;
+using Clock = std::chrono::steady_clock;
+
+class ReplayTelemetrySourceImplTest : public ::testing::Test
+{
+protected:
+    const std::string testFilePath = "/tmp/telemetry_replay_test_" + std::to_string(getpid()) + ".trace";
+
+    void TearDown() override
+    {
+        std::remove(testFilePath.c_str());
+    }
+
+    void writeTrace(const std::string &content)
+    {
+        std::ofstream file(testFilePath, std::ios::binary | std::ios::trunc);
+        file << content;
+    }
+
+    // Reads until the trace ends; returns each sample with its offset from
+    // the first one (ms)
+    static std::vector<std::pair<std::string, double>> playAll(ReplayTelemetrySourceImpl &source)
+    {
+        std::vector<std::pair<std::string, double>> played;
+        Clock::time_point first;
+        std::vector<std::string_view> samples;
+        while (!source.isFinished())
+        {
+            if (!source.waitForData(1000))
+            {
+                break;
+            }
+            samples.clear();
+            source.readRecords(samples);
+            for (auto sample : samples)
+            {
+                Clock::time_point now = Clock::now();
+                if (played.empty())
+                {
+                    first = now;
+                }
+                played.emplace_back(std::string(sample), std::chrono::duration<double, std::milli>(now - first).count());
+            }
+        }
+        return played;
+    }
+};
+
+// ══════════════════════════════════════════════════════════════════════
+// Trace Format Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(ReplayTelemetrySourceImplTest, Trace_TextSkipsCommentsAndMalformedLines)
+{
+    writeTrace("# recorded on host-17\n"
+               "1000 42\r\n"
+               "\n"
+               "garbage\n"
+               "1500\n"
+               "2000\tcpu=17.5\n"
+               "3000 last");
+    auto trace = ReplayTrace::open(testFilePath);
+    ASSERT_NE(trace, nullptr);
+    EXPECT_EQ(trace->getFormat(), ReplayFormat::Text);
+
+    std::vector<std::pair<uint64_t, std::string>> records;
+    size_t offset = trace->begin();
+    uint64_t timeUs = 0;
+    std::string_view sample;
+    while (trace->next(offset, timeUs, sample))
+    {
+        records.emplace_back(timeUs, std::string(sample));
+    }
+
+    ASSERT_EQ(records.size(), 3u);
+    EXPECT_EQ(records[0], std::make_pair(uint64_t{1000}, std::string("42")));
+    EXPECT_EQ(records[1], std::make_pair(uint64_t{2000}, std::string("cpu=17.5")));
+    EXPECT_EQ(records[2], std::make_pair(uint64_t{3000}, std::string("last")));
+}
+
+TEST_F(ReplayTelemetrySourceImplTest, Trace_BinaryStopsAtTruncatedRecord)
+{
+    std::string content(ReplayBinaryMagic, sizeof(ReplayBinaryMagic));
+    ReplayTrace::appendBinaryRecord(content, 10, "a\nb");
+    ReplayTrace::appendBinaryRecord(content, 20, "");
+    ReplayTrace::appendBinaryRecord(content, 30, "cut short");
+    content.resize(content.size() - 3);
+    writeTrace(content);
+
+    auto trace = ReplayTrace::open(testFilePath);
+    ASSERT_NE(trace, nullptr);
+    EXPECT_EQ(trace->getFormat(), ReplayFormat::Binary);
+
+    size_t offset = trace->begin();
+    uint64_t timeUs = 0;
+    std::string_view sample;
+    ASSERT_TRUE(trace->next(offset, timeUs, sample));
+    EXPECT_EQ(timeUs, 10u);
+    EXPECT_EQ(sample, "a\nb"); // binary samples may hold newlines
+    ASSERT_TRUE(trace->next(offset, timeUs, sample));
+    EXPECT_EQ(timeUs, 20u);
+    EXPECT_TRUE(sample.empty());
+    EXPECT_FALSE(trace->next(offset, timeUs, sample));
+}
+
+TEST_F(ReplayTelemetrySourceImplTest, OpenSource_MissingOrEmptyTrace)
+{
+    ReplayTelemetrySourceImpl missing("/nonexistent/replay.trace");
+    EXPECT_FALSE(missing.openSource());
+
+    writeTrace("");
+    ReplayTelemetrySourceImpl empty(testFilePath, 1.0, true);
+    ASSERT_TRUE(empty.openSource());
+    EXPECT_TRUE(empty.isFinished());
+    std::string out;
+    EXPECT_FALSE(empty.readSource(out));
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Playback Timing Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(ReplayTelemetrySourceImplTest, Playback_KeepsRecordedIntervals)
+{
+    // 0, 60, 60, 150 ms after a non-zero first timestamp
+    writeTrace("5000000 10\n5060000 20\n5060000 30\n5150000 40\n");
+    ReplayTelemetrySourceImpl source(testFilePath);
+    ASSERT_TRUE(source.openSource());
+
+    auto played = playAll(source);
+    ASSERT_EQ(played.size(), 4u);
+    EXPECT_EQ(played[0].first, "10");
+    EXPECT_EQ(played[3].first, "40");
+    EXPECT_NEAR(played[1].second, 60.0, 15.0);
+    EXPECT_NEAR(played[2].second, 60.0, 15.0);
+    EXPECT_NEAR(played[3].second, 150.0, 15.0);
+    EXPECT_TRUE(source.isFinished());
+    EXPECT_EQ(source.getReplayedCount(), 4u);
+}
+
+TEST_F(ReplayTelemetrySourceImplTest, Playback_SpeedScalesIntervals)
+{
+    // 400 ms recorded, played 4x
+    writeTrace("0 a\n200000 b\n400000 c\n");
+    ReplayTelemetrySourceImpl source(testFilePath, 4.0);
+    ASSERT_TRUE(source.openSource());
+
+    auto played = playAll(source);
+    ASSERT_EQ(played.size(), 3u);
+    EXPECT_NEAR(played[1].second, 50.0, 15.0);
+    EXPECT_NEAR(played[2].second, 100.0, 15.0);
+}
+
+TEST_F(ReplayTelemetrySourceImplTest, Playback_OutOfOrderTimestampIsPlayedAtOnce)
+{
+    writeTrace("1000000 a\n1050000 b\n1010000 late\n1100000 c\n");
+    ReplayTelemetrySourceImpl source(testFilePath);
+    ASSERT_TRUE(source.openSource());
+
+    auto played = playAll(source);
+    ASSERT_EQ(played.size(), 4u);
+    EXPECT_EQ(played[2].first, "late");
+    EXPECT_NEAR(played[2].second, played[1].second, 10.0);
+    EXPECT_NEAR(played[3].second, 100.0, 15.0);
+}
+
+TEST_F(ReplayTelemetrySourceImplTest, Playback_MaxSpeedYieldsInBursts)
+{
+    std::string content;
+    for (int i = 0; i < 1000; ++i)
+    {
+        content += std::to_string(i * 1000000) + " " + std::to_string(i % 100) + "\n";
+    }
+    writeTrace(content);
+
+    // 1000 s of trace at maximum speed
+    ReplayTelemetrySourceImpl source(testFilePath, 0.0);
+    ASSERT_TRUE(source.openSource());
+
+    std::vector<std::string_view> samples;
+    size_t rounds = 0;
+    auto started = Clock::now();
+    while (!source.isFinished() && source.waitForData(1000))
+    {
+        size_t before = samples.size();
+        source.readRecords(samples);
+        EXPECT_LE(samples.size() - before, ReplayTelemetrySourceImpl::MaxBurst);
+        ++rounds;
+    }
+
+    EXPECT_EQ(samples.size(), 1000u);
+    EXPECT_GE(rounds, 1000u / ReplayTelemetrySourceImpl::MaxBurst);
+    EXPECT_EQ(samples[999], "99");
+    EXPECT_LT(Clock::now() - started, std::chrono::seconds(1));
+}
+
+TEST_F(ReplayTelemetrySourceImplTest, Playback_LoopContinuesWithRecordedPhase)
+{
+    // Two samples 40 ms apart: passes repeat every 80 ms
+    writeTrace("100000 x\n140000 y\n");
+    ReplayTelemetrySourceImpl source(testFilePath, 1.0, true);
+    ASSERT_TRUE(source.openSource());
+
+    std::vector<std::pair<std::string, double>> played;
+    auto started = Clock::now();
+    std::string sample;
+    while (played.size() < 5 && Clock::now() - started < std::chrono::seconds(2))
+    {
+        if (source.waitForData(100) && source.readSource(sample))
+        {
+            played.emplace_back(sample, std::chrono::duration<double, std::milli>(Clock::now() - started).count());
+        }
+    }
+
+    ASSERT_EQ(played.size(), 5u);
+    EXPECT_FALSE(source.isFinished());
+    EXPECT_EQ(played[2].first, "x");
+    EXPECT_EQ(played[3].first, "y");
+    EXPECT_NEAR(played[2].second, 80.0, 15.0);
+    EXPECT_NEAR(played[4].second, 160.0, 15.0);
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Concurrent Stream Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(ReplayTelemetrySourceImplTest, Reactor_ManyStreamsShareOneTrace)
+{
+    std::string content(ReplayBinaryMagic, sizeof(ReplayBinaryMagic));
+    for (int i = 0; i < 20; ++i)
+    {
+        ReplayTrace::appendBinaryRecord(content, static_cast<uint64_t>(i) * 5000, std::to_string(i));
+    }
+    writeTrace(content);
+    auto trace = ReplayTrace::open(testFilePath);
+    ASSERT_NE(trace, nullptr);
+
+    constexpr int Streams = 200;
+    std::atomic<int> received{0};
+    std::atomic<int> lastSeen{0};
+    TelemetryReactor reactor(2);
+    for (int i = 0; i < Streams; ++i)
+    {
+        auto source = std::make_unique<ReplayTelemetrySourceImpl>(trace, 1.0);
+        ASSERT_TRUE(source->openSource());
+        ASSERT_TRUE(reactor.addSource("replay" + std::to_string(i), std::move(source), 1000,
+                                      [&](const std::string &, const std::string &data) {
+                                          if (data == "19")
+                                          {
+                                              ++lastSeen;
+                                          }
+                                          ++received;
+                                      }));
+    }
+    ASSERT_TRUE(reactor.start());
+
+    // 95 ms of trace per stream
+    auto deadline = Clock::now() + std::chrono::seconds(3);
+    while (received < Streams * 20 && Clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    reactor.stop();
+
+    EXPECT_EQ(received.load(), Streams * 20);
+    EXPECT_EQ(lastSeen.load(), Streams);
+    EXPECT_EQ(trace.use_count(), 1 + Streams); // one mapping for all streams
+}
@@ -121,6 +121,165 @@ TEST_F(SafeFileTest, Readline_FileNotOpen_ReturnsFalse)
     EXPECT_FALSE(file.readline(line));
 }
 
+TEST_F(SafeFileTest, Readline_EndOfFile_ReturnsFalse)
+{
+    SafeFile file;
+    file.openFile(testFilePath.c_str(), O_RDONLY);
+
+    std::string line;
+    EXPECT_TRUE(file.readline(line));
+    EXPECT_TRUE(file.readline(line));
+    EXPECT_TRUE(file.readline(line));
+    EXPECT_EQ(line, "Line 3");  // last line has no trailing newline
+    EXPECT_FALSE(file.readline(line));
+}
+
+TEST_F(SafeFileTest, Readline_StringView_ReadsAllLines)
+{
+    SafeFile file;
+    file.openFile(testFilePath.c_str(), O_RDONLY);
+
+    std::string_view line;
+    EXPECT_TRUE(file.readline(line));
+    EXPECT_EQ(line, "Hello, SafeFile!");
+    EXPECT_TRUE(file.readline(line));
+    EXPECT_EQ(line, "Line 2");
+    EXPECT_TRUE(file.readline(line));
+    EXPECT_EQ(line, "Line 3");
+    EXPECT_FALSE(file.readline(line));
+}
+
+TEST_F(SafeFileTest, Readline_EmptyLines_Preserved)
+{
+    const std::string path = "/tmp/safe_file_empty_lines.txt";
+    std::ofstream(path) << "a\n\nb\n";
+
+    SafeFile file;
+    file.openFile(path.c_str(), O_RDONLY);
+
+    std::string_view line;
+    EXPECT_TRUE(file.readline(line));
+    EXPECT_EQ(line, "a");
+    EXPECT_TRUE(file.readline(line));
+    EXPECT_EQ(line, "");
+    EXPECT_TRUE(file.readline(line));
+    EXPECT_EQ(line, "b");
+    EXPECT_FALSE(file.readline(line));
+
+    std::remove(path.c_str());
+}
+
+TEST_F(SafeFileTest, Readline_LinesLongerThanOneRead)
+{
+    const std::string path = "/tmp/safe_file_long_lines.txt";
+    const std::string longLine(10000, 'x');
+    std::ofstream(path) << longLine << "\n" << "short\n" << longLine;
+
+    SafeFile file;
+    file.openFile(path.c_str(), O_RDONLY);
+
+    std::string line;
+    EXPECT_TRUE(file.readline(line));
+    EXPECT_EQ(line, longLine);
+    EXPECT_TRUE(file.readline(line));
+    EXPECT_EQ(line, "short");
+    EXPECT_TRUE(file.readline(line));
+    EXPECT_EQ(line, longLine);
+    EXPECT_FALSE(file.readline(line));
+
+    std::remove(path.c_str());
+}
+
+TEST_F(SafeFileTest, SeekToBeginning_DiscardsBufferedData)
+{
+    SafeFile file;
+    file.openFile(testFilePath.c_str(), O_RDONLY);
+
+    std::string line;
+    EXPECT_TRUE(file.readline(line));
+    EXPECT_TRUE(file.readline(line));
+
+    file.seekToBeginning();
+    EXPECT_TRUE(file.readline(line));
+    EXPECT_EQ(line, "Hello, SafeFile!");
+}
+
+TEST_F(SafeFileTest, MoveConstructor_KeepsReadPosition)
+{
+    SafeFile file1;
+    file1.openFile(testFilePath.c_str(), O_RDONLY);
+
+    std::string line;
+    EXPECT_TRUE(file1.readline(line));
+
+    SafeFile file2(std::move(file1));
+    EXPECT_TRUE(file2.readline(line));
+    EXPECT_EQ(line, "Line 2");
+}
+
+TEST_F(SafeFileTest, ReadSnapshot_ReturnsWholeFile)
+{
+    SafeFile file;
+    file.openFile(testFilePath.c_str(), O_RDONLY);
+
+    std::string_view content;
+    EXPECT_TRUE(file.readSnapshot(content));
+    EXPECT_EQ(content, testContent);
+
+    // Same fd, same result
+    EXPECT_TRUE(file.readSnapshot(content));
+    EXPECT_EQ(content, testContent);
+}
+
+TEST_F(SafeFileTest, ReadSnapshot_GrowsForLargeFile)
+{
+    const std::string path = "/tmp/safe_file_snapshot_large.txt";
+    const std::string payload(20000, 'q');
+    std::ofstream(path) << payload;
+
+    SafeFile file;
+    file.openFile(path.c_str(), O_RDONLY);
+
+    std::string_view content;
+    EXPECT_TRUE(file.readSnapshot(content));
+    EXPECT_EQ(content.size(), payload.size());
+
+    std::remove(path.c_str());
+}
+
+TEST_F(SafeFileTest, ReadSnapshot_LeavesReadlinePosition)
+{
+    SafeFile file;
+    file.openFile(testFilePath.c_str(), O_RDONLY);
+
+    std::string line;
+    EXPECT_TRUE(file.readline(line));
+
+    std::string_view content;
+    EXPECT_TRUE(file.readSnapshot(content));
+
+    EXPECT_TRUE(file.readline(line));
+    EXPECT_EQ(line, "Line 2");
+}
+
+TEST_F(SafeFileTest, ReadSnapshot_ProcMeminfo)
+{
+    SafeFile file;
+    file.openFile("/proc/meminfo", O_RDONLY);
+
+    std::string_view content;
+    EXPECT_TRUE(file.readSnapshot(content));
+    EXPECT_EQ(content.substr(0, 9), "MemTotal:");
+    EXPECT_EQ(content.back(), '\n');
+}
+
+TEST_F(SafeFileTest, ReadSnapshot_FileNotOpen_ReturnsFalse)
+{
+    SafeFile file;
+    std::string_view content;
+    EXPECT_FALSE(file.readSnapshot(content));
+}
+
 // ══════════════════════════════════════════════════════════════════════
 // Write Tests
 // ══════════════════════════════════════════════════════════════════════
@@ -145,6 +304,104 @@ TEST_F(SafeFileTest, Writeline_WritesToFile)
     std::remove(writeTestPath.c_str());
 }
 
+TEST_F(SafeFileTest, WriteAll_LargeBuffer_WritesEverything)
+{
+    const std::string writeTestPath = "/tmp/safe_file_write_large.txt";
+    const std::string payload(1 << 20, 'z');
+
+    {
+        SafeFile file;
+        file.openFile(writeTestPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC);
+        EXPECT_TRUE(file.writeAll(payload));
+    }
+
+    std::ifstream ifs(writeTestPath, std::ios::binary);
+    std::string readContent((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(readContent, payload);
+
+    std::remove(writeTestPath.c_str());
+}
+
+TEST_F(SafeFileTest, Writev_JoinsBuffersInOrder)
+{
+    const std::string writeTestPath = "/tmp/safe_file_writev.txt";
+
+    {
+        SafeFile file;
+        file.openFile(writeTestPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC);
+        EXPECT_TRUE(file.writev({"[hdr] ", "", "body", "\n"}));
+        EXPECT_TRUE(file.appendLine("second"));
+    }
+
+    std::ifstream ifs(writeTestPath);
+    std::string line1, line2;
+    std::getline(ifs, line1);
+    std::getline(ifs, line2);
+    EXPECT_EQ(line1, "[hdr] body");
+    EXPECT_EQ(line2, "second");
+
+    std::remove(writeTestPath.c_str());
+}
+
+TEST_F(SafeFileTest, Writev_ManyBuffers)
+{
+    const std::string writeTestPath = "/tmp/safe_file_writev_many.txt";
+
+    {
+        SafeFile file;
+        file.openFile(writeTestPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC);
+        EXPECT_TRUE(file.writev({"a", "b", "c", "d", "e", "f", "g", "h", "i", "j", "\n"}));
+    }
+
+    std::ifstream ifs(writeTestPath);
+    std::string line;
+    std::getline(ifs, line);
+    EXPECT_EQ(line, "abcdefghij");
+
+    std::remove(writeTestPath.c_str());
+}
+
+TEST_F(SafeFileTest, Write_FileNotOpen_ReturnsFalse)
+{
+    SafeFile file;
+    EXPECT_FALSE(file.writeAll("data"));
+    EXPECT_FALSE(file.appendLine("data"));
+    EXPECT_FALSE(file.setAtomicAppend(true));
+}
+
+TEST_F(SafeFileTest, AtomicAppend_SharedFileKeepsWholeLines)
+{
+    const std::string writeTestPath = "/tmp/safe_file_atomic_append.txt";
+    std::remove(writeTestPath.c_str());
+
+    SafeFile writer1;
+    SafeFile writer2;
+    writer1.openFile(writeTestPath.c_str(), O_WRONLY | O_CREAT);
+    writer2.openFile(writeTestPath.c_str(), O_WRONLY | O_CREAT);
+    EXPECT_TRUE(writer1.setAtomicAppend(true));
+    EXPECT_TRUE(writer2.setAtomicAppend(true));
+    EXPECT_TRUE(writer1.isAtomicAppend());
+
+    // Without O_APPEND the second writer would overwrite the first
+    EXPECT_TRUE(writer1.appendLine("from writer 1"));
+    EXPECT_TRUE(writer2.appendLine("from writer 2"));
+    EXPECT_TRUE(writer1.appendLine("again writer 1"));
+
+    std::ifstream ifs(writeTestPath);
+    std::string line1, line2, line3;
+    std::getline(ifs, line1);
+    std::getline(ifs, line2);
+    std::getline(ifs, line3);
+    EXPECT_EQ(line1, "from writer 1");
+    EXPECT_EQ(line2, "from writer 2");
+    EXPECT_EQ(line3, "again writer 1");
+
+    EXPECT_TRUE(writer1.setAtomicAppend(false));
+    EXPECT_FALSE(writer1.isAtomicAppend());
+
+    std::remove(writeTestPath.c_str());
+}
+
 // ══════════════════════════════════════════════════════════════════════
 // Move Semantics Tests
 // ══════════════════════════════════════════════════════════════════════
@@ -5,8 +5,10 @@
 #include <thread>
 #include <chrono>
 #include <sys/socket.h>
+#include <sys/stat.h>
 #include <sys/un.h>
 #include <unistd.h>
+#include <cerrno>
 #include <cstdio>
 
 using namespace SmartDataHub;
@@ -129,6 +131,8 @@ TEST_F(SafeSocketTest, ConnectSocket_WithServer_ReturnsTrue)
     EXPECT_TRUE(socket.createSocket());
     EXPECT_TRUE(socket.connectSocket(testSocketPath));
 
+    // The server is blocked in recv(); closing gives it EOF so it can exit
+    socket.closeSocket();
     stopTestServer();
 }
 
@@ -248,4 +252,193 @@ TEST_F(SafeSocketTest, Destructor_ClosesSocket)
         EXPECT_TRUE(socket.isConnected());
     }
     // Socket should be closed when going out of scope - no crash
-}
\ No newline at end of file
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Message-Oriented Socket Tests
+// ══════════════════════════════════════════════════════════════════════
+
+static void sendDatagram(const std::string& path, const std::string& msg)
+{
+    int fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+    sendto(fd, msg.data(), msg.size(), 0, (sockaddr*)&addr, sizeof(addr));
+    close(fd);
+}
+
+TEST_F(SafeSocketTest, CreateSocket_MessageKinds)
+{
+    SafeSocket seqpacket;
+    EXPECT_TRUE(seqpacket.createSocket(SocketKind::SeqPacket));
+    EXPECT_EQ(seqpacket.getKind(), SocketKind::SeqPacket);
+
+    int type = 0;
+    socklen_t len = sizeof(type);
+    getsockopt(seqpacket.getFd(), SOL_SOCKET, SO_TYPE, &type, &len);
+    EXPECT_EQ(type, SOCK_SEQPACKET);
+
+    SafeSocket datagram;
+    EXPECT_TRUE(datagram.createSocket(SocketKind::Datagram));
+    getsockopt(datagram.getFd(), SOL_SOCKET, SO_TYPE, &type, &len);
+    EXPECT_EQ(type, SOCK_DGRAM);
+}
+
+TEST_F(SafeSocketTest, ReceiveBatch_ManyDatagramsInOneCall)
+{
+    SafeSocket socket;
+    ASSERT_TRUE(socket.createSocket(SocketKind::Datagram));
+    ASSERT_TRUE(socket.bindSocket(testSocketPath));
+
+    for (int i = 0; i < 10; ++i)
+    {
+        sendDatagram(testSocketPath, "sample" + std::to_string(i));
+    }
+
+    MessageBatch batch(16, 256);
+    EXPECT_EQ(socket.receiveBatch(batch), 10);
+    ASSERT_EQ(batch.size(), 10u);
+    for (size_t i = 0; i < batch.size(); ++i)
+    {
+        EXPECT_EQ(batch[i], "sample" + std::to_string(i));
+        EXPECT_FALSE(batch.truncated(i));
+    }
+
+    // Queue is empty now: EAGAIN, batch cleared
+    EXPECT_LT(socket.receiveBatch(batch), 0);
+    EXPECT_TRUE(batch.empty());
+}
+
+TEST_F(SafeSocketTest, ReceiveBatch_CapacityLimitsOneCall)
+{
+    SafeSocket socket;
+    ASSERT_TRUE(socket.createSocket(SocketKind::Datagram));
+    ASSERT_TRUE(socket.bindSocket(testSocketPath));
+
+    for (int i = 0; i < 5; ++i)
+    {
+        sendDatagram(testSocketPath, std::to_string(i));
+    }
+
+    MessageBatch batch(3, 64);
+    EXPECT_EQ(socket.receiveBatch(batch), 3);
+    EXPECT_EQ(batch[2], "2");
+    EXPECT_EQ(socket.receiveBatch(batch), 2);
+    EXPECT_EQ(batch[0], "3");
+    EXPECT_EQ(batch[1], "4");
+}
+
+TEST_F(SafeSocketTest, ReceiveBatch_OversizedMessageIsTruncated)
+{
+    SafeSocket socket;
+    ASSERT_TRUE(socket.createSocket(SocketKind::Datagram));
+    ASSERT_TRUE(socket.bindSocket(testSocketPath));
+
+    sendDatagram(testSocketPath, "0123456789");
+
+    MessageBatch batch(4, 4);
+    ASSERT_EQ(socket.receiveBatch(batch), 1);
+    EXPECT_EQ(batch[0], "0123");
+    EXPECT_TRUE(batch.truncated(0));
+}
+
+TEST_F(SafeSocketTest, MessageBatch_MoveKeepsMessages)
+{
+    SafeSocket socket;
+    ASSERT_TRUE(socket.createSocket(SocketKind::Datagram));
+    ASSERT_TRUE(socket.bindSocket(testSocketPath));
+    sendDatagram(testSocketPath, "moved");
+
+    MessageBatch batch(4, 64);
+    ASSERT_EQ(socket.receiveBatch(batch), 1);
+
+    MessageBatch copy(batch);
+    MessageBatch moved(std::move(batch));
+    EXPECT_EQ(moved[0], "moved");
+    EXPECT_EQ(copy[0], "moved");
+
+    // The copy receives into its own slots
+    sendDatagram(testSocketPath, "again");
+    ASSERT_EQ(socket.receiveBatch(copy), 1);
+    EXPECT_EQ(copy[0], "again");
+    EXPECT_EQ(moved[0], "moved");
+}
+
+TEST_F(SafeSocketTest, CloseSocket_UnlinksBoundPath)
+{
+    SafeSocket socket;
+    ASSERT_TRUE(socket.createSocket(SocketKind::Datagram));
+    ASSERT_TRUE(socket.bindSocket(testSocketPath));
+    EXPECT_EQ(access(testSocketPath.c_str(), F_OK), 0);
+
+    socket.closeSocket();
+    EXPECT_NE(access(testSocketPath.c_str(), F_OK), 0);
+}
+
+TEST_F(SafeSocketTest, BindSocket_ReplacesStaleSocketFile)
+{
+    // A socket file left by a process that is gone: nobody accepts on it
+    int stale = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, testSocketPath.c_str(), sizeof(addr.sun_path) - 1);
+    ASSERT_EQ(bind(stale, (sockaddr*)&addr, sizeof(addr)), 0);
+    close(stale);
+
+    SafeSocket socket;
+    ASSERT_TRUE(socket.createSocket(SocketKind::Stream));
+    EXPECT_TRUE(socket.listenSocket(testSocketPath));
+}
+
+TEST_F(SafeSocketTest, BindSocket_LiveSocketOfAnotherInstanceKept)
+{
+    SafeSocket first;
+    ASSERT_TRUE(first.createSocket(SocketKind::Stream));
+    ASSERT_TRUE(first.listenSocket(testSocketPath));
+
+    SafeSocket second;
+    ASSERT_TRUE(second.createSocket(SocketKind::Stream));
+    EXPECT_FALSE(second.listenSocket(testSocketPath));
+    EXPECT_EQ(errno, EADDRINUSE);
+    second.closeSocket();
+
+    // Still bound to the first one
+    SafeSocket client;
+    ASSERT_TRUE(client.createSocket(SocketKind::Stream));
+    EXPECT_TRUE(client.connectSocket(testSocketPath));
+}
+
+TEST_F(SafeSocketTest, BindSocket_RegularFileLeftAlone)
+{
+    FILE *file = std::fopen(testSocketPath.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    std::fputs("keep me", file);
+    std::fclose(file);
+
+    SafeSocket socket;
+    ASSERT_TRUE(socket.createSocket(SocketKind::Datagram));
+    EXPECT_FALSE(socket.bindSocket(testSocketPath));
+    EXPECT_EQ(errno, EADDRINUSE);
+
+    struct stat info;
+    ASSERT_EQ(stat(testSocketPath.c_str(), &info), 0);
+    EXPECT_TRUE(S_ISREG(info.st_mode));
+    EXPECT_EQ(info.st_size, 7);
+}
+
+TEST_F(SafeSocketTest, PathTooLong_Rejected)
+{
+    const std::string longPath = "/tmp/" + std::string(sizeof(sockaddr_un::sun_path), 'x');
+
+    SafeSocket socket;
+    ASSERT_TRUE(socket.createSocket(SocketKind::Datagram));
+    EXPECT_FALSE(socket.bindSocket(longPath));
+    EXPECT_EQ(errno, ENAMETOOLONG);
+
+    ASSERT_TRUE(socket.createSocket(SocketKind::Stream));
+    EXPECT_FALSE(socket.connectSocket(longPath));
+    EXPECT_EQ(errno, ENAMETOOLONG);
+}
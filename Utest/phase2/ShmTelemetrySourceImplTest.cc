@@ -0,0 +1,358 @@
+// Utest/phase2/ShmTelemetrySourceImplTest.cc
+
+#include <gtest/gtest.h>
+#include "SmartDataHub/ShmTelemetrySourceImpl.hpp"
+#include "SmartDataHub/ShmRingWriter.hpp"
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SmartDataHub;
+
+class ShmTelemetrySourceImplTest : public ::testing::Test
+{
+protected:
+    const std::string testRingName = "/telemetry_shm_test_" + std::to_string(getpid());
+
+    void TearDown() override
+    {
+        shm_unlink(testRingName.c_str());
+    }
+};
+
+// ══════════════════════════════════════════════════════════════════════
+// Lifecycle Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(ShmTelemetrySourceImplTest, Layout_HeaderIsFourCacheLines)
+{
+    EXPECT_EQ(offsetof(ShmRingHeader, head), 64u);
+    EXPECT_EQ(offsetof(ShmRingHeader, tail), 128u);
+    EXPECT_EQ(offsetof(ShmRingHeader, readerWaiting), 192u);
+    EXPECT_EQ(shmRingRecordSize(0), 8u);
+    EXPECT_EQ(shmRingRecordSize(4), 8u);
+    EXPECT_EQ(shmRingRecordSize(5), 16u);
+}
+
+TEST_F(ShmTelemetrySourceImplTest, OpenSource_CapacityRoundedToPowerOfTwo)
+{
+    ShmTelemetrySourceImpl source(testRingName, 5000);
+    EXPECT_EQ(source.getCapacity(), 8192u);
+    EXPECT_FALSE(source.isOpen());
+    ASSERT_TRUE(source.openSource());
+    EXPECT_TRUE(source.isOpen());
+}
+
+TEST_F(ShmTelemetrySourceImplTest, Attach_WithoutRing_Fails)
+{
+    ShmRingWriter writer;
+    EXPECT_FALSE(writer.attach(testRingName));
+    EXPECT_FALSE(writer.tryWrite("42"));
+}
+
+TEST_F(ShmTelemetrySourceImplTest, Destructor_UnlinksRing)
+{
+    {
+        ShmTelemetrySourceImpl source(testRingName);
+        ASSERT_TRUE(source.openSource());
+    }
+    ShmRingWriter writer;
+    EXPECT_FALSE(writer.attach(testRingName));
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Read/Write Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(ShmTelemetrySourceImplTest, ReadSource_ReturnsRecordsInOrder)
+{
+    ShmTelemetrySourceImpl source(testRingName);
+    ASSERT_TRUE(source.openSource());
+    ShmRingWriter writer;
+    ASSERT_TRUE(writer.attach(testRingName));
+
+    std::string out;
+    EXPECT_FALSE(source.readSource(out));
+    EXPECT_FALSE(source.hasPendingData());
+
+    ASSERT_TRUE(writer.tryWrite("42"));
+    ASSERT_TRUE(writer.tryWrite(""));
+    ASSERT_TRUE(writer.tryWrite("cpu 1 2 3"));
+    EXPECT_TRUE(source.hasPendingData());
+
+    ASSERT_TRUE(source.readSource(out));
+    EXPECT_EQ(out, "42");
+    ASSERT_TRUE(source.readSource(out));
+    EXPECT_EQ(out, "");
+    ASSERT_TRUE(source.readSource(out));
+    EXPECT_EQ(out, "cpu 1 2 3");
+    EXPECT_FALSE(source.readSource(out));
+}
+
+TEST_F(ShmTelemetrySourceImplTest, ReadRecords_ViewsPointIntoRing)
+{
+    ShmTelemetrySourceImpl source(testRingName, 4096);
+    ASSERT_TRUE(source.openSource());
+    ShmRingWriter writer;
+    ASSERT_TRUE(writer.attach(testRingName));
+
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_TRUE(writer.tryWrite(std::to_string(i)));
+    }
+
+    std::vector<std::string_view> records;
+    ASSERT_EQ(source.readRecords(records), 10u);
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(records[i], std::to_string(i));
+    }
+    EXPECT_EQ(source.readRecords(records), 0u);
+}
+
+TEST_F(ShmTelemetrySourceImplTest, Full_WriterDropsUntilReaderReleases)
+{
+    ShmTelemetrySourceImpl source(testRingName, 4096);
+    ASSERT_TRUE(source.openSource());
+    ShmRingWriter writer;
+    ASSERT_TRUE(writer.attach(testRingName));
+
+    const std::string record(60, 'x'); // 64 bytes in the ring
+    for (int i = 0; i < 64; ++i)
+    {
+        ASSERT_TRUE(writer.tryWrite(record));
+    }
+    EXPECT_FALSE(writer.tryWrite(record));
+    EXPECT_EQ(writer.getDropped(), 1u);
+
+    // Views are still in use: their space is not handed back yet
+    std::vector<std::string_view> records;
+    ASSERT_EQ(source.readRecords(records), 64u);
+    EXPECT_FALSE(writer.tryWrite(record));
+
+    source.releaseRecords();
+    EXPECT_TRUE(writer.tryWrite(record));
+    EXPECT_EQ(writer.getDropped(), 2u);
+}
+
+TEST_F(ShmTelemetrySourceImplTest, OversizedRecord_Dropped)
+{
+    ShmTelemetrySourceImpl source(testRingName, 4096);
+    ASSERT_TRUE(source.openSource());
+    ShmRingWriter writer;
+    ASSERT_TRUE(writer.attach(testRingName));
+
+    EXPECT_FALSE(writer.tryWrite(std::string(2000, 'x')));
+    EXPECT_EQ(writer.getDropped(), 1u);
+    EXPECT_TRUE(writer.tryWrite(std::string(shmRingMaxRecord(4096), 'x')));
+}
+
+TEST_F(ShmTelemetrySourceImplTest, WrapAround_RecordsStayContiguous)
+{
+    ShmTelemetrySourceImpl source(testRingName, 4096);
+    ASSERT_TRUE(source.openSource());
+    ShmRingWriter writer;
+    ASSERT_TRUE(writer.attach(testRingName));
+
+    // Odd sizes so records end at varying offsets before each wrap
+    std::string out;
+    for (int i = 0; i < 2000; ++i)
+    {
+        std::string record = std::to_string(i) + std::string(i % 300, 'a' + i % 26);
+        ASSERT_TRUE(writer.tryWrite(record)) << i;
+        ASSERT_TRUE(source.readSource(out));
+        ASSERT_EQ(out, record);
+    }
+    EXPECT_EQ(writer.getDropped(), 0u);
+}
+
+TEST_F(ShmTelemetrySourceImplTest, CorruptLength_ClosesRingAfterEarlierViews)
+{
+    ShmTelemetrySourceImpl source(testRingName, 4096);
+    ASSERT_TRUE(source.openSource());
+    ShmRingWriter writer;
+    ASSERT_TRUE(writer.attach(testRingName));
+    ASSERT_TRUE(writer.tryWrite("first"));
+    ASSERT_TRUE(writer.tryWrite("second"));
+
+    // A misbehaving writer: the second record claims more than the ring
+    int fd = shm_open(testRingName.c_str(), O_RDWR, 0);
+    ASSERT_GE(fd, 0);
+    void *map = mmap(nullptr, ShmRingDataOffset + 4096, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    ASSERT_NE(map, MAP_FAILED);
+    uint32_t length = 4096 - static_cast<uint32_t>(shmRingRecordSize(5));
+    std::memcpy(static_cast<char *>(map) + ShmRingDataOffset + shmRingRecordSize(5), &length, sizeof(length));
+
+    std::vector<std::string_view> records;
+    ASSERT_EQ(source.readRecords(records), 1u);
+    EXPECT_EQ(records[0], "first"); // still mapped
+    EXPECT_TRUE(source.isCorrupt());
+    EXPECT_FALSE(source.hasPendingData());
+
+    EXPECT_EQ(source.readRecords(records), 0u);
+    EXPECT_FALSE(source.isOpen());
+    EXPECT_FALSE(source.waitForData(0));
+    munmap(map, ShmRingDataOffset + 4096);
+}
+
+TEST_F(ShmTelemetrySourceImplTest, CorruptHead_ClosesRing)
+{
+    ShmTelemetrySourceImpl source(testRingName, 4096);
+    ASSERT_TRUE(source.openSource());
+    ShmRingWriter writer;
+    ASSERT_TRUE(writer.attach(testRingName));
+
+    int fd = shm_open(testRingName.c_str(), O_RDWR, 0);
+    ASSERT_GE(fd, 0);
+    void *map = mmap(nullptr, ShmRingDataOffset + 4096, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    ASSERT_NE(map, MAP_FAILED);
+    static_cast<ShmRingHeader *>(map)->head.store(3 * 4096);
+
+    std::string out;
+    EXPECT_FALSE(source.readSource(out));
+    EXPECT_TRUE(source.isCorrupt());
+    EXPECT_FALSE(source.readSource(out));
+    EXPECT_FALSE(source.isOpen());
+    munmap(map, ShmRingDataOffset + 4096);
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Wakeup Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(ShmTelemetrySourceImplTest, NoSleepingReader_NoWakeups)
+{
+    ShmTelemetrySourceImpl source(testRingName);
+    ASSERT_TRUE(source.openSource());
+    ShmRingWriter writer;
+    ASSERT_TRUE(writer.attach(testRingName));
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        ASSERT_TRUE(writer.tryWrite("50"));
+    }
+    EXPECT_EQ(writer.getWakeups(), 0u);
+}
+
+TEST_F(ShmTelemetrySourceImplTest, WaitForData_TimesOutWhenEmpty)
+{
+    ShmTelemetrySourceImpl source(testRingName);
+    ASSERT_TRUE(source.openSource());
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(source.waitForData(50));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(40));
+}
+
+TEST_F(ShmTelemetrySourceImplTest, WaitForData_WokenByWriter)
+{
+    ShmTelemetrySourceImpl source(testRingName);
+    ASSERT_TRUE(source.openSource());
+    ShmRingWriter writer;
+    ASSERT_TRUE(writer.attach(testRingName));
+
+    std::thread producer([&writer] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        writer.tryWrite("75");
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(source.waitForData(5000));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+    producer.join();
+
+    std::string out;
+    ASSERT_TRUE(source.readSource(out));
+    EXPECT_EQ(out, "75");
+    EXPECT_EQ(writer.getWakeups(), 1u);
+}
+
+TEST_F(ShmTelemetrySourceImplTest, HighRate_EveryRecordInOrder)
+{
+    constexpr int RecordCount = 1000000;
+
+    ShmTelemetrySourceImpl source(testRingName, 64 * 1024);
+    ASSERT_TRUE(source.openSource());
+    ShmRingWriter writer;
+    ASSERT_TRUE(writer.attach(testRingName));
+
+    // The producer retries instead of dropping so every record arrives
+    std::thread producer([&writer] {
+        for (int i = 0; i < RecordCount; ++i)
+        {
+            std::string record = std::to_string(i);
+            while (!writer.tryWrite(record))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    std::vector<std::string_view> records;
+    while (expected < RecordCount)
+    {
+        if (!source.waitForData(1000))
+        {
+            break;
+        }
+        records.clear();
+        source.readRecords(records);
+        for (std::string_view record : records)
+        {
+            ASSERT_EQ(record, std::to_string(expected));
+            ++expected;
+        }
+    }
+    producer.join();
+
+    EXPECT_EQ(expected, RecordCount);
+    // Wakeups only happen when the reader ran dry, not once per record
+    EXPECT_LT(writer.getWakeups(), static_cast<uint64_t>(RecordCount));
+}
+
+TEST_F(ShmTelemetrySourceImplTest, SeparateProcess_WriterAttachesByName)
+{
+    ShmTelemetrySourceImpl source(testRingName);
+    ASSERT_TRUE(source.openSource());
+
+    pid_t child = fork();
+    ASSERT_GE(child, 0);
+    if (child == 0)
+    {
+        ShmRingWriter writer;
+        if (!writer.attach(testRingName))
+        {
+            _exit(1);
+        }
+        for (int i = 0; i < 100; ++i)
+        {
+            writer.tryWrite("sample" + std::to_string(i));
+        }
+        _exit(0);
+    }
+
+    int received = 0;
+    std::string out;
+    while (received < 100 && source.waitForData(2000))
+    {
+        while (source.readSource(out))
+        {
+            EXPECT_EQ(out, "sample" + std::to_string(received));
+            ++received;
+        }
+    }
+
+    int status = 0;
+    waitpid(child, &status, 0);
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    EXPECT_EQ(received, 100);
+}
@@ -10,6 +10,10 @@
 #include <unistd.h>
 #include <cstring>
 #include <cstdio>
+#include <functional>
+#include <poll.h>
+#include <random>
+#include <vector>
 
 using namespace SmartDataHub;
 
@@ -67,7 +71,8 @@ protected:
             int clientFd = accept(serverFd, nullptr, nullptr);
             if (clientFd >= 0)
             {
-                send(clientFd, responseData.c_str(), responseData.size(), 0);
+                // MSG_NOSIGNAL: the client may already be gone
+                send(clientFd, responseData.c_str(), responseData.size(), MSG_NOSIGNAL);
                 std::this_thread::sleep_for(std::chrono::milliseconds(100));
                 close(clientFd);
             }
@@ -82,6 +87,84 @@ protected:
         }
         std::this_thread::sleep_for(std::chrono::milliseconds(50));
     }
+
+    // The socket is non-blocking: wait for the server's reply before reading
+    static void waitReadable(int fd)
+    {
+        pollfd pfd{fd, POLLIN, 0};
+        poll(&pfd, 1, 2000);
+    }
+
+    // Stand-in server: runs `session` on the first accepted connection
+    void startStreamServer(std::function<void(int clientFd)> session, int type = SOCK_STREAM)
+    {
+        serverThread = std::thread([this, session, type]() {
+            int serverFd = socket(AF_UNIX, type, 0);
+            if (serverFd < 0) return;
+
+            sockaddr_un addr;
+            memset(&addr, 0, sizeof(addr));
+            addr.sun_family = AF_UNIX;
+            strncpy(addr.sun_path, testSocketPath.c_str(), sizeof(addr.sun_path) - 1);
+
+            if (bind(serverFd, (sockaddr*)&addr, sizeof(addr)) < 0)
+            {
+                close(serverFd);
+                return;
+            }
+            listen(serverFd, 1);
+            serverReady = true;
+
+            int clientFd = accept(serverFd, nullptr, nullptr);
+            if (clientFd >= 0)
+            {
+                session(clientFd);
+                close(clientFd);
+            }
+            close(serverFd);
+        });
+
+        while (!serverReady)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    // Writes all of `wire` in randomly sized chunks so frames straddle
+    // and coalesce across recv() calls
+    static void sendChunked(int fd, const std::vector<char>& wire)
+    {
+        std::mt19937 rng(1234);
+        std::uniform_int_distribution<size_t> chunk(1, 3000);
+        size_t sent = 0;
+        while (sent < wire.size())
+        {
+            size_t len = std::min(chunk(rng), wire.size() - sent);
+            ssize_t n = send(fd, wire.data() + sent, len, MSG_NOSIGNAL);
+            if (n <= 0) return;
+            sent += static_cast<size_t>(n);
+        }
+    }
+
+    // Collects frames until `expected` arrived or the peer closed
+    static std::vector<std::string> collectFrames(SocketTelemetrySourceImpl& source, size_t expected)
+    {
+        std::vector<std::string> received;
+        std::vector<std::string_view> frames;
+        while (received.size() < expected && !source.isPeerClosed())
+        {
+            pollfd pfd{source.getPollFd(), POLLIN, 0};
+            if (poll(&pfd, 1, 2000) <= 0) break;
+
+            frames.clear();
+            source.readFrames(frames);
+            for (auto frame : frames)
+            {
+                received.emplace_back(frame);
+            }
+        }
+        return received;
+    }
 };
 
 // ══════════════════════════════════════════════════════════════════════
@@ -124,6 +207,7 @@ TEST_F(SocketTelemetrySourceImplTest, ReadSource_ReceivesData)
     SocketTelemetrySourceImpl source(testSocketPath);
     source.openSource();
 
+    waitReadable(source.getPollFd());
     std::string data;
     EXPECT_TRUE(source.readSource(data));
     EXPECT_EQ(data, testData);
@@ -150,6 +234,7 @@ TEST_F(SocketTelemetrySourceImplTest, ImplementsITelemetrySource)
     
     EXPECT_TRUE(source->openSource());
     
+    waitReadable(source->getPollFd());
     std::string data;
     EXPECT_TRUE(source->readSource(data));
     EXPECT_EQ(data, "Interface Test Data");
@@ -166,6 +251,7 @@ TEST_F(SocketTelemetrySourceImplTest, PolymorphicUsage)
     
     EXPECT_TRUE(source->openSource());
     
+    waitReadable(source->getPollFd());
     std::string data;
     EXPECT_TRUE(source->readSource(data));
     EXPECT_EQ(data, "Polymorphic Data");
@@ -184,7 +270,204 @@ TEST_F(SocketTelemetrySourceImplTest, MoveConstructor_Works)
 
     SocketTelemetrySourceImpl source2(std::move(source1));
 
+    waitReadable(source2.getPollFd());
     std::string data;
     EXPECT_TRUE(source2.readSource(data));
     EXPECT_EQ(data, "Move Constructor Data");
-}
\ No newline at end of file
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Framed Stream Tests (stand-in server, high message rate)
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(SocketTelemetrySourceImplTest, Newline_HighRate_AllFramesInOrder)
+{
+    constexpr size_t FrameCount = 100000;
+    std::vector<char> wire;
+    for (size_t i = 0; i < FrameCount; ++i)
+    {
+        std::string line = "CPU:" + std::to_string(i) + "\n";
+        wire.insert(wire.end(), line.begin(), line.end());
+    }
+    startStreamServer([&wire](int fd) { sendChunked(fd, wire); });
+
+    SocketTelemetrySourceImpl source(testSocketPath, FramingMode::Newline);
+    ASSERT_TRUE(source.openSource());
+
+    auto received = collectFrames(source, FrameCount);
+    ASSERT_EQ(received.size(), FrameCount);
+    for (size_t i = 0; i < FrameCount; ++i)
+    {
+        ASSERT_EQ(received[i], "CPU:" + std::to_string(i));
+    }
+}
+
+TEST_F(SocketTelemetrySourceImplTest, LengthPrefixed_HighRate_AllFramesInOrder)
+{
+    constexpr size_t FrameCount = 50000;
+    std::vector<char> wire;
+    for (size_t i = 0; i < FrameCount; ++i)
+    {
+        // Payloads may contain the newline byte
+        FrameParser::appendLengthPrefixed(wire, "id=" + std::to_string(i) + "\n");
+    }
+    startStreamServer([&wire](int fd) { sendChunked(fd, wire); });
+
+    SocketTelemetrySourceImpl source(testSocketPath, FramingMode::LengthPrefixed);
+    ASSERT_TRUE(source.openSource());
+
+    auto received = collectFrames(source, FrameCount);
+    ASSERT_EQ(received.size(), FrameCount);
+    for (size_t i = 0; i < FrameCount; ++i)
+    {
+        ASSERT_EQ(received[i], "id=" + std::to_string(i) + "\n");
+    }
+    EXPECT_FALSE(source.isCorrupt());
+}
+
+TEST_F(SocketTelemetrySourceImplTest, LengthPrefixed_OversizedFrame_ClosesStream)
+{
+    startStreamServer([](int fd) {
+        std::vector<char> wire;
+        FrameParser::appendLengthPrefixed(wire, "ok");
+        FrameParser::appendLengthPrefixed(wire, std::string(200, 'x'));
+        send(fd, wire.data(), wire.size(), MSG_NOSIGNAL);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        send(fd, "more", 4, MSG_NOSIGNAL);
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    });
+
+    SocketTelemetrySourceImpl source(testSocketPath, FramingMode::LengthPrefixed, 64);
+    ASSERT_TRUE(source.openSource());
+
+    pollfd pfd{source.getPollFd(), POLLIN, 0};
+    ASSERT_EQ(poll(&pfd, 1, 2000), 1);
+    std::vector<std::string_view> frames;
+    EXPECT_EQ(source.readFrames(frames), 1u);
+    EXPECT_EQ(frames[0], "ok");
+
+    // The rest is never read, so the fd stays readable: callers must stop
+    EXPECT_TRUE(source.isCorrupt());
+    EXPECT_TRUE(source.isClosed());
+    EXPECT_FALSE(source.isPeerClosed());
+    EXPECT_EQ(poll(&pfd, 1, 1000), 1);
+    EXPECT_EQ(source.readFrames(frames), 0u);
+    EXPECT_EQ(poll(&pfd, 1, 0), 1);
+}
+
+TEST_F(SocketTelemetrySourceImplTest, ReadSource_Framed_ReturnsOneFramePerCall)
+{
+    startStreamServer([](int fd) {
+        const char wire[] = "12\n34\n56";  // last frame incomplete
+        send(fd, wire, sizeof(wire) - 1, MSG_NOSIGNAL);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    });
+
+    SocketTelemetrySourceImpl source(testSocketPath, FramingMode::Newline);
+    ASSERT_TRUE(source.openSource());
+
+    pollfd pfd{source.getPollFd(), POLLIN, 0};
+    ASSERT_EQ(poll(&pfd, 1, 2000), 1);
+
+    std::string data;
+    EXPECT_TRUE(source.readSource(data));
+    EXPECT_EQ(data, "12");
+    EXPECT_TRUE(source.hasPendingData());
+    EXPECT_TRUE(source.readSource(data));
+    EXPECT_EQ(data, "34");
+    EXPECT_FALSE(source.hasPendingData());
+}
+
+TEST_F(SocketTelemetrySourceImplTest, PeerClose_Detected)
+{
+    startStreamServer([](int) {});
+
+    SocketTelemetrySourceImpl source(testSocketPath, FramingMode::Newline);
+    ASSERT_TRUE(source.openSource());
+
+    auto received = collectFrames(source, 1);
+    EXPECT_TRUE(received.empty());
+    EXPECT_TRUE(source.isPeerClosed());
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Message-Oriented Socket Tests (SOCK_SEQPACKET / SOCK_DGRAM)
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(SocketTelemetrySourceImplTest, Datagram_HighRate_BatchedInOrder)
+{
+    SocketTelemetrySourceImpl source(testSocketPath, SocketKind::Datagram, 32);
+    ASSERT_TRUE(source.openSource());
+    EXPECT_EQ(source.getKind(), SocketKind::Datagram);
+
+    constexpr size_t MessageCount = 20000;
+    std::thread producer([this]() {
+        int fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+        sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, testSocketPath.c_str(), sizeof(addr.sun_path) - 1);
+
+        // Blocking sends: the producer waits whenever the receive queue is full
+        for (size_t i = 0; i < MessageCount; ++i)
+        {
+            std::string msg = "GPU:" + std::to_string(i);
+            sendto(fd, msg.data(), msg.size(), 0, (sockaddr*)&addr, sizeof(addr));
+        }
+        close(fd);
+    });
+
+    auto received = collectFrames(source, MessageCount);
+    producer.join();
+
+    ASSERT_EQ(received.size(), MessageCount);
+    for (size_t i = 0; i < MessageCount; ++i)
+    {
+        ASSERT_EQ(received[i], "GPU:" + std::to_string(i));
+    }
+}
+
+TEST_F(SocketTelemetrySourceImplTest, Datagram_ReadSource_DrainsBatchOneByOne)
+{
+    SocketTelemetrySourceImpl source(testSocketPath, SocketKind::Datagram, 8);
+    ASSERT_TRUE(source.openSource());
+
+    int fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, testSocketPath.c_str(), sizeof(addr.sun_path) - 1);
+    for (const char* msg : {"10", "20", "30"})
+    {
+        sendto(fd, msg, strlen(msg), 0, (sockaddr*)&addr, sizeof(addr));
+    }
+    close(fd);
+
+    std::string data;
+    ASSERT_TRUE(source.readSource(data));
+    EXPECT_EQ(data, "10");
+    EXPECT_TRUE(source.hasPendingData());  // rest of the recvmmsg() batch
+    ASSERT_TRUE(source.readSource(data));
+    EXPECT_EQ(data, "20");
+    ASSERT_TRUE(source.readSource(data));
+    EXPECT_EQ(data, "30");
+    EXPECT_FALSE(source.hasPendingData());
+    EXPECT_FALSE(source.readSource(data));
+}
+
+TEST_F(SocketTelemetrySourceImplTest, SeqPacket_MessagesThenPeerClose)
+{
+    startStreamServer([](int fd) {
+        for (const char* msg : {"CPU:1", "CPU:2", "CPU:3"})
+        {
+            send(fd, msg, strlen(msg), MSG_NOSIGNAL);
+        }
+    }, SOCK_SEQPACKET);
+
+    SocketTelemetrySourceImpl source(testSocketPath, SocketKind::SeqPacket);
+    ASSERT_TRUE(source.openSource());
+
+    auto received = collectFrames(source, 10);
+    EXPECT_EQ(received, (std::vector<std::string>{"CPU:1", "CPU:2", "CPU:3"}));
+    EXPECT_TRUE(source.isPeerClosed());
+}
@@ -0,0 +1,386 @@
+// Utest/phase2/TelemetryIngestServerTest.cc
+
+#include <gtest/gtest.h>
+#include "SmartDataHub/TelemetryIngestServer.hpp"
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <ctime>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace SmartDataHub;
+
+class TelemetryIngestServerTest : public ::testing::Test
+{
+protected:
+    const std::string testSocketPath = "/tmp/telemetry_ingest_test.sock";
+
+    std::mutex mutex;
+    std::map<std::string, std::vector<std::string>> received; // by source
+    size_t batches = 0;
+
+    void SetUp() override
+    {
+        std::remove(testSocketPath.c_str());
+    }
+
+    void TearDown() override
+    {
+        std::remove(testSocketPath.c_str());
+    }
+
+    TelemetryIngestServer::BatchHandler collector()
+    {
+        return [this](const std::vector<IngestSample>& batch) {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++batches;
+            for (const auto& sample : batch)
+            {
+                received[std::string(sample.source)].emplace_back(sample.data);
+            }
+        };
+    }
+
+    size_t receivedCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t total = 0;
+        for (const auto& [source, samples] : received)
+        {
+            total += samples.size();
+        }
+        return total;
+    }
+
+    bool waitFor(const std::function<bool()>& done)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!done())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return true;
+    }
+
+    int connectClient()
+    {
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, testSocketPath.c_str(), sizeof(addr.sun_path) - 1);
+        if (connect(fd, (sockaddr*)&addr, sizeof(addr)) != 0)
+        {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    static void sendAll(int fd, const std::string& data)
+    {
+        size_t sent = 0;
+        while (sent < data.size())
+        {
+            ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (n <= 0) return;
+            sent += static_cast<size_t>(n);
+        }
+    }
+};
+
+// ══════════════════════════════════════════════════════════════════════
+// Lifecycle Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(TelemetryIngestServerTest, Start_CreatesSocketAndStopRemovesIt)
+{
+    TelemetryIngestServer server(testSocketPath, collector());
+    ASSERT_TRUE(server.start());
+    EXPECT_TRUE(server.isRunning());
+    EXPECT_EQ(access(testSocketPath.c_str(), F_OK), 0);
+    EXPECT_FALSE(server.start());
+
+    server.stop();
+    EXPECT_FALSE(server.isRunning());
+    EXPECT_NE(access(testSocketPath.c_str(), F_OK), 0);
+
+    // Restartable
+    EXPECT_TRUE(server.start());
+}
+
+TEST_F(TelemetryIngestServerTest, Start_NoHandler_ReturnsFalse)
+{
+    TelemetryIngestServer server(testSocketPath, nullptr);
+    EXPECT_FALSE(server.start());
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Identity Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(TelemetryIngestServerTest, Identity_DefaultsToPeerPid)
+{
+    TelemetryIngestServer server(testSocketPath, collector());
+    ASSERT_TRUE(server.start());
+
+    int fd = connectClient();
+    ASSERT_GE(fd, 0);
+    sendAll(fd, "42\n43\n");
+
+    ASSERT_TRUE(waitFor([this] { return receivedCount() == 2; }));
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& samples = received["pid:" + std::to_string(getpid())];
+    EXPECT_EQ(samples, (std::vector<std::string>{"42", "43"}));
+    close(fd);
+}
+
+TEST_F(TelemetryIngestServerTest, Identity_HelloFrameNamesConnection)
+{
+    TelemetryIngestServer server(testSocketPath, collector());
+    ASSERT_TRUE(server.start());
+
+    int fd = connectClient();
+    ASSERT_GE(fd, 0);
+    sendAll(fd, "@GPU\n75\n@not-a-name\n");
+
+    ASSERT_TRUE(waitFor([this] { return receivedCount() == 2; }));
+    std::lock_guard<std::mutex> lock(mutex);
+    // Only the first frame can name the connection
+    EXPECT_EQ(received["GPU"], (std::vector<std::string>{"75", "@not-a-name"}));
+    close(fd);
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Throughput / Scale Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(TelemetryIngestServerTest, ManyClients_AllSamplesInOrderPerSource)
+{
+    constexpr int ClientCount = 400;
+    constexpr int SamplesPerClient = 50;
+
+    TelemetryIngestServer server(testSocketPath, collector());
+    ASSERT_TRUE(server.start());
+
+    std::vector<int> clients;
+    for (int c = 0; c < ClientCount; ++c)
+    {
+        int fd = connectClient();
+        ASSERT_GE(fd, 0);
+        clients.push_back(fd);
+        sendAll(fd, "@agent" + std::to_string(c) + "\n");
+    }
+
+    // Interleave the clients so rounds carry samples from many connections
+    for (int i = 0; i < SamplesPerClient; ++i)
+    {
+        for (int c = 0; c < ClientCount; ++c)
+        {
+            sendAll(clients[c], std::to_string(i) + "\n");
+        }
+    }
+
+    ASSERT_TRUE(waitFor([this] { return receivedCount() == ClientCount * SamplesPerClient; }));
+    EXPECT_EQ(server.getStats().active, static_cast<uint64_t>(ClientCount));
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ASSERT_EQ(received.size(), static_cast<size_t>(ClientCount));
+        for (int c = 0; c < ClientCount; ++c)
+        {
+            const auto& samples = received["agent" + std::to_string(c)];
+            ASSERT_EQ(samples.size(), static_cast<size_t>(SamplesPerClient));
+            for (int i = 0; i < SamplesPerClient; ++i)
+            {
+                ASSERT_EQ(samples[i], std::to_string(i));
+            }
+        }
+        // Samples are delivered in batches, not one call each
+        EXPECT_LT(batches, static_cast<size_t>(ClientCount * SamplesPerClient));
+    }
+
+    for (int fd : clients)
+    {
+        close(fd);
+    }
+    ASSERT_TRUE(waitFor([&server] { return server.getStats().active == 0; }));
+    EXPECT_EQ(server.getStats().accepted, static_cast<uint64_t>(ClientCount));
+    EXPECT_EQ(server.getStats().samples, static_cast<uint64_t>(ClientCount * SamplesPerClient));
+}
+
+TEST_F(TelemetryIngestServerTest, FramesSplitAcrossSends_Reassembled)
+{
+    TelemetryIngestServer server(testSocketPath, collector());
+    ASSERT_TRUE(server.start());
+
+    int fd = connectClient();
+    ASSERT_GE(fd, 0);
+    sendAll(fd, "@CPU\n1");
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    sendAll(fd, "2\n3");
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    sendAll(fd, "4\n");
+
+    ASSERT_TRUE(waitFor([this] { return receivedCount() == 2; }));
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(received["CPU"], (std::vector<std::string>{"12", "34"}));
+    close(fd);
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Limit Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(TelemetryIngestServerTest, MaxConnections_ExtraClientsRejected)
+{
+    IngestLimits limits;
+    limits.maxConnections = 2;
+    TelemetryIngestServer server(testSocketPath, collector(), FramingMode::Newline, limits);
+    ASSERT_TRUE(server.start());
+
+    std::vector<int> clients;
+    for (int c = 0; c < 4; ++c)
+    {
+        clients.push_back(connectClient());
+    }
+
+    ASSERT_TRUE(waitFor([&server] { return server.getStats().rejected == 2; }));
+    EXPECT_EQ(server.getStats().active, 2u);
+
+    for (int fd : clients)
+    {
+        close(fd);
+    }
+}
+
+TEST_F(TelemetryIngestServerTest, MaxConnections_ClampedToFdLimit)
+{
+    rlimit saved{};
+    ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &saved), 0);
+    rlimit lowered = saved;
+    lowered.rlim_cur = 256;
+    if (saved.rlim_cur != RLIM_INFINITY && saved.rlim_cur < 256)
+    {
+        GTEST_SKIP() << "fd limit below 256";
+    }
+    ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &lowered), 0);
+
+    TelemetryIngestServer server(testSocketPath, collector()); // asks for 4096
+    bool started = server.start();
+    setrlimit(RLIMIT_NOFILE, &saved);
+    ASSERT_TRUE(started);
+    EXPECT_EQ(server.getLimits().maxConnections, 128u);
+}
+
+TEST_F(TelemetryIngestServerTest, OutOfFds_PendingClientsRejectedWithoutSpinning)
+{
+    TelemetryIngestServer server(testSocketPath, collector());
+    ASSERT_TRUE(server.start());
+
+    // Client sockets first; then the process runs out of fds
+    std::vector<int> clients;
+    for (int c = 0; c < 3; ++c)
+    {
+        clients.push_back(socket(AF_UNIX, SOCK_STREAM, 0));
+    }
+    std::vector<int> hogs;
+    for (int fd = open("/dev/null", O_RDONLY); fd >= 0; fd = open("/dev/null", O_RDONLY))
+    {
+        hogs.push_back(fd);
+    }
+
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, testSocketPath.c_str(), sizeof(addr.sun_path) - 1);
+    for (int fd : clients)
+    {
+        connect(fd, (sockaddr*)&addr, sizeof(addr));
+    }
+    bool rejected = waitFor([&server] { return server.getStats().rejected == 3; });
+
+    // A spinning loop would burn about the whole interval
+    timespec before{};
+    timespec after{};
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &before);
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &after);
+    double cpuMs = (after.tv_sec - before.tv_sec) * 1e3 + (after.tv_nsec - before.tv_nsec) / 1e6;
+
+    for (int fd : hogs)
+    {
+        close(fd);
+    }
+    EXPECT_TRUE(rejected);
+    EXPECT_LT(cpuMs, 100.0);
+    EXPECT_EQ(server.getStats().accepted, 0u);
+
+    // With fds free again clients are served
+    int fd = connectClient();
+    ASSERT_GE(fd, 0);
+    sendAll(fd, "ok\n");
+    EXPECT_TRUE(waitFor([this] { return receivedCount() == 1; }));
+    close(fd);
+    for (int client : clients)
+    {
+        close(client);
+    }
+}
+
+TEST_F(TelemetryIngestServerTest, OversizedLine_DroppedConnectionKept)
+{
+    IngestLimits limits;
+    limits.maxFrameSize = 16;
+    TelemetryIngestServer server(testSocketPath, collector(), FramingMode::Newline, limits);
+    ASSERT_TRUE(server.start());
+
+    int fd = connectClient();
+    ASSERT_GE(fd, 0);
+    sendAll(fd, "@RAM\n" + std::string(100, 'x') + "\n55\n");
+
+    ASSERT_TRUE(waitFor([this] { return receivedCount() == 1; }));
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        EXPECT_EQ(received["RAM"], (std::vector<std::string>{"55"}));
+    }
+    EXPECT_GE(server.getStats().droppedBytes, 100u);
+    EXPECT_EQ(server.getStats().active, 1u);
+    close(fd);
+}
+
+TEST_F(TelemetryIngestServerTest, LengthPrefixed_OversizedFrameClosesConnection)
+{
+    IngestLimits limits;
+    limits.maxFrameSize = 16;
+    TelemetryIngestServer server(testSocketPath, collector(), FramingMode::LengthPrefixed, limits);
+    ASSERT_TRUE(server.start());
+
+    int fd = connectClient();
+    ASSERT_GE(fd, 0);
+
+    std::vector<char> wire;
+    FrameParser::appendLengthPrefixed(wire, "@GPU");
+    FrameParser::appendLengthPrefixed(wire, "60");
+    FrameParser::appendLengthPrefixed(wire, std::string(100, 'x'));
+    sendAll(fd, std::string(wire.begin(), wire.end()));
+
+    ASSERT_TRUE(waitFor([&server] { return server.getStats().corrupt == 1; }));
+    EXPECT_TRUE(waitFor([&server] { return server.getStats().active == 0; }));
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(received["GPU"], (std::vector<std::string>{"60"}));
+    close(fd);
+}
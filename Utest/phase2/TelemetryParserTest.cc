@@ -4,6 +4,26 @@
 #include "SmartDataHub/TelemetryParser.hpp"
 #include <thread>
 #include <chrono>
+#include <dirent.h>
+#include <array>
+#include <cstdio>
+#include <fstream>
+
+// Number of open fds in this process
+static int countOpenFds()
+{
+    int count = 0;
+    DIR* dir = opendir("/proc/self/fd");
+    while (dir != nullptr && readdir(dir) != nullptr)
+    {
+        ++count;
+    }
+    if (dir != nullptr)
+    {
+        closedir(dir);
+    }
+    return count;
+}
 
 using namespace SmartDataHub;
 
@@ -115,6 +135,28 @@ TEST_F(TelemetryParserTest, MultipleReads_ReturnValidData)
     }
 }
 
+TEST_F(TelemetryParserTest, Open_ReturnsTrue)
+{
+    TelemetryParser parser;
+    EXPECT_TRUE(parser.open());
+    EXPECT_TRUE(parser.open());  // already open is fine
+}
+
+TEST_F(TelemetryParserTest, RepeatedSampling_DoesNotLeakFds)
+{
+    TelemetryParser parser;
+    parser.getCpuUsage();
+    parser.getMemUsage();
+
+    int before = countOpenFds();
+    for (int i = 0; i < 100; ++i)
+    {
+        parser.getCpuUsage();
+        parser.getMemUsage();
+    }
+    EXPECT_EQ(countOpenFds(), before);
+}
+
 // ══════════════════════════════════════════════════════════════════════
 // Output Format Tests
 // ══════════════════════════════════════════════════════════════════════
@@ -159,6 +201,115 @@ TEST_F(TelemetryParserTest, RapidSuccessiveCalls)
     }
 }
 
+// ══════════════════════════════════════════════════════════════════════
+// Per-Core Tests
+// ══════════════════════════════════════════════════════════════════════
+
+// /proc/stat with an aggregate line and one line per {core, busy, idle}
+static std::string statContent(std::initializer_list<std::array<uint64_t, 3>> cores)
+{
+    std::string content = "cpu  1 0 1 1 0 0 0 0 0 0\n";
+    for (const auto& core : cores)
+    {
+        content += "cpu" + std::to_string(core[0]) + " " + std::to_string(core[1]) + " 0 0 " +
+                   std::to_string(core[2]) + " 0 0 0 0 0 0\n";
+    }
+    return content + "intr 12345 0 0\nctxt 999\n";
+}
+
+TEST_F(TelemetryParserTest, ParsePerCore_ReadsEveryCoreLine)
+{
+    TelemetryParser::PerCoreCounters counters;
+    ASSERT_EQ(TelemetryParser::parsePerCore(statContent({{0, 10, 90}, {1, 50, 50}, {3, 7, 3}}), counters), 3u);
+    EXPECT_EQ(counters.core, (std::vector<uint32_t>{0, 1, 3}));
+    EXPECT_EQ(counters.total, (std::vector<uint64_t>{100, 100, 10}));
+    EXPECT_EQ(counters.idle, (std::vector<uint64_t>{90, 50, 3}));
+
+    // Reuses the arrays: a smaller machine leaves no stale entries
+    ASSERT_EQ(TelemetryParser::parsePerCore(statContent({{0, 1, 1}}), counters), 1u);
+    EXPECT_EQ(counters.total.size(), 1u);
+    EXPECT_EQ(TelemetryParser::parsePerCore("cpu  1 2 3 4 5 6 7 8\n", counters), 0u);
+}
+
+TEST_F(TelemetryParserTest, ComputeUsage_DeltaPerCoreAndClamped)
+{
+    const uint64_t prevTotal[] = {100, 100, 100, 100, 100};
+    const uint64_t prevIdle[] = {50, 50, 50, 50, 50};
+    const uint64_t currTotal[] = {200, 200, 100, 300, 110};
+    const uint64_t currIdle[] = {150, 100, 50, 250, 40};  // last: iowait went backwards
+    float usage[5] = {};
+    TelemetryParser::computeUsage(prevTotal, prevIdle, currTotal, currIdle, usage, 5);
+    EXPECT_FLOAT_EQ(usage[0], 0.0f);
+    EXPECT_FLOAT_EQ(usage[1], 50.0f);
+    EXPECT_FLOAT_EQ(usage[2], 0.0f);  // no ticks at all
+    EXPECT_FLOAT_EQ(usage[3], 0.0f);
+    EXPECT_FLOAT_EQ(usage[4], 100.0f);
+}
+
+TEST_F(TelemetryParserTest, SamplePerCore_UsageSincePreviousSampleAndTopK)
+{
+    const std::string path = "/tmp/telemetry_parser_percore_stat";
+    std::ofstream(path) << statContent({{0, 0, 0}, {1, 0, 0}, {2, 0, 0}});
+    TelemetryParser parser(path, "/proc/meminfo");
+
+    ASSERT_TRUE(parser.samplePerCore());
+    EXPECT_EQ(parser.getCoreUsage(), (std::vector<float>{0.0f, 0.0f, 0.0f}));
+
+    std::ofstream(path) << statContent({{0, 25, 75}, {1, 90, 10}, {2, 60, 40}});
+    ASSERT_TRUE(parser.samplePerCore());
+    EXPECT_EQ(parser.getCoreUsage(), (std::vector<float>{25.0f, 90.0f, 60.0f}));
+
+    std::vector<TelemetryParser::CoreUsage> top;
+    parser.getTopCores(2, top);
+    ASSERT_EQ(top.size(), 2u);
+    EXPECT_EQ(top[0].core, 1u);
+    EXPECT_EQ(top[1].core, 2u);
+    parser.getTopCores(0, top);
+    EXPECT_EQ(top.size(), 3u);
+
+    // Core 1 went offline: no baseline for this sample
+    std::ofstream(path) << statContent({{0, 50, 150}, {2, 120, 80}});
+    ASSERT_TRUE(parser.samplePerCore());
+    EXPECT_EQ(parser.getCores(), (std::vector<uint32_t>{0, 2}));
+    EXPECT_EQ(parser.getCoreUsage(), (std::vector<float>{0.0f, 0.0f}));
+
+    std::remove(path.c_str());
+}
+
+TEST_F(TelemetryParserTest, SamplePerCore_FailedSampleLeavesNoCores)
+{
+    const std::string path = "/tmp/telemetry_parser_percore_stat";
+    std::ofstream(path) << statContent({{0, 0, 0}, {1, 0, 0}, {2, 0, 0}});
+    TelemetryParser parser(path, "/proc/meminfo");
+    ASSERT_TRUE(parser.samplePerCore());
+
+    // Only the aggregate line: nothing per core to parse
+    std::ofstream(path) << "cpu  1 2 3 4 5 6 7 8\n";
+    EXPECT_FALSE(parser.samplePerCore());
+    EXPECT_TRUE(parser.getCoreUsage().empty());
+
+    std::vector<TelemetryParser::CoreUsage> top;
+    parser.getTopCores(2, top);
+    EXPECT_TRUE(top.empty());
+
+    std::remove(path.c_str());
+}
+
+TEST_F(TelemetryParserTest, SamplePerCore_ThisMachine)
+{
+    TelemetryParser parser;
+    ASSERT_TRUE(parser.samplePerCore());
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_TRUE(parser.samplePerCore());
+
+    EXPECT_GE(parser.getCores().size(), 1u);
+    for (float usage : parser.getCoreUsage())
+    {
+        EXPECT_GE(usage, 0.0f);
+        EXPECT_LE(usage, 100.0f);
+    }
+}
+
 // ══════════════════════════════════════════════════════════════════════
 // Rule of 0 Tests
 // ══════════════════════════════════════════════════════════════════════
@@ -0,0 +1,371 @@
+// Utest/phase2/TelemetryReactorTest.cc
+
+#include <gtest/gtest.h>
+#include "SmartDataHub/TelemetryReactor.hpp"
+#include "SmartDataHub/FileTelemetrySourceImpl.hpp"
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unistd.h>
+#include <fcntl.h>
+
+using namespace SmartDataHub;
+
+// Timer-driven source: every read returns the next counter value
+class CountingSource : public ITelemetrySource
+{
+public:
+    std::atomic<int> reads{0};
+
+    bool openSource() override { return true; }
+    bool readSource(std::string &out) override
+    {
+        out = std::to_string(++reads);
+        return true;
+    }
+};
+
+// Pollable source backed by a non-blocking pipe
+class PipeSource : public ITelemetrySource
+{
+public:
+    int fds[2] = {-1, -1};
+
+    PipeSource() { pipe2(fds, O_NONBLOCK | O_CLOEXEC); }
+    ~PipeSource() override
+    {
+        close(fds[0]);
+        if (fds[1] >= 0)
+        {
+            close(fds[1]);
+        }
+    }
+
+    bool openSource() override { return true; }
+    bool readSource(std::string &out) override
+    {
+        char buffer[256];
+        ssize_t bytes = read(fds[0], buffer, sizeof(buffer));
+        if (bytes <= 0)
+        {
+            return false;
+        }
+        out.assign(buffer, static_cast<size_t>(bytes));
+        return true;
+    }
+    int getPollFd() const override { return fds[0]; }
+
+    void send(const std::string &data) { (void)!write(fds[1], data.data(), data.size()); }
+    void closeWriter()
+    {
+        close(fds[1]);
+        fds[1] = -1;
+    }
+};
+
+// Pollable source that stops reading once closed, leaving its fd readable
+// (like a socket whose stream turned corrupt)
+class StuckSource : public PipeSource
+{
+public:
+    std::atomic<int> reads{0};
+
+    bool readSource(std::string &out) override
+    {
+        ++reads;
+        out = "first";
+        return reads == 1;
+    }
+    bool isClosed() const override { return reads > 0; }
+};
+
+class TelemetryReactorTest : public ::testing::Test
+{
+protected:
+    std::mutex samplesMutex;
+    std::vector<std::pair<std::string, std::string>> samples;
+
+    TelemetryReactor::SampleHandler recorder()
+    {
+        return [this](const std::string &name, const std::string &data) {
+            std::lock_guard<std::mutex> lock(samplesMutex);
+            samples.emplace_back(name, data);
+        };
+    }
+
+    size_t sampleCount()
+    {
+        std::lock_guard<std::mutex> lock(samplesMutex);
+        return samples.size();
+    }
+
+    // Polls until the predicate holds or one second passes
+    template <typename Pred>
+    bool eventually(Pred pred)
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            if (pred())
+            {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return pred();
+    }
+};
+
+// ══════════════════════════════════════════════════════════════════════
+// Registration Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(TelemetryReactorTest, Constructor_AtLeastOneThread)
+{
+    TelemetryReactor reactor(0);
+    EXPECT_EQ(reactor.getThreadCount(), 1u);
+    EXPECT_FALSE(reactor.isRunning());
+}
+
+TEST_F(TelemetryReactorTest, AddSource_CountsSources)
+{
+    TelemetryReactor reactor;
+    EXPECT_TRUE(reactor.addSource("A", std::make_unique<CountingSource>(), 50, recorder()));
+    EXPECT_TRUE(reactor.addSource("B", std::make_unique<PipeSource>(), 50, recorder()));
+    EXPECT_EQ(reactor.getSourceCount(), 2u);
+}
+
+TEST_F(TelemetryReactorTest, AddSource_NullSourceOrHandler_ReturnsFalse)
+{
+    TelemetryReactor reactor;
+    EXPECT_FALSE(reactor.addSource("A", nullptr, 50, recorder()));
+    EXPECT_FALSE(reactor.addSource("B", std::make_unique<CountingSource>(), 50, nullptr));
+}
+
+TEST_F(TelemetryReactorTest, AddSource_WhileRunning_ReturnsFalse)
+{
+    TelemetryReactor reactor;
+    reactor.start();
+    EXPECT_FALSE(reactor.addSource("A", std::make_unique<CountingSource>(), 50, recorder()));
+    reactor.stop();
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Timer-driven Sources
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(TelemetryReactorTest, TimerSource_SampledPeriodically)
+{
+    TelemetryReactor reactor;
+    auto source = std::make_unique<CountingSource>();
+    CountingSource *raw = source.get();
+    reactor.addSource("CPU", std::move(source), 20, recorder());
+
+    reactor.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(210));
+    reactor.stop();
+
+    // First read is immediate, then one per 20 ms
+    EXPECT_GE(raw->reads.load(), 5);
+    EXPECT_LE(raw->reads.load(), 13);
+    EXPECT_EQ(samples.front().first, "CPU");
+    EXPECT_EQ(samples.front().second, "1");
+}
+
+TEST_F(TelemetryReactorTest, HundredsOfSources_FewThreads)
+{
+    constexpr int SourceCount = 300;
+    TelemetryReactor reactor(2);
+
+    std::vector<CountingSource *> sources;
+    for (int i = 0; i < SourceCount; ++i)
+    {
+        auto source = std::make_unique<CountingSource>();
+        sources.push_back(source.get());
+        // Two intervals: sources share a handful of timerfds
+        EXPECT_TRUE(reactor.addSource("S" + std::to_string(i), std::move(source),
+                                      (i % 2) ? 10 : 20, recorder()));
+    }
+
+    std::set<std::thread::id> threads;
+    std::mutex threadsMutex;
+    reactor.setThreadStartHook([&](std::size_t) {
+        std::lock_guard<std::mutex> lock(threadsMutex);
+        threads.insert(std::this_thread::get_id());
+    });
+
+    reactor.start();
+    EXPECT_TRUE(eventually([&] {
+        for (auto *source : sources)
+        {
+            if (source->reads.load() < 3)
+            {
+                return false;
+            }
+        }
+        return true;
+    }));
+    reactor.stop();
+
+    EXPECT_EQ(threads.size(), 2u);
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Readiness-driven Sources
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(TelemetryReactorTest, PollableSource_ReadOnReadiness)
+{
+    TelemetryReactor reactor;
+    auto source = std::make_unique<PipeSource>();
+    PipeSource *raw = source.get();
+    reactor.addSource("SOCK", std::move(source), 1000, recorder());
+
+    reactor.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    EXPECT_EQ(sampleCount(), 0u);  // nothing written, nothing read
+
+    raw->send("42");
+    EXPECT_TRUE(eventually([&] { return sampleCount() == 1; }));
+    reactor.stop();
+
+    EXPECT_EQ(samples[0].first, "SOCK");
+    EXPECT_EQ(samples[0].second, "42");
+}
+
+TEST_F(TelemetryReactorTest, PollableSource_HangupStopsPolling)
+{
+    TelemetryReactor reactor;
+    auto source = std::make_unique<PipeSource>();
+    PipeSource *raw = source.get();
+    reactor.addSource("SOCK", std::move(source), 1000, recorder());
+
+    reactor.start();
+    raw->send("last");
+    raw->closeWriter();
+
+    EXPECT_TRUE(eventually([&] { return sampleCount() == 1; }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    reactor.stop();
+
+    EXPECT_EQ(sampleCount(), 1u);
+    EXPECT_EQ(samples[0].second, "last");
+}
+
+TEST_F(TelemetryReactorTest, PollableSource_ClosedSourceStopsPolling)
+{
+    TelemetryReactor reactor;
+    auto source = std::make_unique<StuckSource>();
+    StuckSource *raw = source.get();
+    reactor.addSource("SOCK", std::move(source), 1000, recorder());
+
+    reactor.start();
+    raw->send("data that is never consumed");
+    EXPECT_TRUE(eventually([&] { return sampleCount() == 1; }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    int reads = raw->reads;
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    reactor.stop();
+
+    EXPECT_EQ(raw->reads, reads); // no longer woken by the readable fd
+    EXPECT_LT(reads, 10);
+}
+
+TEST_F(TelemetryReactorTest, WatchedFileSource_ReadOnWrite)
+{
+    const std::string path = "/tmp/telemetry_reactor_test.txt";
+    std::ofstream(path) << "1\n";
+
+    auto source = std::make_unique<FileTelemetrySourceImpl>(path);
+    ASSERT_TRUE(source->openSource());
+    ASSERT_TRUE(source->enableWatch());
+    EXPECT_GE(source->getPollFd(), 0);
+
+    TelemetryReactor reactor;
+    reactor.addSource("FILE", std::move(source), 1000, recorder());
+    reactor.start();
+
+    // Current value is read at start, the rewrite on change
+    EXPECT_TRUE(eventually([&] { return sampleCount() >= 1; }));
+    EXPECT_EQ(samples[0].second, "1");
+
+    std::ofstream(path) << "77\n";
+    EXPECT_TRUE(eventually([&] {
+        std::lock_guard<std::mutex> lock(samplesMutex);
+        return !samples.empty() && samples.back().second == "77";
+    }));
+    reactor.stop();
+
+    std::remove(path.c_str());
+}
+
+TEST_F(TelemetryReactorTest, BatchedReads_ProcFilesAndMixedSourcesSampled)
+{
+    TelemetryReactor reactor;
+    reactor.setBatchedReads(true);
+
+    for (int i = 0; i < 20; ++i)
+    {
+        auto source = std::make_unique<FileTelemetrySourceImpl>(i % 2 ? "/proc/stat" : "/proc/loadavg");
+        ASSERT_TRUE(source->openSource());
+        reactor.addSource("P" + std::to_string(i), std::move(source), 20, recorder());
+    }
+    auto counting = std::make_unique<CountingSource>(); // no prepareRead(): plain read
+    CountingSource *raw = counting.get();
+    reactor.addSource("C", std::move(counting), 20, recorder());
+
+    reactor.start();
+    EXPECT_TRUE(eventually([&] { return sampleCount() >= 42 && raw->reads.load() >= 2; }));
+    reactor.stop();
+
+    std::lock_guard<std::mutex> lock(samplesMutex);
+    for (const auto &[name, data] : samples)
+    {
+        if (name == "C")
+        {
+            continue;
+        }
+        int index = std::stoi(name.substr(1));
+        if (index % 2)
+        {
+            EXPECT_EQ(data.rfind("cpu ", 0), 0u) << data;
+        }
+        else
+        {
+            EXPECT_FALSE(data.empty());
+            EXPECT_EQ(data.find('\n'), std::string::npos);
+        }
+    }
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Lifecycle Tests
+// ══════════════════════════════════════════════════════════════════════
+
+TEST_F(TelemetryReactorTest, StartStop_Restartable)
+{
+    TelemetryReactor reactor;
+    auto source = std::make_unique<CountingSource>();
+    CountingSource *raw = source.get();
+    reactor.addSource("CPU", std::move(source), 10, recorder());
+
+    EXPECT_TRUE(reactor.start());
+    EXPECT_FALSE(reactor.start());
+    EXPECT_TRUE(eventually([&] { return raw->reads.load() >= 1; }));
+    reactor.stop();
+    EXPECT_FALSE(reactor.isRunning());
+
+    int readsAfterStop = raw->reads.load();
+    EXPECT_TRUE(reactor.start());
+    EXPECT_TRUE(eventually([&] { return raw->reads.load() > readsAfterStop; }));
+    reactor.stop();
+}
+
+TEST_F(TelemetryReactorTest, Stop_WithoutStart_NoOp)
+{
+    TelemetryReactor reactor;
+    reactor.stop();
+    EXPECT_FALSE(reactor.isRunning());
+}
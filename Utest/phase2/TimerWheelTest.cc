@@ -0,0 +1,182 @@
+// Utest/phase2/TimerWheelTest.cc
+
+#include <gtest/gtest.h>
+#include "SmartDataHub/TimerWheel.hpp"
+#include "SmartDataHub/TelemetryReactor.hpp"
+#include "inc/AsyncLogging/ThreadPool.hpp"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace SmartDataHub;
+using namespace std::chrono_literals;
+
+// ══════════════════════════════════════════════════════════════════════
+// Rates
+// ══════════════════════════════════════════════════════════════════════
+
+TEST(TimerWheelTest, FiresAtExactRateWithoutDrift)
+{
+    TimerWheel wheel;
+    std::atomic<int> fires{0};
+    std::vector<TimerWheel::Clock::time_point> times;
+    times.reserve(64);
+
+    // 30 ms of work every 50 ms: a sleep loop would slip to 80 ms
+    auto id = wheel.schedule(50ms, [&]() {
+        times.push_back(TimerWheel::Clock::now());
+        ++fires;
+        std::this_thread::sleep_for(30ms);
+    });
+    ASSERT_NE(id, 0u);
+    ASSERT_TRUE(wheel.start());
+    std::this_thread::sleep_for(1020ms);
+    wheel.stop();
+
+    // Deadlines at 0, 50, ..., 1000 ms
+    EXPECT_GE(fires.load(), 20);
+    EXPECT_LE(fires.load(), 21);
+    auto span = std::chrono::duration_cast<std::chrono::milliseconds>(times[20 - 1] - times[0]).count();
+    EXPECT_NEAR(static_cast<double>(span), 19 * 50.0, 10.0);
+
+    TimerStats stats = wheel.getStats(id);
+    EXPECT_EQ(stats.fires, static_cast<uint64_t>(fires.load()));
+    EXPECT_EQ(stats.overruns, 0u);
+    EXPECT_LT(stats.meanLatenessUs, 10000.0);
+}
+
+TEST(TimerWheelTest, SubTickAndOddPeriods)
+{
+    // 30 ms and 250 ms would both be rounded by 100 ms sleep steps
+    TimerWheel wheel;
+    std::atomic<int> fast{0};
+    std::atomic<int> slow{0};
+    wheel.schedule(30ms, [&]() { ++fast; });
+    wheel.schedule(250ms, [&]() { ++slow; });
+    ASSERT_TRUE(wheel.start());
+    std::this_thread::sleep_for(610ms);
+    wheel.stop();
+
+    EXPECT_NEAR(fast.load(), 21, 1); // 0, 30, ..., 600
+    EXPECT_EQ(slow.load(), 3);       // 0, 250, 500
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Scale
+// ══════════════════════════════════════════════════════════════════════
+
+TEST(TimerWheelTest, ThousandsOfTimersAcrossLevels)
+{
+    TimerWheel wheel;
+    const int count = 5000;
+    std::atomic<int> fires{0};
+    std::vector<TimerWheel::TimerId> ids;
+    // Periods 10..99 ms fire; 5 s - 2 h ones sit in coarser levels
+    for (int i = 0; i < count; ++i)
+    {
+        auto period = i % 2 == 0 ? std::chrono::milliseconds(10 + i % 90) : std::chrono::milliseconds(5000 + i * 1400);
+        ids.push_back(wheel.schedule(period, [&fires]() { ++fires; }, {}, period));
+    }
+    EXPECT_EQ(wheel.getTimerCount(), static_cast<size_t>(count));
+
+    ASSERT_TRUE(wheel.start());
+    std::this_thread::sleep_for(500ms);
+    wheel.stop();
+
+    // Sum over the fast timers of floor(500 / period), give or take a tick
+    int expected = 0;
+    for (int i = 0; i < count; i += 2)
+    {
+        expected += 500 / (10 + i % 90);
+    }
+    EXPECT_GT(fires.load(), expected * 9 / 10);
+    EXPECT_LE(fires.load(), expected + count / 2);
+
+    for (size_t i = 0; i < ids.size(); i += 2)
+    {
+        EXPECT_TRUE(wheel.cancel(ids[i]));
+    }
+    EXPECT_EQ(wheel.getTimerCount(), static_cast<size_t>(count / 2));
+}
+
+TEST(TimerWheelTest, LongTimerCascadesDownOnTime)
+{
+    // 300 ms sits in level 1 first, then cascades to level 0
+    TimerWheel wheel;
+    std::atomic<int64_t> firedAtMs{-1};
+    auto start = TimerWheel::Clock::now();
+    wheel.schedule(10s, [&]() {
+        firedAtMs = std::chrono::duration_cast<std::chrono::milliseconds>(TimerWheel::Clock::now() - start).count();
+    }, {}, 300ms);
+    ASSERT_TRUE(wheel.start());
+    std::this_thread::sleep_for(400ms);
+    wheel.stop();
+    EXPECT_GE(firedAtMs.load(), 300);
+    EXPECT_LE(firedAtMs.load(), 320);
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Dispatch
+// ══════════════════════════════════════════════════════════════════════
+
+TEST(TimerWheelTest, OverrunningCallbackIsNotStartedTwice)
+{
+    async_logging::ThreadPool pool(2);
+    TimerWheel wheel;
+    std::atomic<int> concurrent{0};
+    std::atomic<int> maxConcurrent{0};
+    auto id = wheel.schedule(10ms, [&]() {
+        int now = ++concurrent;
+        maxConcurrent = std::max(maxConcurrent.load(), now);
+        std::this_thread::sleep_for(35ms);
+        --concurrent;
+    }, [&pool](std::function<void()> task) { pool.enqueueTask(std::move(task)); });
+    ASSERT_TRUE(wheel.start());
+    std::this_thread::sleep_for(200ms);
+    wheel.stop();
+
+    EXPECT_EQ(maxConcurrent.load(), 1);
+    TimerStats stats = wheel.getStats(id);
+    EXPECT_GT(stats.overruns, 0u);
+    EXPECT_GT(stats.fires, 3u);
+}
+
+TEST(TimerWheelTest, DispatchesToReactorThread)
+{
+    TelemetryReactor reactor(2);
+    ASSERT_TRUE(reactor.start());
+    std::atomic<int> fires{0};
+    std::thread::id ranOn;
+    TimerWheel wheel;
+    wheel.schedule(20ms, [&]() {
+        ranOn = std::this_thread::get_id();
+        ++fires;
+    }, [&reactor](std::function<void()> task) { reactor.post(1, std::move(task)); });
+    ASSERT_TRUE(wheel.start());
+    std::this_thread::sleep_for(110ms);
+    wheel.stop();
+    reactor.stop();
+
+    EXPECT_GE(fires.load(), 5);
+    EXPECT_NE(ranOn, std::this_thread::get_id());
+    EXPECT_FALSE(reactor.post(0, []() {}));
+}
+
+TEST(TimerWheelTest, CancelStopsFiringAndRejectsBadPeriods)
+{
+    TimerWheel wheel;
+    std::atomic<int> fires{0};
+    auto id = wheel.schedule(5ms, [&]() { ++fires; });
+    EXPECT_EQ(wheel.schedule(0ms, [&]() { ++fires; }), 0u);
+    ASSERT_TRUE(wheel.start());
+    std::this_thread::sleep_for(30ms);
+    EXPECT_TRUE(wheel.cancel(id));
+    EXPECT_FALSE(wheel.cancel(id));
+    int atCancel = fires.load();
+    std::this_thread::sleep_for(30ms);
+    wheel.stop();
+    EXPECT_LE(fires.load(), atCancel + 1);
+    EXPECT_GT(atCancel, 3);
+}
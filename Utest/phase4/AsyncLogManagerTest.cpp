@@ -19,12 +19,22 @@ public:
     mutable std::mutex mutex;
     std::vector<std::string> messages;
     std::atomic<int> writeCount{0};
+    std::atomic<int> flushCount{0};
+    std::atomic<int> writesAtLastFlush{0};
+    std::chrono::milliseconds writeDelay{0};
     
-    void write(const logging::LogMessage& msg) const override
+    void write(const logging::LogMessage& msg) override
     {
+        std::this_thread::sleep_for(writeDelay);
         std::lock_guard<std::mutex> lock(mutex);
-        const_cast<MockSink*>(this)->messages.push_back(msg.getText());
-        const_cast<MockSink*>(this)->writeCount.fetch_add(1);
+        messages.push_back(msg.getText());
+        writeCount.fetch_add(1);
+    }
+
+    void flush() override
+    {
+        writesAtLastFlush.store(writeCount.load());
+        flushCount.fetch_add(1);
     }
     
     int getWriteCount() const
@@ -317,5 +327,341 @@ TEST(AsyncLogManagerTest, AddSinkDynamically)
     EXPECT_EQ(mockSink2->getWriteCount(), 1);
 }
 
+// ============== Runtime Sink Registration Tests ==============
+
+TEST(AsyncLogManagerTest, AddSinkWhileRunning)
+{
+    auto mockSink1 = std::make_shared<MockSink>();
+    std::vector<std::shared_ptr<logging::ILogSink>> sinks;
+    sinks.push_back(mockSink1);
+    
+    AsyncLogManager manager("TestApp", std::move(sinks), 10);
+    manager.start();
+    
+    manager.log(logging::LogMessage("Test", logging::Context::CPU, 10));
+    manager.flush();
+    
+    auto mockSink2 = std::make_shared<MockSink>();
+    manager.addSink(mockSink2);
+    EXPECT_EQ(manager.getSinkCount(), 2u);
+    
+    manager.log(logging::LogMessage("Test", logging::Context::CPU, 10));
+    manager.flush();
+    manager.stop();
+    
+    EXPECT_EQ(mockSink1->getWriteCount(), 2);
+    EXPECT_EQ(mockSink2->getWriteCount(), 1);
+}
+
+TEST(AsyncLogManagerTest, RemoveSinkWhileRunning)
+{
+    auto mockSink1 = std::make_shared<MockSink>();
+    auto mockSink2 = std::make_shared<MockSink>();
+    std::vector<std::shared_ptr<logging::ILogSink>> sinks;
+    sinks.push_back(mockSink1);
+    sinks.push_back(mockSink2);
+    
+    AsyncLogManager manager("TestApp", std::move(sinks), 10);
+    manager.start();
+    
+    manager.log(logging::LogMessage("Test", logging::Context::CPU, 10));
+    manager.flush();
+    
+    EXPECT_TRUE(manager.removeSink(mockSink2));
+    EXPECT_FALSE(manager.removeSink(mockSink2));
+    EXPECT_EQ(manager.getSinkCount(), 1u);
+    
+    manager.log(logging::LogMessage("Test", logging::Context::CPU, 10));
+    manager.flush();
+    manager.stop();
+    
+    EXPECT_EQ(mockSink1->getWriteCount(), 2);
+    EXPECT_EQ(mockSink2->getWriteCount(), 1);
+}
+
+TEST(AsyncLogManagerTest, ConcurrentSinkChurnDuringLogging)
+{
+    auto stableSink = std::make_shared<MockSink>();
+    std::vector<std::shared_ptr<logging::ILogSink>> sinks;
+    sinks.push_back(stableSink);
+    
+    AsyncLogManager manager("TestApp", std::move(sinks), 64);
+    manager.start();
+    
+    std::atomic<bool> done{false};
+    std::thread churn([&manager, &done]() {
+        while (!done.load())
+        {
+            auto diagnostic = std::make_shared<MockSink>();
+            manager.addSink(diagnostic);
+            manager.removeSink(diagnostic);
+        }
+    });
+    
+    for (int i = 0; i < 2000; ++i)
+    {
+        manager.log(logging::LogMessage("Test", logging::Context::CPU, 10));
+    }
+    manager.flush();
+    done.store(true);
+    churn.join();
+    manager.stop();
+    
+    EXPECT_EQ(stableSink->getWriteCount(), 2000);
+    EXPECT_EQ(manager.getSinkCount(), 1u);
+}
+
+// ============== Flush Barrier Tests ==============
+
+TEST(AsyncLogManagerTest, FlushWaitsForPriorMessages)
+{
+    auto mockSink = std::make_shared<MockSink>();
+    mockSink->writeDelay = std::chrono::milliseconds(5);
+    std::vector<std::shared_ptr<logging::ILogSink>> sinks;
+    sinks.push_back(mockSink);
+    
+    AsyncLogManager manager("TestApp", std::move(sinks), 50);
+    manager.start();
+    
+    for (int i = 0; i < 20; ++i)
+    {
+        manager.log(logging::LogMessage("Test", logging::Context::CPU, 10));
+    }
+    
+    manager.flush();
+    
+    EXPECT_EQ(mockSink->getWriteCount(), 20);
+    EXPECT_EQ(mockSink->flushCount.load(), 1);
+    EXPECT_EQ(mockSink->writesAtLastFlush.load(), 20);
+    
+    manager.stop();
+}
+
+TEST(AsyncLogManagerTest, FlushWaitsForThreadPoolTasks)
+{
+    auto mockSink = std::make_shared<MockSink>();
+    mockSink->writeDelay = std::chrono::milliseconds(5);
+    std::vector<std::shared_ptr<logging::ILogSink>> sinks;
+    sinks.push_back(mockSink);
+    
+    AsyncLogManager manager("TestApp", std::move(sinks), 50, true, 4);
+    manager.start();
+    
+    for (int i = 0; i < 30; ++i)
+    {
+        manager.log(logging::LogMessage("Test", logging::Context::CPU, 10));
+    }
+    
+    manager.flush();
+    
+    EXPECT_EQ(mockSink->getWriteCount(), 30);
+    EXPECT_EQ(mockSink->writesAtLastFlush.load(), 30);
+    
+    manager.stop();
+}
+
+TEST(AsyncLogManagerTest, FlushForTimesOutOnSlowSink)
+{
+    auto mockSink = std::make_shared<MockSink>();
+    mockSink->writeDelay = std::chrono::milliseconds(50);
+    std::vector<std::shared_ptr<logging::ILogSink>> sinks;
+    sinks.push_back(mockSink);
+    
+    AsyncLogManager manager("TestApp", std::move(sinks), 50);
+    manager.start();
+    
+    for (int i = 0; i < 10; ++i)
+    {
+        manager.log(logging::LogMessage("Test", logging::Context::CPU, 10));
+    }
+    
+    EXPECT_FALSE(manager.flushFor(std::chrono::milliseconds(10)));
+    EXPECT_TRUE(manager.flushFor(std::chrono::milliseconds(5000)));
+    
+    manager.stop();
+}
+
+TEST(AsyncLogManagerTest, FlushForTimesOutOnSaturatedLanes)
+{
+    auto mockSink = std::make_shared<MockSink>();
+    mockSink->writeDelay = std::chrono::milliseconds(100);
+    std::vector<std::shared_ptr<logging::ILogSink>> sinks;
+    sinks.push_back(mockSink);
+
+    AsyncLogManager manager("TestApp", std::move(sinks), 10);
+    manager.start();
+
+    // Keeps the buffer full while the sink drains one message per 100 ms
+    std::thread producer([&manager]() {
+        for (int i = 0; i < 14; ++i)
+        {
+            manager.log(logging::LogMessage("Test", logging::Context::CPU, 10));
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // The marker cannot even be queued: the timeout still holds
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(manager.flushFor(std::chrono::milliseconds(20)));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(90));
+
+    producer.join();
+    manager.stop();
+}
+
+TEST(AsyncLogManagerTest, FlushOnStoppedManagerReturnsImmediately)
+{
+    std::vector<std::shared_ptr<logging::ILogSink>> sinks;
+    sinks.push_back(std::make_shared<MockSink>());
+    
+    AsyncLogManager manager("TestApp", std::move(sinks), 10);
+    
+    EXPECT_TRUE(manager.flushFor(std::chrono::milliseconds(0)));
+    EXPECT_EQ(manager.getFlushStats().count, 0u);
+}
+
+TEST(AsyncLogManagerTest, FlushLatencyIsRecorded)
+{
+    std::vector<std::shared_ptr<logging::ILogSink>> sinks;
+    sinks.push_back(std::make_shared<MockSink>());
+    
+    AsyncLogManager manager("TestApp", std::move(sinks), 10);
+    manager.start();
+    
+    manager.flush();
+    manager.flush();
+    
+    FlushStats stats = manager.getFlushStats();
+    EXPECT_EQ(stats.count, 2u);
+    EXPECT_GT(stats.max.count(), 0);
+    EXPECT_GE(stats.total, stats.max);
+    
+    manager.stop();
+}
+
+TEST(AsyncLogManagerTest, StopDeliversAllThreadPoolTasks)
+{
+    auto mockSink = std::make_shared<MockSink>();
+    mockSink->writeDelay = std::chrono::milliseconds(2);
+    std::vector<std::shared_ptr<logging::ILogSink>> sinks;
+    sinks.push_back(mockSink);
+    
+    AsyncLogManager manager("TestApp", std::move(sinks), 50, true, 2);
+    manager.start();
+    
+    for (int i = 0; i < 40; ++i)
+    {
+        manager.log(logging::LogMessage("Test", logging::Context::CPU, 10));
+    }
+    
+    manager.stop();
+    
+    EXPECT_EQ(mockSink->getWriteCount(), 40);
+}
+
+// ============== Batch Tests ==============
+
+TEST(AsyncLogManagerTest, LogBatchDeliversAllInOrder)
+{
+    auto mockSink = std::make_shared<MockSink>();
+    std::vector<std::shared_ptr<logging::ILogSink>> sinks;
+    sinks.push_back(mockSink);
+    
+    // Batch is larger than the buffer, so it has to wait for the worker
+    AsyncLogManager manager("TestApp", std::move(sinks), 16);
+    manager.start();
+    
+    std::vector<logging::LogMessage> batch;
+    for (int i = 0; i < 50; ++i)
+    {
+        batch.emplace_back("Batch" + std::to_string(i), logging::Context::CPU, 10);
+    }
+    EXPECT_EQ(manager.logBatch(batch), 50u);
+    
+    manager.flush();
+    manager.stop();
+    
+    auto messages = mockSink->getMessages();
+    ASSERT_EQ(messages.size(), 50u);
+    for (int i = 0; i < 50; ++i)
+    {
+        EXPECT_NE(messages[i].find("Batch" + std::to_string(i) + "]"), std::string::npos) << messages[i];
+    }
+}
+
+TEST(AsyncLogManagerTest, LogBatchOnStoppedManagerQueuesNothing)
+{
+    std::vector<std::shared_ptr<logging::ILogSink>> sinks;
+    sinks.push_back(std::make_shared<MockSink>());
+    AsyncLogManager manager("TestApp", std::move(sinks), 16);
+    
+    std::vector<logging::LogMessage> batch;
+    batch.emplace_back("Batch", logging::Context::CPU, 10);
+    EXPECT_EQ(manager.logBatch(batch), 0u);
+}
+
+// ============== Priority Lane Tests ==============
+
+TEST(AsyncLogManagerTest, CriticalBypassesQueuedInfo)
+{
+    auto mockSink = std::make_shared<MockSink>();
+    mockSink->writeDelay = std::chrono::milliseconds(5);
+    std::vector<std::shared_ptr<logging::ILogSink>> sinks;
+    sinks.push_back(mockSink);
+    
+    AsyncLogManager manager("TestApp", std::move(sinks), 100);
+    manager.start();
+    
+    for (int i = 0; i < 20; ++i)
+    {
+        manager.log(logging::LogMessage("Info", logging::Context::CPU, 10));
+    }
+    manager.log(logging::LogMessage("Alert", logging::Context::CPU, 95));
+    
+    manager.flush();
+    manager.stop();
+    
+    auto messages = mockSink->getMessages();
+    ASSERT_EQ(messages.size(), 21u);
+    
+    // Only the INFO already being written can be ahead of the alert
+    std::size_t alertPos = 0;
+    for (; alertPos < messages.size(); ++alertPos)
+    {
+        if (messages[alertPos].find("Alert") != std::string::npos)
+        {
+            break;
+        }
+    }
+    EXPECT_LE(alertPos, 2u);
+}
+
+TEST(AsyncLogManagerTest, CriticalUsesReservedCapacity)
+{
+    auto mockSink = std::make_shared<MockSink>();
+    mockSink->writeDelay = std::chrono::milliseconds(200);
+    std::vector<std::shared_ptr<logging::ILogSink>> sinks;
+    sinks.push_back(mockSink);
+    
+    LaneConfig lanes;
+    lanes.criticalReservePercent = 50;
+    AsyncLogManager manager("TestApp", std::move(sinks), 4, false, 4, {}, {}, lanes);
+    manager.start();
+    
+    // One INFO occupies the worker, two more fill the unreserved slots
+    for (int i = 0; i < 3; ++i)
+    {
+        manager.log(logging::LogMessage("Info", logging::Context::CPU, 10));
+    }
+    
+    auto start = std::chrono::steady_clock::now();
+    manager.log(logging::LogMessage("Alert", logging::Context::CPU, 95));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    
+    EXPECT_LT(elapsed, std::chrono::milliseconds(100));
+    
+    manager.stop();
+}
+
 } // namespace test
 } // namespace async_logging
\ No newline at end of file
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include "inc/AsyncLogging/LogThrottle.hpp"
+#include "inc/AsyncLogging/AsyncLogManager.hpp"
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace async_logging
+{
+namespace test
+{
+
+using logging::Severity;
+
+// ============== Default Behavior ==============
+
+TEST(LogThrottleTest, DefaultConfigAdmitsEverything)
+{
+    LogThrottle throttle;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_TRUE(throttle.admit(Severity::INFO));
+    }
+
+    EXPECT_EQ(throttle.getCounters().admitted, 1000u);
+    EXPECT_EQ(throttle.getCounters().suppressed(), 0u);
+}
+
+// ============== Token Bucket ==============
+
+TEST(LogThrottleTest, BurstIsAdmittedThenLimited)
+{
+    ThrottleConfig config;
+    config.ratePerSec = 1.0;
+    config.burst = 5.0;
+    LogThrottle throttle(config);
+
+    int admitted = 0;
+    for (int i = 0; i < 20; ++i)
+    {
+        admitted += throttle.admit(Severity::WARN) ? 1 : 0;
+    }
+
+    EXPECT_EQ(admitted, 5);
+    EXPECT_EQ(throttle.getCounters().rateLimited, 15u);
+}
+
+TEST(LogThrottleTest, TokensRefillOverTime)
+{
+    ThrottleConfig config;
+    config.ratePerSec = 100.0;
+    config.burst = 1.0;
+    LogThrottle throttle(config);
+
+    EXPECT_TRUE(throttle.admit(Severity::WARN));
+    EXPECT_FALSE(throttle.admit(Severity::WARN));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    EXPECT_TRUE(throttle.admit(Severity::WARN));
+}
+
+TEST(LogThrottleTest, CriticalIsExemptByDefault)
+{
+    ThrottleConfig config;
+    config.ratePerSec = 1.0;
+    config.burst = 1.0;
+    LogThrottle throttle(config);
+
+    EXPECT_TRUE(throttle.admit(Severity::WARN));
+    EXPECT_FALSE(throttle.admit(Severity::WARN));
+
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_TRUE(throttle.admit(Severity::CRITICAL));
+    }
+}
+
+TEST(LogThrottleTest, ConcurrentAdmitNeverExceedsBurst)
+{
+    ThrottleConfig config;
+    config.ratePerSec = 0.001;
+    config.burst = 100.0;
+    LogThrottle throttle(config);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&throttle]() {
+            for (int i = 0; i < 1000; ++i)
+            {
+                throttle.admit(Severity::WARN);
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    EXPECT_EQ(throttle.getCounters().admitted, 100u);
+    EXPECT_EQ(throttle.getCounters().rateLimited, 3900u);
+}
+
+// ============== Sampling ==============
+
+TEST(LogThrottleTest, OneInNSamplingAppliesToInfoOnly)
+{
+    ThrottleConfig config;
+    config.infoSampleEvery = 4;
+    LogThrottle throttle(config);
+
+    int infoAdmitted = 0;
+    int warnAdmitted = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        infoAdmitted += throttle.admit(Severity::INFO) ? 1 : 0;
+        warnAdmitted += throttle.admit(Severity::WARN) ? 1 : 0;
+    }
+
+    EXPECT_EQ(infoAdmitted, 25);
+    EXPECT_EQ(warnAdmitted, 100);
+    EXPECT_EQ(throttle.getCounters().sampledOut, 75u);
+}
+
+TEST(LogThrottleTest, ProbabilisticSamplingKeepsRoughShare)
+{
+    ThrottleConfig config;
+    config.infoSampleProbability = 0.25;
+    LogThrottle throttle(config);
+
+    int admitted = 0;
+    for (int i = 0; i < 20000; ++i)
+    {
+        admitted += throttle.admit(Severity::INFO) ? 1 : 0;
+    }
+
+    EXPECT_GT(admitted, 4000);
+    EXPECT_LT(admitted, 6000);
+}
+
+// ============== AsyncLogManager Registry ==============
+
+TEST(LogThrottleTest, ManagerAdmitsUnknownSources)
+{
+    AsyncLogManager manager("TestApp", {}, 10);
+
+    EXPECT_EQ(manager.getThrottle("CPU"), nullptr);
+    EXPECT_TRUE(manager.admit("CPU", Severity::INFO));
+}
+
+TEST(LogThrottleTest, ManagerAppliesPerSourceLimits)
+{
+    AsyncLogManager manager("TestApp", {}, 10);
+
+    ThrottleConfig config;
+    config.infoSampleEvery = 2;
+    manager.setThrottle("CPU", config);
+
+    EXPECT_TRUE(manager.admit("CPU", Severity::INFO));
+    EXPECT_FALSE(manager.admit("CPU", Severity::INFO));
+    EXPECT_TRUE(manager.admit("RAM", Severity::INFO));
+    EXPECT_TRUE(manager.admit("RAM", Severity::INFO));
+
+    auto counters = manager.getThrottleCounters();
+    ASSERT_EQ(counters.count("CPU"), 1u);
+    EXPECT_EQ(counters["CPU"].sampledOut, 1u);
+    EXPECT_EQ(counters.count("RAM"), 0u);
+}
+
+} // namespace test
+} // namespace async_logging
@@ -0,0 +1,262 @@
+#include <gtest/gtest.h>
+#include "inc/AsyncLogging/PriorityLaneBuffer.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace async_logging
+{
+namespace test
+{
+
+// ============== Ordering Tests ==============
+
+TEST(PriorityLaneBufferTest, HighestLaneIsDrainedFirst)
+{
+    PriorityLaneBuffer<int> buffer(3, 10, 0, 100);
+
+    buffer.push(20, 2);
+    buffer.push(21, 2);
+    buffer.push(10, 1);
+    buffer.push(0, 0);
+
+    EXPECT_EQ(buffer.pop().value(), 0);
+    EXPECT_EQ(buffer.pop().value(), 10);
+    EXPECT_EQ(buffer.pop().value(), 20);
+    EXPECT_EQ(buffer.pop().value(), 21);
+}
+
+TEST(PriorityLaneBufferTest, LanesAreFifo)
+{
+    PriorityLaneBuffer<int> buffer(2, 10, 0, 100);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        buffer.push(i, 1);
+    }
+
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(buffer.pop().value(), i);
+    }
+}
+
+TEST(PriorityLaneBufferTest, StarvationGuardServesLowerLane)
+{
+    PriorityLaneBuffer<int> buffer(2, 20, 0, 3);
+
+    buffer.push(100, 1);
+    for (int i = 0; i < 10; ++i)
+    {
+        buffer.push(i, 0);
+    }
+
+    std::vector<int> order;
+    for (int i = 0; i < 11; ++i)
+    {
+        order.push_back(buffer.pop().value());
+    }
+
+    // Lower lane is passed over 3 times, then served
+    EXPECT_EQ(order[0], 0);
+    EXPECT_EQ(order[1], 1);
+    EXPECT_EQ(order[2], 2);
+    EXPECT_EQ(order[3], 100);
+    EXPECT_EQ(order[4], 3);
+}
+
+// ============== Capacity Tests ==============
+
+TEST(PriorityLaneBufferTest, ReservedSlotsOnlyForTopLane)
+{
+    PriorityLaneBuffer<int> buffer(2, 4, 1, 100);
+
+    EXPECT_TRUE(buffer.push(1, 1));
+    EXPECT_TRUE(buffer.push(2, 1));
+    EXPECT_TRUE(buffer.push(3, 1));
+
+    // Lower lane is now blocked, top lane still has the reserved slot
+    std::atomic<bool> lowerPushed{false};
+    std::thread producer([&buffer, &lowerPushed]() {
+        buffer.push(4, 1);
+        lowerPushed.store(true);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(lowerPushed.load());
+
+    EXPECT_TRUE(buffer.push(0, 0));
+    EXPECT_EQ(buffer.size(), 4u);
+
+    EXPECT_EQ(buffer.pop().value(), 0);
+    EXPECT_EQ(buffer.pop().value(), 1);
+
+    producer.join();
+    EXPECT_TRUE(lowerPushed.load());
+}
+
+TEST(PriorityLaneBufferTest, PushToAllLanesOrdersBehindQueuedItems)
+{
+    PriorityLaneBuffer<int> buffer(3, 10, 0, 100);
+
+    buffer.push(1, 2);
+    buffer.push(2, 0);
+    buffer.pushToAllLanes(-1);
+    buffer.push(3, 0);
+
+    EXPECT_EQ(buffer.laneSize(0), 3u);
+    EXPECT_EQ(buffer.laneSize(1), 1u);
+    EXPECT_EQ(buffer.laneSize(2), 2u);
+
+    EXPECT_EQ(buffer.pop().value(), 2);
+    EXPECT_EQ(buffer.pop().value(), -1);
+    EXPECT_EQ(buffer.pop().value(), 3);
+}
+
+TEST(PriorityLaneBufferTest, PushToAllLanesCountsAgainstCapacity)
+{
+    PriorityLaneBuffer<int> buffer(3, 10, 2, 100);
+    for (int i = 0; i < 7; ++i)
+    {
+        ASSERT_TRUE(buffer.push(i, 2));
+    }
+
+    // Two copies on top of 7 would reach into the 2 reserved slots
+    std::atomic<bool> markerPushed{false};
+    std::thread flusher([&buffer, &markerPushed]() {
+        buffer.pushToAllLanes(-1);
+        markerPushed.store(true);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(markerPushed.load());
+    EXPECT_EQ(buffer.size(), 7u);
+
+    EXPECT_EQ(buffer.pop().value(), 0);
+    flusher.join();
+    EXPECT_EQ(buffer.size(), 9u);
+
+    // The reserve is intact: one more slot, for lane 0 only
+    EXPECT_TRUE(buffer.push(100, 0));
+    EXPECT_EQ(buffer.size(), 10u);
+}
+
+TEST(PriorityLaneBufferTest, PushToAllLanesForGivesUpAtDeadline)
+{
+    PriorityLaneBuffer<int> buffer(2, 4, 0, 100);
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(buffer.push(i, 1));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(buffer.pushToAllLanesFor(-1, start + std::chrono::milliseconds(30)));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(30));
+    EXPECT_EQ(buffer.size(), 3u); // nothing half-queued
+
+    buffer.pop();
+    EXPECT_TRUE(buffer.pushToAllLanesFor(-1, std::chrono::steady_clock::now() + std::chrono::milliseconds(30)));
+    EXPECT_EQ(buffer.size(), 4u);
+}
+
+TEST(PriorityLaneBufferTest, PushToAllLanesFitsSmallestBuffer)
+{
+    // Capacity below the lane count is raised, the reserve kept clear of
+    // what one marker needs
+    PriorityLaneBuffer<int> buffer(3, 2, 1, 100);
+    ASSERT_TRUE(buffer.pushToAllLanes(-1));
+    EXPECT_EQ(buffer.size(), 3u);
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(buffer.pop().value(), -1);
+    }
+}
+
+TEST(PriorityLaneBufferTest, PushBatchRoutesEachItemToItsLane)
+{
+    PriorityLaneBuffer<int> buffer(3, 10, 0, 100);
+
+    std::vector<int> items{20, 0, 21, 10};
+    auto laneOf = [](int item) { return static_cast<std::size_t>(item / 10); };
+
+    EXPECT_EQ(buffer.pushBatch(items.begin(), items.end(), laneOf), 4u);
+    EXPECT_EQ(buffer.laneSize(0), 1u);
+    EXPECT_EQ(buffer.laneSize(1), 1u);
+    EXPECT_EQ(buffer.laneSize(2), 2u);
+
+    EXPECT_EQ(buffer.pop().value(), 0);
+    EXPECT_EQ(buffer.pop().value(), 10);
+    EXPECT_EQ(buffer.pop().value(), 20);
+    EXPECT_EQ(buffer.pop().value(), 21);
+}
+
+TEST(PriorityLaneBufferTest, PushBatchLargerThanCapacityWaitsForConsumer)
+{
+    PriorityLaneBuffer<int> buffer(1, 4, 0, 10);
+
+    std::vector<int> items(100);
+    for (int i = 0; i < 100; ++i)
+    {
+        items[i] = i;
+    }
+
+    std::vector<int> consumed;
+    std::thread consumer([&buffer, &consumed]() {
+        while (consumed.size() < 100)
+        {
+            consumed.push_back(buffer.pop().value());
+        }
+    });
+
+    EXPECT_EQ(buffer.pushBatch(items.begin(), items.end(), [](int) { return std::size_t{0}; }), 100u);
+    consumer.join();
+
+    EXPECT_EQ(consumed, items);
+}
+
+TEST(PriorityLaneBufferTest, PushBatchStopsEarlyWhenStopped)
+{
+    PriorityLaneBuffer<int> buffer(1, 2, 0, 10);
+
+    std::vector<int> items{1, 2, 3, 4};
+    std::thread stopper([&buffer]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        buffer.stop();
+    });
+
+    EXPECT_EQ(buffer.pushBatch(items.begin(), items.end(), [](int) { return std::size_t{0}; }), 2u);
+    stopper.join();
+}
+
+// ============== Stop Tests ==============
+
+TEST(PriorityLaneBufferTest, StopWakesBlockedConsumer)
+{
+    PriorityLaneBuffer<int> buffer(3, 4, 1, 10);
+
+    std::thread consumer([&buffer]() {
+        EXPECT_FALSE(buffer.pop().has_value());
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    buffer.stop();
+    consumer.join();
+
+    EXPECT_TRUE(buffer.isStopped());
+    EXPECT_FALSE(buffer.push(1, 0));
+}
+
+TEST(PriorityLaneBufferTest, PopDrainsAfterStop)
+{
+    PriorityLaneBuffer<int> buffer(3, 4, 1, 10);
+
+    buffer.push(7, 2);
+    buffer.stop();
+
+    EXPECT_EQ(buffer.pop().value(), 7);
+    EXPECT_FALSE(buffer.pop().has_value());
+}
+
+} // namespace test
+} // namespace async_logging
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include "inc/AsyncLogging/ThreadConfig.hpp"
+#include "inc/AsyncLogging/ThreadPool.hpp"
+#include <pthread.h>
+#include <sched.h>
+#include <string>
+#include <thread>
+
+namespace async_logging
+{
+namespace test
+{
+
+static std::string currentThreadName()
+{
+    char name[16] = {};
+    pthread_getname_np(pthread_self(), name, sizeof(name));
+    return name;
+}
+
+// ============== applyThreadConfig Tests ==============
+
+TEST(ThreadConfigTest, DefaultConfigIsNoOp)
+{
+    ThreadConfig config;
+
+    EXPECT_TRUE(config.isDefault());
+    EXPECT_TRUE(applyThreadConfig(config));
+}
+
+TEST(ThreadConfigTest, NameIsAppliedWithSuffix)
+{
+    std::string observed;
+
+    std::thread t([&observed]() {
+        ThreadConfig config;
+        config.name = "tlm-test";
+        applyThreadConfig(config, "-7");
+        observed = currentThreadName();
+    });
+    t.join();
+
+    EXPECT_EQ(observed, "tlm-test-7");
+}
+
+TEST(ThreadConfigTest, LongNameIsTruncated)
+{
+    std::string observed;
+
+    std::thread t([&observed]() {
+        ThreadConfig config;
+        config.name = "a-very-long-thread-name";
+        EXPECT_TRUE(applyThreadConfig(config));
+        observed = currentThreadName();
+    });
+    t.join();
+
+    EXPECT_EQ(observed.size(), 15u);
+}
+
+TEST(ThreadConfigTest, PinsToAllowedCpu)
+{
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+
+    int firstCpu = -1;
+    for (int cpu = 0; cpu < CPU_SETSIZE && firstCpu < 0; ++cpu)
+    {
+        if (CPU_ISSET(cpu, &allowed))
+        {
+            firstCpu = cpu;
+        }
+    }
+    ASSERT_GE(firstCpu, 0);
+
+    bool applied = false;
+    int cpuCount = 0;
+
+    std::thread t([&]() {
+        ThreadConfig config;
+        config.cpus = {firstCpu};
+        applied = applyThreadConfig(config);
+
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        pthread_getaffinity_np(pthread_self(), sizeof(set), &set);
+        cpuCount = CPU_COUNT(&set);
+    });
+    t.join();
+
+    EXPECT_TRUE(applied);
+    EXPECT_EQ(cpuCount, 1);
+}
+
+TEST(ThreadConfigTest, InvalidCpuFailsGracefully)
+{
+    bool applied = true;
+
+    std::thread t([&applied]() {
+        ThreadConfig config;
+        config.cpus = {-1};
+        applied = applyThreadConfig(config);
+    });
+    t.join();
+
+    EXPECT_FALSE(applied);
+}
+
+TEST(ThreadConfigTest, BatchSchedulingAndNiceDoNotNeedPrivileges)
+{
+    bool applied = false;
+    int policy = -1;
+
+    std::thread t([&]() {
+        ThreadConfig config;
+        config.batchScheduling = true;
+        config.niceLevel = 19;  // Lowering priority is always permitted
+        applied = applyThreadConfig(config);
+
+        sched_param param{};
+        pthread_getschedparam(pthread_self(), &policy, &param);
+    });
+    t.join();
+
+    EXPECT_TRUE(applied);
+    EXPECT_EQ(policy, SCHED_BATCH);
+}
+
+// ============== ThreadPool Integration ==============
+
+TEST(ThreadConfigTest, ThreadPoolWorkersAreNamed)
+{
+    ThreadConfig config;
+    config.name = "pool";
+
+    ThreadPool pool(2, config);
+
+    auto name = pool.enqueue([]() { return currentThreadName(); });
+    std::string observed = name.get();
+
+    EXPECT_TRUE(observed == "pool-0" || observed == "pool-1");
+}
+
+} // namespace test
+} // namespace async_logging
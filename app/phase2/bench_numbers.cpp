@@ -0,0 +1,262 @@
+// Microbenchmark: bulk float parsing of delimited sample values.
+//
+// Parses one buffer of space/newline separated telemetry values ("17.25",
+// "-3", "1.5e3", ...) the way a socket or replay read delivers them:
+// std::stof on a copied token (what TelemetryApp::buildSample did),
+// strtof, from_chars per token, and NumberParser's parseFloats. Reports
+// ns per value and input MB/s; every method must agree on the sum.
+// The last two rows take the same values as separate records (socket
+// frames, ring records): scanFloat per record, and RecordValues, which
+// the batch paths of TelemetryApp use.
+// (libstdc++ 12 and later implement float from_chars with fast_float, so
+// that row is already a strong baseline.)
+//
+//   bazel run //app/phase2:bench_numbers -- [values] [rounds]
+
+#include "NumberParser.hpp"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using SmartDataHub::NumberBatch;
+using SmartDataHub::NumberStatus;
+
+namespace
+{
+    // Keeps the optimizer from dropping the parsed values
+    volatile double g_sink = 0.0;
+
+    // Mostly percentages and short gauges, some counters and exponents
+    std::string makeValues(size_t count)
+    {
+        std::mt19937 rng(42);
+        std::string text;
+        text.reserve(count * 8);
+        char buffer[32];
+        for (size_t i = 0; i < count; ++i)
+        {
+            unsigned kind = rng() % 10;
+            if (kind < 6)
+            {
+                std::snprintf(buffer, sizeof(buffer), "%.2f", static_cast<double>(rng() % 10000) / 100.0);
+            }
+            else if (kind < 8)
+            {
+                std::snprintf(buffer, sizeof(buffer), "%u", static_cast<unsigned>(rng() % 100000));
+            }
+            else if (kind < 9)
+            {
+                std::snprintf(buffer, sizeof(buffer), "-%.3f", static_cast<double>(rng() % 100000) / 1000.0);
+            }
+            else
+            {
+                std::snprintf(buffer, sizeof(buffer), "%.4e", static_cast<double>(rng()));
+            }
+            text += buffer;
+            text += i % 16 == 15 ? '\n' : ' ';
+        }
+        return text;
+    }
+
+    bool isDelimiter(char c)
+    {
+        return c == ' ' || c == '\n';
+    }
+
+    double sumStof(const std::string &text)
+    {
+        double sum = 0.0;
+        size_t pos = 0;
+        while (pos < text.size())
+        {
+            size_t end = pos;
+            while (end < text.size() && !isDelimiter(text[end]))
+            {
+                ++end;
+            }
+            try
+            {
+                sum += std::stof(text.substr(pos, end - pos));
+            }
+            catch (const std::exception &)
+            {
+            }
+            pos = end + 1;
+        }
+        return sum;
+    }
+
+    double sumStrtof(const std::string &text)
+    {
+        double sum = 0.0;
+        const char *pos = text.c_str();
+        char *end = nullptr;
+        while (true)
+        {
+            float value = std::strtof(pos, &end);
+            if (end == pos)
+            {
+                break;
+            }
+            sum += value;
+            pos = end;
+        }
+        return sum;
+    }
+
+    double sumFromChars(const std::string &text)
+    {
+        double sum = 0.0;
+        const char *pos = text.data();
+        const char *end = pos + text.size();
+        while (pos < end)
+        {
+            float value = 0.0f;
+            auto result = std::from_chars(pos, end, value);
+            if (result.ec == std::errc())
+            {
+                sum += value;
+            }
+            pos = result.ptr;
+            while (pos < end && isDelimiter(*pos))
+            {
+                ++pos;
+            }
+        }
+        return sum;
+    }
+
+    double sumBulk(const std::string &text, std::vector<float> &values, std::vector<NumberStatus> &status)
+    {
+        double sum = 0.0;
+        std::string_view rest = text;
+        while (!rest.empty())
+        {
+            NumberBatch batch = SmartDataHub::parseFloats(rest, values.data(), status.data(), values.size());
+            for (size_t i = 0; i < batch.count; ++i)
+            {
+                sum += values[i];
+            }
+            rest.remove_prefix(batch.consumed);
+            if (batch.count < values.size())
+            {
+                break;
+            }
+        }
+        return sum;
+    }
+
+    std::vector<std::string_view> splitRecords(const std::string &text)
+    {
+        std::vector<std::string_view> records;
+        size_t pos = 0;
+        while (pos < text.size())
+        {
+            size_t end = pos;
+            while (end < text.size() && !isDelimiter(text[end]))
+            {
+                ++end;
+            }
+            records.emplace_back(text.data() + pos, end - pos);
+            pos = end + 1;
+        }
+        return records;
+    }
+
+    double sumScanPerRecord(const std::vector<std::string_view> &records)
+    {
+        double sum = 0.0;
+        for (std::string_view record : records)
+        {
+            const char *pos = record.data();
+            float value = 0.0f;
+            if (SmartDataHub::scanFloat(pos, record.data() + record.size(), value) == NumberStatus::Ok)
+            {
+                sum += value;
+            }
+        }
+        return sum;
+    }
+
+    double sumRecordValues(const std::vector<std::string_view> &records, SmartDataHub::RecordValues &values)
+    {
+        // A read's worth of records at a time
+        constexpr size_t BatchRecords = 4096;
+        double sum = 0.0;
+        for (size_t first = 0; first < records.size(); first += BatchRecords)
+        {
+            size_t last = std::min(records.size(), first + BatchRecords);
+            values.clear();
+            for (size_t i = first; i < last; ++i)
+            {
+                values.add(records[i]);
+            }
+            values.parse();
+            for (size_t i = 0; i < values.size(); ++i)
+            {
+                sum += values.status(i) == NumberStatus::Ok ? values.value(i) : 0.0f;
+            }
+        }
+        return sum;
+    }
+
+    template <typename Fn>
+    double secondsPerRound(int rounds, Fn &&fn)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < rounds; ++i)
+        {
+            g_sink = fn();
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double>(elapsed).count() / rounds;
+    }
+
+    void report(const char *name, double seconds, size_t values, size_t bytes, double sum)
+    {
+        std::cout << "  " << std::left << std::setw(22) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(8) << seconds * 1e9 / static_cast<double>(values) << " ns/value" << std::setw(10)
+                  << static_cast<double>(bytes) / seconds / 1e6 << " MB/s" << "   sum " << std::setprecision(0)
+                  << sum << std::endl;
+    }
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    int rounds = argc > 2 ? std::atoi(argv[2]) : 10;
+
+    std::string text = makeValues(count);
+    std::cout << count << " values, " << text.size() << " bytes, " << rounds << " rounds" << std::endl;
+
+    // One read's worth of values at a time, as a source would parse them
+    std::vector<float> values(4096);
+    std::vector<NumberStatus> status(values.size());
+
+    double sum = 0.0;
+    double seconds = secondsPerRound(rounds, [&] { return sum = sumStof(text); });
+    report("std::stof (copy)", seconds, count, text.size(), sum);
+    seconds = secondsPerRound(rounds, [&] { return sum = sumStrtof(text); });
+    report("strtof", seconds, count, text.size(), sum);
+    seconds = secondsPerRound(rounds, [&] { return sum = sumFromChars(text); });
+    report("from_chars per token", seconds, count, text.size(), sum);
+    seconds = secondsPerRound(rounds, [&] { return sum = sumBulk(text, values, status); });
+    report("parseFloats (bulk)", seconds, count, text.size(), sum);
+
+    std::vector<std::string_view> records = splitRecords(text);
+    SmartDataHub::RecordValues recordValues;
+    seconds = secondsPerRound(rounds, [&] { return sum = sumScanPerRecord(records); });
+    report("scanFloat per record", seconds, count, text.size(), sum);
+    seconds = secondsPerRound(rounds, [&] { return sum = sumRecordValues(records, recordValues); });
+    report("RecordValues", seconds, count, text.size(), sum);
+
+    return 0;
+}
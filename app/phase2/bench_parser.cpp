@@ -0,0 +1,175 @@
+// Microbenchmark: /proc/stat and /proc/meminfo parsing.
+//
+// Compares the original istringstream parser, the per-field from_chars
+// parser that replaced it, and the ProcScan scanners TelemetryParser now
+// uses, on one snapshot of this machine's files (no I/O in the loop). The
+// full meminfo pass (MemInfo.hpp perfect hash) is measured as well, with
+// its cost per line and relative to the two-field scan: it reads every
+// line where MemTotal + MemAvailable stop after the third, so expect
+// tens of times the two-field cost, not parity.
+//
+//   bazel run //app/phase2:bench_parser -- [iterations]
+
+#include "TelemetryParser.hpp"
+#include "ProcScan.hpp"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+using SmartDataHub::TelemetryParser;
+
+namespace
+{
+    // Keeps the optimizer from dropping the parsed values
+    volatile uint64_t g_sink = 0;
+
+    std::string readFile(const char *path)
+    {
+        std::ifstream in(path);
+        std::ostringstream content;
+        content << in.rdbuf();
+        return content.str();
+    }
+
+    // Original: istringstream + operator>> per sample
+    bool cpuIstream(const std::string &line, TelemetryParser::CpuStats &stats)
+    {
+        std::istringstream iss(line);
+        std::string label;
+        unsigned long long v[8];
+        iss >> label >> v[0] >> v[1] >> v[2] >> v[3] >> v[4] >> v[5] >> v[6] >> v[7];
+        stats.user = v[0];
+        stats.idle = v[3];
+        return !iss.fail();
+    }
+
+    bool memIstream(const std::string &content, uint64_t &total, uint64_t &available)
+    {
+        std::istringstream lines(content);
+        std::string line;
+        bool foundTotal = false;
+        bool foundAvailable = false;
+        while (std::getline(lines, line) && !(foundTotal && foundAvailable))
+        {
+            if (line.find("MemTotal:") == 0)
+            {
+                std::istringstream iss(line);
+                std::string label;
+                iss >> label >> total;
+                foundTotal = true;
+            }
+            else if (line.find("MemAvailable:") == 0)
+            {
+                std::istringstream iss(line);
+                std::string label;
+                iss >> label >> available;
+                foundAvailable = true;
+            }
+        }
+        return foundTotal && foundAvailable;
+    }
+
+    // Previous: find_first_not_of + from_chars per field
+    bool nextNumber(std::string_view &text, uint64_t &value)
+    {
+        std::size_t start = text.find_first_not_of(' ');
+        if (start == std::string_view::npos)
+        {
+            return false;
+        }
+        auto result = std::from_chars(text.data() + start, text.data() + text.size(), value);
+        if (result.ec != std::errc())
+        {
+            return false;
+        }
+        text.remove_prefix(static_cast<std::size_t>(result.ptr - text.data()));
+        return true;
+    }
+
+    bool cpuFromChars(std::string_view line, TelemetryParser::CpuStats &stats)
+    {
+        line.remove_prefix(line.find(' '));
+        return nextNumber(line, stats.user) && nextNumber(line, stats.nice) && nextNumber(line, stats.system) &&
+               nextNumber(line, stats.idle) && nextNumber(line, stats.iowait) && nextNumber(line, stats.irq) &&
+               nextNumber(line, stats.softirq) && nextNumber(line, stats.steal);
+    }
+
+    template <typename Fn>
+    double nanosPerCall(int iterations, Fn &&fn)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i)
+        {
+            fn();
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+    }
+
+    void report(const char *name, double nanos)
+    {
+        std::cout << "  " << std::left << std::setw(28) << name << std::right << std::setw(10)
+                  << std::fixed << std::setprecision(1) << nanos << " ns/op" << std::endl;
+    }
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 1000000;
+
+    std::string stat = readFile("/proc/stat");
+    std::string meminfo = readFile("/proc/meminfo");
+    std::string cpuLine = stat.substr(0, stat.find('\n'));
+    std::cout << "cpu line: " << cpuLine << std::endl;
+
+    TelemetryParser::CpuStats stats;
+    uint64_t total = 0;
+    uint64_t available = 0;
+
+    std::cout << "/proc/stat aggregate line (" << iterations << " iterations)" << std::endl;
+    report("istringstream", nanosPerCall(iterations, [&] {
+               cpuIstream(cpuLine, stats);
+               g_sink = stats.idle;
+           }));
+    report("from_chars per field", nanosPerCall(iterations, [&] {
+               cpuFromChars(cpuLine, stats);
+               g_sink = stats.idle;
+           }));
+    report("ProcScan (SWAR)", nanosPerCall(iterations, [&] {
+               TelemetryParser::parseCpuLine(cpuLine, stats);
+               g_sink = stats.idle;
+           }));
+
+    std::cout << "/proc/meminfo MemTotal + MemAvailable" << std::endl;
+    report("istringstream", nanosPerCall(iterations, [&] {
+               memIstream(meminfo, total, available);
+               g_sink = available;
+           }));
+    double twoFields = nanosPerCall(iterations, [&] {
+        TelemetryParser::parseMemInfo(meminfo, total, available);
+        g_sink = available;
+    });
+    report("ProcScan", twoFields);
+
+    SmartDataHub::MemInfo info;
+    std::cout << "/proc/meminfo every known field, one pass" << std::endl;
+    double allFields = nanosPerCall(iterations, [&] {
+        TelemetryParser::parseMemInfoFields(meminfo, SmartDataHub::AllMemFields, info);
+        g_sink = info.found;
+    });
+    report("ProcScan (perfect hash)", allFields);
+    std::size_t lines = static_cast<std::size_t>(std::count(meminfo.begin(), meminfo.end(), '\n'));
+    report("  per line", allFields / static_cast<double>(lines == 0 ? 1 : lines));
+    std::cout << "  " << std::fixed << std::setprecision(0) << allFields / twoFields
+              << "x MemTotal + MemAvailable (" << lines << " lines)" << std::endl;
+
+    return 0;
+}
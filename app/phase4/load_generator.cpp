@@ -0,0 +1,864 @@
+// Synthetic telemetry load generator.
+//
+// Produces samples for N sources at a target total rate (1/s to millions
+// per second) and writes them where the pipeline reads them:
+//
+//   file     one file per source, rewritten in place (FILE sources)
+//   socket   Unix socket per path (SOCKET sources): DGRAM/SEQPACKET with
+//            sendmmsg(), STREAM newline-framed; for STREAM/SEQPACKET the
+//            generator listens and the app connects
+//   manager  straight into an in-process AsyncLogManager (null sink, or a
+//            FileSinkImpl with --path)
+//   trace    a replay trace for REPLAY sources, written at once
+//
+// Pacing is against absolute deadlines (sample k of a thread is due at
+// start + k / rate), with clock_nanosleep(TIMER_ABSTIME) and 1 ns timer
+// slack; whatever is due when a thread wakes goes out as one batch, so
+// rates above the sleep resolution are kept too. A slow destination is
+// not hidden: writes block, and the report shows the achieved rate and
+// how far behind schedule the generator fell.
+//
+// "{i}" in --path is replaced by the source index.
+//
+//   bazel run //app/phase4:load_generator -- --sink socket --path /tmp/telemetry.sock --rate 200000
+//   bazel run //app/phase4:load_generator -- --sink manager --sources 8 --rate 2000000 --threads 4
+
+#include "inc/AsyncLogging/AsyncLogManager.hpp"
+#include "inc/logging/FileSinkImpl.hpp"
+#include "inc/logging/LogMessage.hpp"
+#include "inc/SmartDataHub/SafeSocket.hpp"
+
+#include <sys/prctl.h>
+#include <sys/socket.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::atomic<bool> g_running{true};
+
+    void signalHandler(int)
+    {
+        g_running = false;
+    }
+
+    enum class SinkKind
+    {
+        File,
+        Socket,
+        Manager,
+        Trace
+    };
+
+    enum class Distribution
+    {
+        Uniform, // 0-100
+        Normal,  // mean 50, sd 15, clamped
+        Sine,    // 50 +- 40 over 10 s, phase per source, +-3 noise
+        Spike    // 15-25, 1% of samples 90-100
+    };
+
+    struct Options
+    {
+        SinkKind sink = SinkKind::File;
+        std::string path;
+        SmartDataHub::SocketKind socketKind = SmartDataHub::SocketKind::Datagram;
+        Distribution distribution = Distribution::Uniform;
+        std::size_t sources = 3;
+        double rate = 1000.0; // samples/s over all sources
+        double durationSec = 10.0;
+        std::size_t threads = 0; // 0: one per source, up to the core count
+        std::size_t maxBatch = 1024;
+        int connectWaitMs = 5000;
+        int reportMs = 1000;
+    };
+
+    void printUsage(const char *program)
+    {
+        std::cout << "Usage: " << program << " [options]\n"
+                  << "  --sink file|socket|manager|trace   destination (default file)\n"
+                  << "  --path P            file/socket/trace path, \"{i}\" = source index;\n"
+                  << "                      manager: FileSinkImpl path (default: null sink)\n"
+                  << "  --socket-type dgram|seqpacket|stream   (default dgram)\n"
+                  << "  --dist uniform|normal|sine|spike       (default uniform)\n"
+                  << "  --sources N         (default 3)\n"
+                  << "  --rate R            samples/s over all sources (default 1000)\n"
+                  << "  --duration S        seconds (default 10)\n"
+                  << "  --threads T         generator threads (default min(sources, cores))\n"
+                  << "  --batch B           most samples per write call (default 1024)\n"
+                  << "  --connect-wait-ms M STREAM/SEQPACKET: wait for the app to connect (default 5000)\n"
+                  << "  --report-ms M       progress interval, 0 = off (default 1000)\n";
+    }
+
+    bool parseOptions(int argc, char **argv, Options &options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string key = argv[i];
+            if (key == "--help" || key == "-h")
+            {
+                return false;
+            }
+            if (i + 1 >= argc)
+            {
+                std::cerr << "Missing value for " << key << std::endl;
+                return false;
+            }
+            std::string value = argv[++i];
+
+            try
+            {
+                if (key == "--sink")
+                {
+                    static const std::map<std::string, SinkKind> kinds{
+                        {"file", SinkKind::File}, {"socket", SinkKind::Socket},
+                        {"manager", SinkKind::Manager}, {"trace", SinkKind::Trace}};
+                    options.sink = kinds.at(value);
+                }
+                else if (key == "--socket-type")
+                {
+                    static const std::map<std::string, SmartDataHub::SocketKind> kinds{
+                        {"dgram", SmartDataHub::SocketKind::Datagram},
+                        {"seqpacket", SmartDataHub::SocketKind::SeqPacket},
+                        {"stream", SmartDataHub::SocketKind::Stream}};
+                    options.socketKind = kinds.at(value);
+                }
+                else if (key == "--dist")
+                {
+                    static const std::map<std::string, Distribution> kinds{
+                        {"uniform", Distribution::Uniform}, {"normal", Distribution::Normal},
+                        {"sine", Distribution::Sine}, {"spike", Distribution::Spike}};
+                    options.distribution = kinds.at(value);
+                }
+                else if (key == "--path")
+                {
+                    options.path = value;
+                }
+                else if (key == "--sources")
+                {
+                    options.sources = std::stoul(value);
+                }
+                else if (key == "--rate")
+                {
+                    options.rate = std::stod(value);
+                }
+                else if (key == "--duration")
+                {
+                    options.durationSec = std::stod(value);
+                }
+                else if (key == "--threads")
+                {
+                    options.threads = std::stoul(value);
+                }
+                else if (key == "--batch")
+                {
+                    options.maxBatch = std::stoul(value);
+                }
+                else if (key == "--connect-wait-ms")
+                {
+                    options.connectWaitMs = std::stoi(value);
+                }
+                else if (key == "--report-ms")
+                {
+                    options.reportMs = std::stoi(value);
+                }
+                else
+                {
+                    std::cerr << "Unknown option " << key << std::endl;
+                    return false;
+                }
+            }
+            catch (const std::exception &)
+            {
+                std::cerr << "Bad value for " << key << ": " << value << std::endl;
+                return false;
+            }
+        }
+
+        if (options.sources == 0 || options.rate <= 0.0 || options.durationSec <= 0.0 || options.maxBatch == 0)
+        {
+            std::cerr << "--sources, --rate, --duration and --batch must be positive" << std::endl;
+            return false;
+        }
+        if (options.path.empty())
+        {
+            if (options.sink == SinkKind::File)
+            {
+                options.path = "/tmp/load_telemetry_{i}.txt";
+            }
+            else if (options.sink == SinkKind::Socket)
+            {
+                options.path = "/tmp/telemetry.sock";
+            }
+            else if (options.sink == SinkKind::Trace)
+            {
+                options.path = "/tmp/load_telemetry.trace";
+            }
+        }
+        if (options.threads == 0)
+        {
+            std::size_t cores = std::max(1u, std::thread::hardware_concurrency());
+            options.threads = std::min(options.sources, cores);
+        }
+        options.threads = std::min(options.threads, options.sources);
+        return true;
+    }
+
+    std::string pathFor(const std::string &pattern, std::size_t source)
+    {
+        std::string path = pattern;
+        std::size_t at = path.find("{i}");
+        if (at != std::string::npos)
+        {
+            path.replace(at, 3, std::to_string(source));
+        }
+        return path;
+    }
+
+    // "0".."100", with and without the newline, built once
+    struct ValueText
+    {
+        std::string lines[101];
+
+        ValueText()
+        {
+            for (int value = 0; value <= 100; ++value)
+            {
+                lines[value] = std::to_string(value) + "\n";
+            }
+        }
+
+        std::string_view line(uint8_t value) const { return lines[value]; }
+        std::string_view bare(uint8_t value) const { return std::string_view(lines[value]).substr(0, lines[value].size() - 1); }
+    };
+
+    const ValueText g_text;
+
+    class ValueGenerator
+    {
+    public:
+        ValueGenerator(Distribution distribution, uint64_t seed) : m_distribution{distribution}, m_random{seed} {}
+
+        uint8_t next(std::size_t source, double seconds)
+        {
+            double value = 0.0;
+            switch (m_distribution)
+            {
+            case Distribution::Uniform:
+                return static_cast<uint8_t>(std::uniform_int_distribution<int>(0, 100)(m_random));
+            case Distribution::Normal:
+                value = std::normal_distribution<double>(50.0, 15.0)(m_random);
+                break;
+            case Distribution::Sine:
+            {
+                constexpr double Pi = 3.14159265358979323846;
+                double phase = static_cast<double>(source) * 0.37;
+                value = 50.0 + 40.0 * std::sin(2.0 * Pi * (seconds / 10.0 + phase)) +
+                        std::uniform_real_distribution<double>(-3.0, 3.0)(m_random);
+                break;
+            }
+            case Distribution::Spike:
+                if (std::uniform_int_distribution<int>(0, 99)(m_random) == 0)
+                {
+                    return static_cast<uint8_t>(std::uniform_int_distribution<int>(90, 100)(m_random));
+                }
+                return static_cast<uint8_t>(std::uniform_int_distribution<int>(15, 25)(m_random));
+            }
+            return static_cast<uint8_t>(std::lround(std::min(100.0, std::max(0.0, value))));
+        }
+
+    private:
+        Distribution m_distribution;
+        std::mt19937_64 m_random;
+    };
+
+    struct Sample
+    {
+        uint32_t source;
+        uint8_t value;
+    };
+
+    // One destination per generator thread; returns how many samples of
+    // the batch were delivered
+    class SampleWriter
+    {
+    public:
+        virtual ~SampleWriter() = default;
+        virtual std::size_t write(const std::vector<Sample> &batch) = 0;
+    };
+
+    class FileWriter : public SampleWriter
+    {
+    public:
+        explicit FileWriter(std::map<uint32_t, int> fds) : m_fds{std::move(fds)} {}
+        ~FileWriter() override
+        {
+            for (auto &[source, fd] : m_fds)
+            {
+                close(fd);
+            }
+        }
+
+        std::size_t write(const std::vector<Sample> &batch) override
+        {
+            std::size_t written = 0;
+            for (const Sample &sample : batch)
+            {
+                // Fixed width, so a rewrite never leaves a longer old value
+                char line[4] = {' ', ' ', ' ', '\n'};
+                std::string_view digits = g_text.bare(sample.value);
+                std::memcpy(line + 3 - digits.size(), digits.data(), digits.size());
+                if (pwrite(m_fds[sample.source], line, sizeof(line), 0) == static_cast<ssize_t>(sizeof(line)))
+                {
+                    ++written;
+                }
+            }
+            return written;
+        }
+
+    private:
+        std::map<uint32_t, int> m_fds;
+    };
+
+    class SocketWriter : public SampleWriter
+    {
+    public:
+        // targetOf[source] indexes fds (connected sockets of this thread)
+        SocketWriter(SmartDataHub::SocketKind kind, std::vector<int> fds, std::vector<std::size_t> targetOf)
+            : m_kind{kind}, m_fds{std::move(fds)}, m_targetOf{std::move(targetOf)}, m_pending(m_fds.size())
+        {
+        }
+
+        std::size_t write(const std::vector<Sample> &batch) override
+        {
+            for (auto &pending : m_pending)
+            {
+                pending.clear();
+            }
+            for (const Sample &sample : batch)
+            {
+                m_pending[m_targetOf[sample.source]].push_back(sample.value);
+            }
+
+            std::size_t written = 0;
+            for (std::size_t target = 0; target < m_fds.size(); ++target)
+            {
+                if (!m_pending[target].empty())
+                {
+                    written += m_kind == SmartDataHub::SocketKind::Stream ? writeStream(target) : writeMessages(target);
+                }
+            }
+            return written;
+        }
+
+    private:
+        SmartDataHub::SocketKind m_kind;
+        std::vector<int> m_fds;
+        std::vector<std::size_t> m_targetOf;
+        std::vector<std::vector<uint8_t>> m_pending; // values per target
+        std::vector<mmsghdr> m_messages;
+        std::vector<iovec> m_iovecs;
+        std::string m_stream;
+
+        // One sample per message, all in sendmmsg() calls
+        std::size_t writeMessages(std::size_t target)
+        {
+            const auto &values = m_pending[target];
+            m_messages.assign(values.size(), mmsghdr{});
+            m_iovecs.resize(values.size());
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                std::string_view text = g_text.bare(values[i]);
+                m_iovecs[i].iov_base = const_cast<char *>(text.data());
+                m_iovecs[i].iov_len = text.size();
+                m_messages[i].msg_hdr.msg_iov = &m_iovecs[i];
+                m_messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            std::size_t sent = 0;
+            while (sent < values.size())
+            {
+                int count = sendmmsg(m_fds[target], m_messages.data() + sent,
+                                     static_cast<unsigned>(values.size() - sent), 0);
+                if (count < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+                    break;
+                }
+                sent += static_cast<std::size_t>(count);
+            }
+            return sent;
+        }
+
+        // Newline framed, one write for the batch
+        std::size_t writeStream(std::size_t target)
+        {
+            m_stream.clear();
+            for (uint8_t value : m_pending[target])
+            {
+                m_stream.append(g_text.line(value));
+            }
+
+            std::size_t offset = 0;
+            while (offset < m_stream.size())
+            {
+                ssize_t bytes = send(m_fds[target], m_stream.data() + offset, m_stream.size() - offset, MSG_NOSIGNAL);
+                if (bytes < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+                    return 0;
+                }
+                offset += static_cast<std::size_t>(bytes);
+            }
+            return m_pending[target].size();
+        }
+    };
+
+    // Drops every message; measures the manager itself
+    class NullSink : public logging::ILogSink
+    {
+    public:
+        void write(const logging::LogMessage &) override { m_count.fetch_add(1, std::memory_order_relaxed); }
+        uint64_t getCount() const { return m_count.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<uint64_t> m_count{0};
+    };
+
+    class ManagerWriter : public SampleWriter
+    {
+    public:
+        ManagerWriter(async_logging::AsyncLogManager &manager, const std::vector<std::string> &names)
+            : m_manager{manager}, m_names{names}
+        {
+        }
+
+        std::size_t write(const std::vector<Sample> &batch) override
+        {
+            m_messages.clear();
+            for (const Sample &sample : batch)
+            {
+                m_messages.emplace_back(m_names[sample.source], logging::Context::CPU, sample.value);
+            }
+            return m_manager.logBatch(m_messages);
+        }
+
+    private:
+        async_logging::AsyncLogManager &m_manager;
+        const std::vector<std::string> &m_names;
+        std::vector<logging::LogMessage> m_messages;
+    };
+
+    struct LaneStats
+    {
+        std::atomic<uint64_t> generated{0};
+        std::atomic<uint64_t> written{0};
+        std::atomic<uint64_t> maxLagNs{0};
+    };
+
+    // One generator thread: its sources, its share of the rate
+    struct Lane
+    {
+        std::vector<uint32_t> sources;
+        double rate = 0.0;
+        std::unique_ptr<SampleWriter> writer;
+        LaneStats stats;
+    };
+
+    void sleepUntil(Clock::time_point deadline)
+    {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+        timespec spec{static_cast<time_t>(ns / 1000000000), static_cast<long>(ns % 1000000000)};
+        // steady_clock is CLOCK_MONOTONIC
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &spec, nullptr) == EINTR && g_running)
+        {
+        }
+    }
+
+    void runLane(Lane &lane, const Options &options, Clock::time_point start, Clock::time_point end, uint64_t seed)
+    {
+        // Wake-ups land on the deadline, not up to 50 us after it
+        prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL);
+
+        ValueGenerator values(options.distribution, seed);
+        std::vector<Sample> batch;
+        batch.reserve(options.maxBatch);
+        const double nsPerSample = 1e9 / lane.rate;
+        const uint64_t total = static_cast<uint64_t>(lane.rate * options.durationSec);
+        uint64_t sent = 0;
+        std::size_t nextSource = 0;
+
+        sleepUntil(start);
+        while (g_running && sent < total)
+        {
+            Clock::time_point now = Clock::now();
+            if (now >= end)
+            {
+                break;
+            }
+            double elapsedNs = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - start).count());
+            uint64_t due = std::min(total, static_cast<uint64_t>(elapsedNs / nsPerSample) + 1);
+            if (due <= sent)
+            {
+                // Short sleeps keep Ctrl+C responsive at low rates
+                auto next = start + std::chrono::nanoseconds(static_cast<int64_t>(static_cast<double>(sent) * nsPerSample));
+                sleepUntil(std::min(next, now + std::chrono::milliseconds(100)));
+                continue;
+            }
+
+            uint64_t lagNs = static_cast<uint64_t>(std::max(0.0, elapsedNs - static_cast<double>(sent) * nsPerSample));
+            if (lagNs > lane.stats.maxLagNs.load(std::memory_order_relaxed))
+            {
+                lane.stats.maxLagNs.store(lagNs, std::memory_order_relaxed);
+            }
+
+            std::size_t count = static_cast<std::size_t>(std::min<uint64_t>(due - sent, options.maxBatch));
+            double seconds = elapsedNs / 1e9;
+            batch.clear();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                uint32_t source = lane.sources[nextSource];
+                nextSource = nextSource + 1 == lane.sources.size() ? 0 : nextSource + 1;
+                batch.push_back({source, values.next(source, seconds)});
+            }
+
+            std::size_t written = lane.writer->write(batch);
+            sent += count;
+            lane.stats.generated.store(sent, std::memory_order_relaxed);
+            lane.stats.written.fetch_add(written, std::memory_order_relaxed);
+        }
+    }
+
+    // Not paced: the trace carries the timing for REPLAY sources
+    int writeTrace(const Options &options)
+    {
+        std::ofstream out(options.path, std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            std::cerr << "Cannot write " << options.path << std::endl;
+            return 1;
+        }
+
+        ValueGenerator values(options.distribution, 1);
+        const uint64_t total = static_cast<uint64_t>(options.rate * options.durationSec);
+        std::string chunk;
+        for (uint64_t i = 0; i < total && g_running; ++i)
+        {
+            double seconds = static_cast<double>(i) / options.rate;
+            chunk += std::to_string(static_cast<uint64_t>(seconds * 1e6));
+            chunk += ' ';
+            chunk += g_text.line(values.next(i % options.sources, seconds));
+            if (chunk.size() > 1 << 16)
+            {
+                out << chunk;
+                chunk.clear();
+            }
+        }
+        out << chunk;
+        std::cout << "Wrote " << total << " samples (" << options.durationSec << " s at " << options.rate
+                  << "/s) to " << options.path << std::endl;
+        return out ? 0 : 1;
+    }
+
+    // SafeSocket sockets are non-blocking; the generator should wait for a
+    // slow reader rather than drop
+    void setBlocking(int fd)
+    {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_NONBLOCK);
+    }
+
+    // Listens on each path until the app connects (STREAM/SEQPACKET)
+    bool acceptTargets(const Options &options, std::vector<std::string> &paths,
+                       std::vector<SmartDataHub::SafeSocket> &connections)
+    {
+        std::vector<SmartDataHub::SafeSocket> listeners(paths.size());
+        connections.resize(paths.size());
+        for (std::size_t i = 0; i < paths.size(); ++i)
+        {
+            unlink(paths[i].c_str());
+            if (!listeners[i].createSocket(options.socketKind) || !listeners[i].listenSocket(paths[i]))
+            {
+                std::cerr << "Cannot listen on " << paths[i] << std::endl;
+                return false;
+            }
+        }
+
+        std::cout << "Waiting for the app to connect to " << paths.size() << " socket(s)..." << std::endl;
+        auto deadline = Clock::now() + std::chrono::milliseconds(options.connectWaitMs);
+        std::size_t connected = 0;
+        while (connected < paths.size() && Clock::now() < deadline && g_running)
+        {
+            for (std::size_t i = 0; i < paths.size(); ++i)
+            {
+                if (!connections[i].isConnected() && listeners[i].acceptConnection(connections[i]))
+                {
+                    setBlocking(connections[i].getFd());
+                    ++connected;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        if (connected < paths.size())
+        {
+            std::cerr << "Only " << connected << " of " << paths.size() << " sockets connected" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    const char *sinkName(SinkKind sink)
+    {
+        switch (sink)
+        {
+        case SinkKind::File: return "file";
+        case SinkKind::Socket: return "socket";
+        case SinkKind::Manager: return "manager";
+        case SinkKind::Trace: return "trace";
+        }
+        return "?";
+    }
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::signal(SIGINT, signalHandler);
+    std::signal(SIGTERM, signalHandler);
+    std::signal(SIGPIPE, SIG_IGN);
+
+    if (options.sink == SinkKind::Trace)
+    {
+        return writeTrace(options);
+    }
+
+    // Sources on one socket path stay on one thread, so a stream is
+    // never written by two threads
+    std::vector<std::string> paths;
+    std::vector<std::size_t> pathOf(options.sources);
+    for (std::size_t source = 0; source < options.sources; ++source)
+    {
+        std::string path = pathFor(options.path, source);
+        auto found = std::find(paths.begin(), paths.end(), path);
+        pathOf[source] = static_cast<std::size_t>(found - paths.begin());
+        if (found == paths.end())
+        {
+            paths.push_back(path);
+        }
+    }
+    bool byPath = options.sink == SinkKind::Socket && options.socketKind != SmartDataHub::SocketKind::Datagram;
+    if (byPath)
+    {
+        options.threads = std::min(options.threads, paths.size());
+    }
+
+    std::vector<std::unique_ptr<Lane>> lanes;
+    for (std::size_t i = 0; i < options.threads; ++i)
+    {
+        lanes.push_back(std::make_unique<Lane>());
+    }
+    for (std::size_t source = 0; source < options.sources; ++source)
+    {
+        std::size_t lane = (byPath ? pathOf[source] : source) % options.threads;
+        lanes[lane]->sources.push_back(static_cast<uint32_t>(source));
+    }
+    for (auto &lane : lanes)
+    {
+        lane->rate = options.rate * static_cast<double>(lane->sources.size()) / static_cast<double>(options.sources);
+    }
+
+    // Destinations
+    std::vector<SmartDataHub::SafeSocket> connections;
+    std::vector<std::string> names;
+    std::shared_ptr<NullSink> nullSink;
+    std::unique_ptr<async_logging::AsyncLogManager> manager;
+
+    if (options.sink == SinkKind::File)
+    {
+        for (auto &lane : lanes)
+        {
+            std::map<uint32_t, int> fds;
+            for (uint32_t source : lane->sources)
+            {
+                int fd = open(pathFor(options.path, source).c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+                if (fd < 0)
+                {
+                    std::cerr << "Cannot open " << pathFor(options.path, source) << std::endl;
+                    return 1;
+                }
+                fds[source] = fd;
+            }
+            lane->writer = std::make_unique<FileWriter>(std::move(fds));
+        }
+    }
+    else if (options.sink == SinkKind::Socket)
+    {
+        if (byPath && !acceptTargets(options, paths, connections))
+        {
+            return 1;
+        }
+        for (auto &lane : lanes)
+        {
+            // Datagram sockets are per thread; connected ones are shared
+            // only by the sources of their path, all on this thread
+            std::vector<int> fds;
+            std::vector<std::size_t> targetOf(options.sources, 0);
+            std::map<std::size_t, std::size_t> targetOfPath;
+            for (uint32_t source : lane->sources)
+            {
+                std::size_t path = pathOf[source];
+                if (targetOfPath.count(path) == 0)
+                {
+                    targetOfPath[path] = fds.size();
+                    if (byPath)
+                    {
+                        fds.push_back(connections[path].getFd());
+                    }
+                    else
+                    {
+                        connections.emplace_back();
+                        SmartDataHub::SafeSocket &socket = connections.back();
+                        if (!socket.createSocket(SmartDataHub::SocketKind::Datagram) ||
+                            !socket.connectSocket(paths[path]))
+                        {
+                            std::cerr << "Cannot send to " << paths[path] << " (is the app bound to it?)" << std::endl;
+                            return 1;
+                        }
+                        setBlocking(socket.getFd());
+                        fds.push_back(socket.getFd());
+                    }
+                }
+                targetOf[source] = targetOfPath[path];
+            }
+            lane->writer = std::make_unique<SocketWriter>(options.socketKind, std::move(fds), std::move(targetOf));
+        }
+    }
+    else
+    {
+        std::vector<std::shared_ptr<logging::ILogSink>> sinks;
+        if (options.path.empty())
+        {
+            nullSink = std::make_shared<NullSink>();
+            sinks.push_back(nullSink);
+        }
+        else
+        {
+            sinks.push_back(std::make_shared<logging::FileSinkImpl>(options.path));
+        }
+        manager = std::make_unique<async_logging::AsyncLogManager>("LoadGenerator", std::move(sinks), 1 << 16);
+        manager->start();
+        for (std::size_t source = 0; source < options.sources; ++source)
+        {
+            names.push_back("LOAD" + std::to_string(source));
+        }
+        for (auto &lane : lanes)
+        {
+            lane->writer = std::make_unique<ManagerWriter>(*manager, names);
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(0) << "Generating " << options.rate << " samples/s for " << options.durationSec << " s: "
+              << options.sources << " sources, " << options.threads << " threads, sink " << sinkName(options.sink)
+              << (options.path.empty() ? "" : " (" + options.path + ")") << std::endl;
+
+    // Every lane starts on the same deadline
+    Clock::time_point start = Clock::now() + std::chrono::milliseconds(20);
+    Clock::time_point end = start + std::chrono::nanoseconds(static_cast<int64_t>(options.durationSec * 1e9));
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < lanes.size(); ++i)
+    {
+        threads.emplace_back(runLane, std::ref(*lanes[i]), std::cref(options), start, end, 1000003ULL * (i + 1));
+    }
+
+    auto totals = [&lanes](uint64_t &generated, uint64_t &written, uint64_t &maxLagNs) {
+        generated = written = maxLagNs = 0;
+        for (const auto &lane : lanes)
+        {
+            generated += lane->stats.generated.load(std::memory_order_relaxed);
+            written += lane->stats.written.load(std::memory_order_relaxed);
+            maxLagNs = std::max(maxLagNs, lane->stats.maxLagNs.load(std::memory_order_relaxed));
+        }
+    };
+
+    // Progress while the lanes run
+    uint64_t generated = 0;
+    uint64_t written = 0;
+    uint64_t maxLagNs = 0;
+    if (options.reportMs > 0)
+    {
+        sleepUntil(start);
+        uint64_t lastWritten = 0;
+        Clock::time_point lastReport = start;
+        while (g_running && Clock::now() < end)
+        {
+            sleepUntil(std::min(end, lastReport + std::chrono::milliseconds(options.reportMs)));
+            Clock::time_point now = Clock::now();
+            totals(generated, written, maxLagNs);
+            double seconds = std::chrono::duration<double>(now - lastReport).count();
+            std::cout << std::setprecision(1) << "  " << std::chrono::duration<double>(now - start).count()
+                      << " s: " << std::setprecision(0) << static_cast<double>(written - lastWritten) / seconds
+                      << " samples/s" << std::endl;
+            lastWritten = written;
+            lastReport = now;
+        }
+    }
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    Clock::time_point finished = Clock::now();
+    totals(generated, written, maxLagNs);
+
+    double elapsed = std::chrono::duration<double>(finished - start).count();
+    std::cout << std::fixed << std::setprecision(0)
+              << "Target " << options.rate << "/s, achieved " << static_cast<double>(written) / elapsed << "/s ("
+              << std::setprecision(1) << 100.0 * static_cast<double>(written) / elapsed / options.rate << "%)"
+              << std::setprecision(0) << ": " << written << " of " << generated << " samples written in "
+              << std::setprecision(3) << elapsed << " s, max " << maxLagNs / 1000 << " us behind schedule"
+              << std::endl;
+
+    if (manager)
+    {
+        // The manager's own ceiling: time until everything queued is out
+        manager->stop();
+        double drained = std::chrono::duration<double>(Clock::now() - start).count();
+        std::cout << std::fixed << std::setprecision(0) << "AsyncLogManager delivered "
+                  << (nullSink ? std::to_string(nullSink->getCount()) : std::to_string(written)) << " messages in "
+                  << std::setprecision(3) << drained << " s (" << std::setprecision(0)
+                  << static_cast<double>(written) / drained << "/s end to end)" << std::endl;
+    }
+    return 0;
+}
@@ -20,7 +20,7 @@ void signalHandler(int signum)
 }
 
 void telemetryReaderThread(
-    SmartDataHub::ITelemetrySource& source,
+    SmartDataHub::FileTelemetrySourceImpl& source,
     async_logging::AsyncLogManager& logManager,
     const std::string& sourceName,
     logging::Context context,
@@ -34,10 +34,18 @@ void telemetryReaderThread(
         return;
     }
 
+    // generate_telemetry.sh rewrites the files; read only after a write
+    if (!source.enableWatch())
+    {
+        std::cerr << "[" << sourceName << "] Cannot watch source, polling every "
+                  << readIntervalMs << "ms" << std::endl;
+    }
+
+    bool haveData = true;
     while (g_running.load())
     {
         std::string rawData;
-        if (source.readSource(rawData))
+        if (haveData && source.readSource(rawData))
         {
             try
             {
@@ -56,7 +64,8 @@ void telemetryReaderThread(
             }
         }
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(readIntervalMs));
+        // readIntervalMs now bounds the wait so Ctrl+C is noticed
+        haveData = source.waitForData(readIntervalMs);
     }
 
     std::cout << "[" << sourceName << "] Thread stopped" << std::endl;
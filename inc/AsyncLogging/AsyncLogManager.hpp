@@ -1,8 +1,10 @@
 #ifndef ASYNCLOGMANAGER_HPP
 #define ASYNCLOGMANAGER_HPP
 
-#include "ThreadSafeRingBuffer.hpp"
+#include "PriorityLaneBuffer.hpp"
 #include "ThreadPool.hpp"
+#include "ThreadConfig.hpp"
+#include "LogThrottle.hpp"
 #include "inc/logging/ILogSink.hpp"
 #include "inc/logging/LogMessage.hpp"
 
@@ -11,30 +13,113 @@
 #include <thread>
 #include <atomic>
 #include <optional>
+#include <variant>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <shared_mutex>
 
 namespace async_logging
 {
 
+// Latency of completed flush() barriers, from request to sinks flushed
+struct FlushStats
+{
+    std::uint64_t count = 0;
+    std::chrono::nanoseconds last{0};
+    std::chrono::nanoseconds max{0};
+    std::chrono::nanoseconds total{0};
+};
+
+// Severity lanes: CRITICAL is drained first and owns a reserved slice
+// of the buffer; lower lanes are protected from starvation.
+struct LaneConfig
+{
+    std::size_t criticalReservePercent = 10;  // share of bufferCapacity only CRITICAL may use
+    std::size_t starvationLimit = 32;         // higher-lane pops before a waiting lower lane is served
+};
+
 class AsyncLogManager
 {
 private:
+    // Sequence marker queued behind every message logged before flush(),
+    // once per lane; the barrier completes when all copies are consumed
+    struct FlushRequest
+    {
+        std::promise<void> done;
+        std::chrono::steady_clock::time_point requested;
+        std::size_t pendingLanes = 0;
+    };
+
+    using QueueEntry = std::variant<logging::LogMessage, std::shared_ptr<FlushRequest>>;
+
+    // Queues a flush marker, waiting for room at most until `deadline`
+    // (forever when null). std::nullopt if it could not be queued in time.
+    std::optional<std::future<void>> startFlush(const std::chrono::steady_clock::time_point* deadline);
+    using SinkList = std::vector<std::shared_ptr<logging::ILogSink>>;
+
+    // Sink list snapshot (RCU style): the worker reads it with one atomic
+    // load per message; writers publish a new immutable copy and retire
+    // the old one until the worker reports a later epoch at a quiescent
+    // point (top of its loop, where it holds no snapshot).
+    struct RetiredSinks
+    {
+        std::uint64_t epoch;
+        const SinkList* sinks;
+    };
+
     std::string m_name;
-    std::vector<std::shared_ptr<logging::ILogSink>> m_sinks;
-    ThreadSafeRingBuffer<logging::LogMessage> m_buffer;
+    std::atomic<const SinkList*> m_sinks;
+    std::atomic<std::uint64_t> m_sinkEpoch;
+    std::atomic<std::uint64_t> m_quiescentEpoch;
+    mutable std::mutex m_sinkWriteMutex;
+    std::vector<RetiredSinks> m_retiredSinks;
+    bool m_workerActive;
+
+    PriorityLaneBuffer<QueueEntry> m_buffer;
     std::thread m_workerThread;
     std::atomic<bool> m_running;
+
+    // Sink tasks handed to the pool and not yet finished
+    std::size_t m_inFlight;
+    std::mutex m_inFlightMutex;
+    std::condition_variable m_inFlightDone;
+
+    mutable std::mutex m_flushStatsMutex;
+    FlushStats m_flushStats;
+
+    // Per-source admission control, keyed by LogMessage app name
+    std::map<std::string, std::shared_ptr<LogThrottle>> m_throttles;
+    mutable std::shared_mutex m_throttleMutex;
+    std::atomic<bool> m_hasThrottles;
+
     std::optional<ThreadPool> m_threadPool;
     bool m_useThreadPool;
+    ThreadConfig m_workerConfig;
 
     void workerFunction();
     void workerFunctionWithPool();
+    void markQuiescent();
+    void publishSinks(SinkList* next);
+    void reclaimRetiredSinks();
+    void dispatchToPool(const logging::LogMessage& msg);
+    void waitForPoolIdle();
+    bool reachedFlushMarker(FlushRequest& request);
+    void completeFlush(FlushRequest& request);
+    static std::size_t laneFor(logging::Severity severity);
 
 public:
     AsyncLogManager(const std::string& name,
                     std::vector<std::shared_ptr<logging::ILogSink>> sinks,
                     std::size_t bufferCapacity,
                     bool useThreadPool = false,
-                    std::size_t poolSize = 4);
+                    std::size_t poolSize = 4,
+                    ThreadConfig workerConfig = {},
+                    ThreadConfig poolConfig = {},
+                    LaneConfig laneConfig = {});
 
     AsyncLogManager(const AsyncLogManager&) = delete;
     AsyncLogManager& operator=(const AsyncLogManager&) = delete;
@@ -47,7 +132,30 @@ public:
     void start();
     void stop();
     bool log(logging::LogMessage msg);
+    // Queues the whole batch under one buffer lock (messages are moved
+    // from). Returns how many were queued; fewer only if stopped meanwhile.
+    std::size_t logBatch(std::vector<logging::LogMessage>& messages);
+
+    // Front-end load shedding: register a limit per source, then call
+    // admit() before constructing the message (log() does not re-check).
+    // Callers on a hot path can keep the shared_ptr from getThrottle().
+    void setThrottle(const std::string& appName, ThrottleConfig config);
+    std::shared_ptr<LogThrottle> getThrottle(const std::string& appName) const;
+    bool admit(const std::string& appName, logging::Severity severity);
+    std::map<std::string, ThrottleCounters> getThrottleCounters() const;
+
+    // Durability barrier: completes once every message logged before the
+    // call has been written by all sinks and each sink has been flushed.
+    std::future<void> flushAsync();
+    void flush();
+    bool flushFor(std::chrono::milliseconds timeout);
+    FlushStats getFlushStats() const;
+
+    // Safe while running. A removed sink may still receive messages that
+    // were already dequeued; call flush() afterwards to be sure it is idle.
     void addSink(std::shared_ptr<logging::ILogSink> sink);
+    bool removeSink(const std::shared_ptr<logging::ILogSink>& sink);
+    std::size_t getSinkCount() const;
     bool isRunning() const;
 };
 
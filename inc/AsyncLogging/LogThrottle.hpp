@@ -0,0 +1,73 @@
+#ifndef LOGTHROTTLE_HPP
+#define LOGTHROTTLE_HPP
+
+#include "inc/logging/LogMessage.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace async_logging
+{
+
+// Volume limits for one source (app_name / Context).
+// A default-constructed ThrottleConfig admits everything.
+struct ThrottleConfig
+{
+    double ratePerSec = 0.0;              // token refill rate, 0 = unlimited
+    double burst = 0.0;                   // bucket size, 0 = one second of rate
+    std::uint32_t infoSampleEvery = 1;    // keep 1 in N INFO messages
+    double infoSampleProbability = 1.0;   // keep INFO with this probability
+    bool exemptCritical = true;           // CRITICAL is never shed
+
+    bool isUnlimited() const
+    {
+        return ratePerSec <= 0.0 && infoSampleEvery <= 1 && infoSampleProbability >= 1.0;
+    }
+};
+
+struct ThrottleCounters
+{
+    std::uint64_t admitted = 0;
+    std::uint64_t rateLimited = 0;
+    std::uint64_t sampledOut = 0;
+
+    std::uint64_t suppressed() const
+    {
+        return rateLimited + sampledOut;
+    }
+};
+
+// Lock-free token bucket plus INFO sampling.
+// Call admit() before building a LogMessage; false means drop it.
+// The bucket is kept as a theoretical arrival time (GCRA), so each check
+// is a single CAS with no refill bookkeeping.
+class LogThrottle
+{
+private:
+    ThrottleConfig m_config;
+    std::int64_t m_intervalNs;    // time to earn one token
+    std::int64_t m_toleranceNs;   // how far ahead of schedule a burst may run
+    std::atomic<std::int64_t> m_theoreticalArrivalNs;
+    std::atomic<std::uint64_t> m_infoSeen;
+
+    std::atomic<std::uint64_t> m_admitted;
+    std::atomic<std::uint64_t> m_rateLimited;
+    std::atomic<std::uint64_t> m_sampledOut;
+
+    bool takeToken();
+    bool keepInfoSample();
+
+public:
+    explicit LogThrottle(ThrottleConfig config = {});
+
+    LogThrottle(const LogThrottle&) = delete;
+    LogThrottle& operator=(const LogThrottle&) = delete;
+
+    bool admit(logging::Severity severity);
+    ThrottleCounters getCounters() const;
+    const ThrottleConfig& getConfig() const;
+};
+
+} // namespace async_logging
+
+#endif // LOGTHROTTLE_HPP
@@ -0,0 +1,280 @@
+#ifndef PRIORITY_LANE_BUFFER_HPP
+#define PRIORITY_LANE_BUFFER_HPP
+
+#include "RingBuffer.hpp"
+#include <mutex>
+#include <condition_variable>
+#include <optional>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+
+namespace async_logging
+{
+
+    // Bounded multi-lane queue. Lane 0 has the highest priority.
+    //
+    // - The consumer always pops from the highest-priority non-empty lane,
+    //   except that a waiting lower lane is served once after it has been
+    //   passed over `starvationLimit` times.
+    // - All lanes share `capacity` slots; the last `reserved` slots can only
+    //   be taken by lane 0, so urgent producers never block behind a full
+    //   queue of routine traffic.
+    // - pushToAllLanes() markers count like items: one slot per lane, the
+    //   lane 0 copy being the only one that may use the reserve. capacity
+    //   is raised to at least one slot per lane, and the reserve lowered so
+    //   a marker always fits an empty queue.
+    template <typename T>
+    class PriorityLaneBuffer
+    {
+    private:
+        std::vector<RingBuffer<T>> m_lanes;
+        std::vector<std::size_t> m_passedOver;
+        std::size_t m_capacity;
+        std::size_t m_reserved;
+        std::size_t m_starvationLimit;
+        std::size_t m_total;
+        mutable std::mutex m_mutex;
+        std::condition_variable m_condNotEmpty;
+        std::condition_variable m_condNotFull;
+        bool m_stopped;
+
+        bool hasRoomFor(std::size_t lane) const
+        {
+            std::size_t limit = (lane == 0) ? m_capacity : m_capacity - m_reserved;
+            return m_total < limit && !m_lanes[lane].isFull();
+        }
+
+        // A marker's copies for lanes 1.. stay out of the reserve, lane 0's
+        // takes the last slot
+        bool hasRoomForMarker() const
+        {
+            std::size_t copies = m_lanes.size();
+            return m_total + copies - 1 <= m_capacity - m_reserved && m_total + copies <= m_capacity;
+        }
+
+        void queueOnAllLanes(const T &item)
+        {
+            for (auto &lane : m_lanes)
+            {
+                lane.tryPush(item);
+                ++m_total;
+            }
+            m_condNotEmpty.notify_one();
+        }
+
+        std::size_t selectLane()
+        {
+            std::size_t highest = 0;
+            while (m_lanes[highest].isEmpty())
+            {
+                ++highest;
+            }
+
+            // Starvation guard: lowest-priority overdue lane goes first
+            for (std::size_t lane = m_lanes.size() - 1; lane > highest; --lane)
+            {
+                if (!m_lanes[lane].isEmpty() && m_passedOver[lane] >= m_starvationLimit)
+                {
+                    m_passedOver[lane] = 0;
+                    return lane;
+                }
+            }
+
+            for (std::size_t lane = highest + 1; lane < m_lanes.size(); ++lane)
+            {
+                if (!m_lanes[lane].isEmpty())
+                {
+                    ++m_passedOver[lane];
+                }
+            }
+            m_passedOver[highest] = 0;
+            return highest;
+        }
+
+    public:
+        PriorityLaneBuffer(std::size_t laneCount, std::size_t capacity,
+                           std::size_t reserved, std::size_t starvationLimit)
+            : m_passedOver(laneCount, 0)
+            , m_capacity{std::max<std::size_t>(capacity, std::max<std::size_t>(laneCount, 1))}
+            , m_reserved{std::min(reserved, m_capacity + 1 - std::max<std::size_t>(laneCount, 2))}
+            , m_starvationLimit{std::max<std::size_t>(starvationLimit, 1)}
+            , m_total{0}
+            , m_stopped{false}
+        {
+            m_lanes.reserve(laneCount);
+            for (std::size_t i = 0; i < laneCount; ++i)
+            {
+                m_lanes.emplace_back(m_capacity);
+            }
+        }
+
+        PriorityLaneBuffer(const PriorityLaneBuffer &) = delete;
+        PriorityLaneBuffer &operator=(const PriorityLaneBuffer &) = delete;
+
+        PriorityLaneBuffer(PriorityLaneBuffer &&) = delete;
+        PriorityLaneBuffer &operator=(PriorityLaneBuffer &&) = delete;
+
+        ~PriorityLaneBuffer() = default;
+
+        // Blocks while the lane's share of the capacity is used up
+        bool push(T item, std::size_t lane)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_condNotFull.wait(lock, [this, lane] {
+                return hasRoomFor(lane) || m_stopped;
+            });
+
+            if (m_stopped)
+            {
+                return false;
+            }
+
+            m_lanes[lane].tryPush(std::move(item));
+            ++m_total;
+            m_condNotEmpty.notify_one();
+
+            return true;
+        }
+
+        // Queues [first, last) in order with one lock round trip instead of
+        // one per item; `laneOf(item)` picks each item's lane. Blocks like
+        // push() when a lane is full, after waking the consumer for what is
+        // already queued. Returns how many were queued (fewer once stopped).
+        template <typename Iterator, typename LaneOf>
+        std::size_t pushBatch(Iterator first, Iterator last, LaneOf laneOf)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            std::size_t pushed = 0;
+            for (; first != last && !m_stopped; ++first)
+            {
+                std::size_t lane = laneOf(*first);
+                if (!hasRoomFor(lane))
+                {
+                    m_condNotEmpty.notify_one();
+                    m_condNotFull.wait(lock, [this, lane] {
+                        return hasRoomFor(lane) || m_stopped;
+                    });
+                    if (m_stopped)
+                    {
+                        break;
+                    }
+                }
+
+                m_lanes[lane].tryPush(std::move(*first));
+                ++m_total;
+                ++pushed;
+            }
+
+            if (pushed > 0)
+            {
+                m_condNotEmpty.notify_one();
+            }
+            return pushed;
+        }
+
+        // Queues a copy of `item` at the tail of every lane (used for
+        // markers that must be ordered after everything already queued).
+        // Blocks until all copies fit the capacity (see hasRoomForMarker).
+        bool pushToAllLanes(const T &item)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_condNotFull.wait(lock, [this] {
+                return m_stopped || hasRoomForMarker();
+            });
+
+            if (m_stopped)
+            {
+                return false;
+            }
+
+            queueOnAllLanes(item);
+            return true;
+        }
+
+        // Same, but gives up (false, nothing queued) once `deadline` passes
+        // without room for every copy
+        template <typename Clock, typename Duration>
+        bool pushToAllLanesFor(const T &item, const std::chrono::time_point<Clock, Duration> &deadline)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            bool ready = m_condNotFull.wait_until(lock, deadline, [this] {
+                return m_stopped || hasRoomForMarker();
+            });
+
+            if (!ready || m_stopped)
+            {
+                return false;
+            }
+
+            queueOnAllLanes(item);
+            return true;
+        }
+
+        // Returns the next item by priority; std::nullopt once stopped and drained
+        std::optional<T> pop()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_condNotEmpty.wait(lock, [this] {
+                return m_total > 0 || m_stopped;
+            });
+
+            if (m_total == 0)
+            {
+                return std::nullopt;
+            }
+
+            auto item = m_lanes[selectLane()].tryPop();
+            --m_total;
+
+            // Producers wait on different limits, wake them all
+            m_condNotFull.notify_all();
+            return item;
+        }
+
+        void stop()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopped = true;
+            m_condNotEmpty.notify_all();
+            m_condNotFull.notify_all();
+        }
+
+        bool isStopped() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_stopped;
+        }
+
+        bool isEmpty() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_total == 0;
+        }
+
+        std::size_t size() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_total;
+        }
+
+        std::size_t laneSize(std::size_t lane) const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_lanes[lane].size();
+        }
+
+        std::size_t laneCount() const
+        {
+            return m_lanes.size();
+        }
+    };
+
+} // namespace async_logging
+
+#endif // PRIORITY_LANE_BUFFER_HPP
@@ -0,0 +1,35 @@
+#ifndef THREADCONFIG_HPP
+#define THREADCONFIG_HPP
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace async_logging
+{
+
+// Placement and scheduling attributes for one thread role
+// (logger worker, pool workers, telemetry source threads).
+// Every field is optional: a default-constructed ThreadConfig changes nothing.
+struct ThreadConfig
+{
+    std::string name;               // pthread name, truncated to 15 chars
+    std::vector<int> cpus;          // CPUs to pin to (empty = no pinning)
+    std::optional<int> niceLevel;   // per-thread nice value
+    bool batchScheduling = false;   // use SCHED_BATCH instead of SCHED_OTHER
+
+    bool isDefault() const
+    {
+        return name.empty() && cpus.empty() && !niceLevel.has_value() && !batchScheduling;
+    }
+};
+
+// Applies the config to the calling thread.
+// `suffix` is appended to the name (e.g. "-2" for the third pool worker).
+// Missing permissions or unknown CPUs are reported on std::cerr and skipped;
+// returns false if any requested attribute could not be applied.
+bool applyThreadConfig(const ThreadConfig& config, const std::string& suffix = "");
+
+} // namespace async_logging
+
+#endif // THREADCONFIG_HPP
@@ -1,6 +1,8 @@
 #ifndef THREADPOOL_HPP
 #define THREADPOOL_HPP
 
+#include "ThreadConfig.hpp"
+
 #include <vector>
 #include <queue>
 #include <thread>
@@ -22,11 +24,13 @@ private:
     std::mutex m_mutex;
     std::condition_variable m_condition;
     std::atomic<bool> m_stop;
+    ThreadConfig m_config;
 
-    void workerLoop();
+    void workerLoop(std::size_t index);
 
 public:
-    explicit ThreadPool(std::size_t numThreads);
+    // Each worker applies `config` on startup and is named "<name>-<index>"
+    explicit ThreadPool(std::size_t numThreads, ThreadConfig config = {});
 
     ThreadPool(const ThreadPool&) = delete;
     ThreadPool& operator=(const ThreadPool&) = delete;
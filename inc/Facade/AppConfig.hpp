@@ -12,6 +12,9 @@
  *     "appName": "TelemetryLogger",
  *     "bufferSize": 128,
  *     "threadPoolSize": 4,
+ *     "reactorThreads": 1,
+ *     "samplerThreads": 2,
+ *     "ioUring": true,
  *     "logFilePath": "telemetry_log.txt",
  *     "sources": {
  *         "CPU": {
@@ -19,12 +22,92 @@
  *             "type": "FILE",
  *             "path": "/proc/stat",
  *             "parseRateMs": 500,
+ *             "eventDriven": false,
+ *             "rateLimitPerSec": 10,
+ *             "infoSampleEvery": 5,
  *             "sinks": ["CONSOLE", "FILE"]
+ *         },
+ *         "PUSH": {
+ *             "enabled": true,
+ *             "type": "SOCKET",
+ *             "path": "/tmp/telemetry.sock",
+ *             "socketType": "DGRAM",
+ *             "batchSize": 64,
+ *             "sinks": ["FILE"]
+ *         },
+ *         "STREAM": { "enabled": true, "type": "SOCKET", "path": "/tmp/stream.sock", "framing": "LENGTH_PREFIXED", "sinks": ["FILE"] },
+ *         "AGENT": {
+ *             "enabled": true,
+ *             "type": "SHM",
+ *             "path": "/tlm-agent",
+ *             "ringCapacity": 1048576,
+ *             "sinks": ["FILE"]
+ *         },
+ *         "CORES": {
+ *             "enabled": true,
+ *             "type": "PERCORE",
+ *             "parseRateMs": 1000,
+ *             "topK": 8,
+ *             "sinks": ["FILE"]
+ *         },
+ *         "MEM": {
+ *             "enabled": true,
+ *             "type": "MEMINFO",
+ *             "fields": ["MemAvailable", "Cached", "Dirty", "Slab", "SwapFree", "HugePages_Free"],
+ *             "sinks": ["FILE"]
+ *         },
+ *         "DISK": {
+ *             "enabled": true,
+ *             "type": "DISKSTATS",
+ *             "devices": ["nvme0n1", "sda"],
+ *             "parseRateMs": 1000,
+ *             "sinks": ["FILE"]
+ *         },
+ *         "NET": { "enabled": true, "type": "NETDEV", "devices": ["eth0"], "sinks": ["FILE"] },
+ *         "LOAD": { "enabled": true, "type": "LOADAVG", "parseRateMs": 5000, "sinks": ["FILE"] },
+ *         "IOPRESSURE": { "enabled": true, "type": "PSI", "resource": "io", "sinks": ["FILE"] },
+ *         "CONTAINER": { "enabled": true, "type": "CGROUP", "parseRateMs": 1000, "sinks": ["FILE"] },
+ *         "TOP": {
+ *             "enabled": true,
+ *             "type": "PROCESSES",
+ *             "parseRateMs": 2000,
+ *             "topK": 10,
+ *             "scanThreads": 2,
+ *             "maxOpenFds": 256,
+ *             "sinks": ["FILE"]
+ *         },
+ *         "INCIDENT": {
+ *             "enabled": true,
+ *             "type": "REPLAY",
+ *             "path": "/var/tmp/incident.trace",
+ *             "speed": 4.0,
+ *             "loop": true,
+ *             "streams": 16,
+ *             "sinks": ["FILE"]
  *         }
+ *     },
+ *     "ingest": {
+ *         "enabled": true,
+ *         "path": "/tmp/telemetry_ingest.sock",
+ *         "framing": "NEWLINE",
+ *         "maxConnections": 4096,
+ *         "maxFrameSize": 4096,
+ *         "sinks": ["FILE"]
+ *     },
+ *     "threads": {
+ *         "logger":  { "name": "tlm-logger", "cpus": [3], "nice": 5 },
+ *         "pool":    { "name": "tlm-sink", "cpus": [2, 3], "batch": true },
+ *         "sources": { "name": "tlm-src", "cpus": [2] }
  *     }
  * }
  */
 
+#include "inc/AsyncLogging/ThreadConfig.hpp"
+#include "inc/AsyncLogging/LogThrottle.hpp"
+#include "inc/SmartDataHub/SafeSocket.hpp"
+#include "inc/SmartDataHub/TelemetryIngestServer.hpp"
+#include "inc/SmartDataHub/MemInfo.hpp"
+
 #include <string>
 #include <vector>
 #include <map>
@@ -39,6 +122,17 @@ namespace facade
     enum class SourceType
     {
         FILE,    // Read from file (FileTelemetrySourceImpl)
+        SOCKET,  // Unix socket (SocketTelemetrySourceImpl)
+        SHM,     // Shared-memory ring (ShmTelemetrySourceImpl)
+        PERCORE, // Per-core CPU usage from /proc/stat (TelemetryParser)
+        MEMINFO, // Selected /proc/meminfo fields (TelemetryParser)
+        DISKSTATS, // Per-device IOPS, throughput, utilization (/proc/diskstats)
+        NETDEV,    // Per-interface kB/s and packets/s (/proc/net/dev)
+        LOADAVG,   // Load averages and task counts (/proc/loadavg)
+        PSI,       // Pressure stall information (/proc/pressure/<resource>)
+        CGROUP,    // Own cgroup v2 CPU, memory, I/O and CPU pressure (CgroupCollectors)
+        PROCESSES, // Busiest processes by CPU, from /proc/<pid>/stat (ProcessCollector)
+        REPLAY,    // Recorded trace played back in time (ReplayTelemetrySourceImpl)
         VSOMEIP  // Read from vSOME/IP service (SomeIPTelemetrySourceImpl)
     };
 
@@ -60,9 +154,44 @@ namespace facade
     {
         bool enabled = false;          // Is this source enabled?
         SourceType type = SourceType::FILE;
-        std::string path;              // File path (for FILE type)
+        std::string path;              // File path (for FILE type); CGROUP: cgroup directory (empty = own cgroup)
         int parseRateMs = 500;         // How often to read from source (ms)
+        bool eventDriven = false;      // FILE only: read on inotify change, not on a timer
+        SmartDataHub::SocketKind socketKind = SmartDataHub::SocketKind::Stream; // SOCKET only: "STREAM", "SEQPACKET", "DGRAM"
+        SmartDataHub::FramingMode framing = SmartDataHub::FramingMode::Newline; // SOCKET STREAM only: "NEWLINE", "LENGTH_PREFIXED"
+        size_t batchSize = 64;         // SOCKET only: messages per recvmmsg()
+        size_t ringCapacity = 1024 * 1024; // SHM only: data area bytes ("path" is the shm name)
+        size_t topK = 0;               // PERCORE: log the K busiest cores per sample (0 = all); PROCESSES: K busiest processes (0 = 10)
+        size_t scanThreads = 0;        // PROCESSES only: ThreadPool workers sharing the pid scan (0 = source thread only)
+        size_t maxOpenFds = 1024;      // PROCESSES only: stat fds kept open between samples (at most a quarter of RLIMIT_NOFILE)
+        SmartDataHub::MemFieldMask memFields = SmartDataHub::AllMemFields; // MEMINFO only: "fields": ["Cached", "Dirty", ...]
+        std::vector<std::string> devices; // DISKSTATS/NETDEV/CGROUP only: devices ("8:0" for CGROUP io.stat) or interfaces to report (empty = all)
+        std::string resource = "cpu";  // PSI only: "cpu", "memory" or "io"; "path" defaults to /proc/pressure/<resource>
+        double speed = 1.0;            // REPLAY only: 1 = recorded timing, N = N times faster, 0 = as fast as possible
+        bool loop = false;             // REPLAY only: start over at the end of the trace
+        size_t streams = 1;            // REPLAY only: concurrent streams playing the trace
         std::vector<SinkType> sinks;   // Which sinks to send logs to
+
+        // Load shedding before messages are built:
+        // "rateLimitPerSec", "rateBurst", "infoSampleEvery", "infoSampleProbability"
+        async_logging::ThrottleConfig throttle;
+    };
+
+    /**
+     * @struct IngestConfig
+     * @brief Listening socket that local agents push samples into
+     *
+     * Each connection is its own source: "@<name>" as the first frame
+     * names it, otherwise it is "pid:<pid>". A source throttle configured
+     * under the same name applies to it.
+     */
+    struct IngestConfig
+    {
+        bool enabled = false;
+        std::string path = "/tmp/telemetry_ingest.sock";
+        SmartDataHub::FramingMode framing = SmartDataHub::FramingMode::Newline; // "NEWLINE", "LENGTH_PREFIXED"
+        SmartDataHub::IngestLimits limits;  // "maxConnections", "maxFrameSize"
+        std::vector<SinkType> sinks;
     };
 
     /**
@@ -75,11 +204,29 @@ namespace facade
         size_t bufferSize = 128;
         size_t threadPoolSize = 4;
         std::string logFilePath = "telemetry_log.txt";
+
+        // 0 = one thread per source; N = all sources on N reactor threads
+        // (SHM and REPLAY sources keep their own thread either way)
+        size_t reactorThreads = 0;
+        // Reactor and /proc collectors: read all due sources with one
+        // io_uring submission per round (plain reads when the kernel has
+        // no io_uring)
+        bool ioUring = false;
+        // Without a reactor: threads running the polled sources' samples,
+        // which are timed by one timer wheel
+        size_t samplerThreads = 2;
         
         // Map of source name -> config
         // Keys: "CPU", "RAM", "GPU"
         std::map<std::string, SourceConfig> sources;
 
+        IngestConfig ingest;
+
+        // Thread placement per role (source threads get "-<source>" appended)
+        async_logging::ThreadConfig loggerThread{"tlm-logger", {}, {}, false};
+        async_logging::ThreadConfig poolThreads{"tlm-sink", {}, {}, false};
+        async_logging::ThreadConfig sourceThreads{"tlm-src", {}, {}, false};
+
         /**
          * @brief Load configuration from JSON file
          * @param filePath Path to JSON configuration file
@@ -23,12 +23,26 @@
 #include "AppConfig.hpp"
 #include "inc/AsyncLogging/AsyncLogManager.hpp"
 #include "inc/SmartDataHub/ITelemetrySource.hpp"
+#include "inc/SmartDataHub/TelemetryReactor.hpp"
+#include "inc/SmartDataHub/TimerWheel.hpp"
+#include "inc/AsyncLogging/ThreadPool.hpp"
+#include "inc/SmartDataHub/SocketTelemetrySourceImpl.hpp"
+#include "inc/SmartDataHub/ShmTelemetrySourceImpl.hpp"
+#include "inc/SmartDataHub/ReplayTelemetrySourceImpl.hpp"
+#include "inc/SmartDataHub/TelemetryIngestServer.hpp"
+#include "inc/SmartDataHub/Metric.hpp"
+#include "inc/SmartDataHub/NumberParser.hpp"
+#include "inc/SmartDataHub/ProcCollector.hpp"
 
 #include <memory>
 #include <vector>
 #include <thread>
 #include <atomic>
 #include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string_view>
 
 namespace facade
 {
@@ -114,10 +128,203 @@ namespace facade
          */
         void sourceWorker(const std::string& sourceName, const SourceConfig& config);
 
+        /**
+         * @brief Drive all enabled sources from a TelemetryReactor
+         *        (used instead of createSourceThreads when reactorThreads > 0);
+         *        SHM and REPLAY sources still get a worker thread each
+         */
+        void createReactor();
+
+        /**
+         * @brief Build and open the source for one config entry
+         * @return nullptr if the source type is unsupported or cannot be opened
+         */
+        std::unique_ptr<SmartDataHub::ITelemetrySource> createSource(
+            const std::string& sourceName, const SourceConfig& config);
+
+        /**
+         * @brief Parse one raw sample and apply the source throttle
+         * @return std::nullopt if the sample is unparsable or shed
+         */
+        std::optional<logging::LogMessage> buildSample(const std::string& sourceName, logging::Context context,
+                                                       async_logging::LogThrottle* throttle,
+                                                       std::string_view rawData);
+
+        /**
+         * @brief Same, for a value already parsed (RecordValues)
+         */
+        std::optional<logging::LogMessage> buildSample(const std::string& sourceName, logging::Context context,
+                                                       async_logging::LogThrottle* throttle, float value,
+                                                       SmartDataHub::NumberStatus status);
+
+        /**
+         * @brief A raw sample that is not a number by itself ("cpu=73.5%")
+         *        takes its first digit run instead
+         */
+        static SmartDataHub::NumberStatus sampleValue(std::string_view rawData, SmartDataHub::NumberStatus status,
+                                                      float& value);
+
+        /**
+         * @brief Parse one raw sample, apply the source throttle and log it
+         */
+        void publishSample(const std::string& sourceName, logging::Context context,
+                           async_logging::LogThrottle* throttle, const std::string& rawData);
+
+        /**
+         * @brief Same as publishSample for every entry, queued as one batch;
+         *        all entries are parsed in one pass through `values`
+         */
+        void publishBatch(const std::string& sourceName, logging::Context context,
+                          async_logging::LogThrottle* throttle,
+                          const std::vector<std::string_view>& rawData, SmartDataHub::RecordValues& values);
+
+        /**
+         * @brief Reading loop for socket sources: wait for readiness,
+         *        drain everything queued and publish it as one batch
+         */
+        void socketWorker(const std::string& sourceName, SmartDataHub::SocketTelemetrySourceImpl& source);
+
+        /**
+         * @brief Reading loop for shared-memory sources: sleep on the ring,
+         *        publish every record in place as one batch
+         */
+        void shmWorker(const std::string& sourceName, SmartDataHub::ShmTelemetrySourceImpl& source);
+
+        /**
+         * @brief Playback loop for one replay stream: sleep until samples
+         *        are due, publish every due one in place as one batch
+         */
+        void replayWorker(const std::string& sourceName, SmartDataHub::ReplayTelemetrySourceImpl& source);
+
+        /**
+         * @brief Create the timer wheel for periodic sources and, without a
+         *        reactor, the ThreadPool its callbacks run on
+         */
+        void createTimerWheel();
+
+        /**
+         * @brief Sample `sampler` every periodMs from the timer wheel, on
+         *        the sampler pool or a reactor thread
+         */
+        void addSampler(const std::string& sourceName, int periodMs, SmartDataHub::TimerWheel::Callback sampler);
+
+        /**
+         * @brief One tick of a polled source of any sampled type
+         * @return empty if the source cannot be opened
+         */
+        SmartDataHub::TimerWheel::Callback makeSampler(const std::string& sourceName, const SourceConfig& config);
+
+        /**
+         * @brief One tick of a polled FILE source: read it, publish the sample
+         */
+        SmartDataHub::TimerWheel::Callback makeFileSampler(
+            const std::string& sourceName, std::shared_ptr<SmartDataHub::ITelemetrySource> source);
+
+        /**
+         * @brief One tick of a PERCORE source: one /proc/stat read, the usage
+         *        of every (or the topK busiest) core as one batch
+         */
+        SmartDataHub::TimerWheel::Callback makePerCoreSampler(const std::string& sourceName,
+                                                              const SourceConfig& config);
+
+        /**
+         * @brief One tick of a MEMINFO source: one /proc/meminfo pass, every
+         *        configured field as one batch (parts of MemTotal, SwapTotal
+         *        or HugePages_Total as a percent of it, the rest in kB)
+         */
+        SmartDataHub::TimerWheel::Callback makeMemInfoSampler(const std::string& sourceName,
+                                                              const SourceConfig& config);
+
+        /**
+         * @brief One tick of a PROCESSES source: one pid scan (sharded over
+         *        a ThreadPool), CPU and RSS of the topK busiest processes as
+         *        one batch
+         */
+        SmartDataHub::TimerWheel::Callback makeProcessSampler(const std::string& sourceName,
+                                                              const SourceConfig& config);
+
+        /**
+         * @brief Sources read on a fixed period rather than on readiness
+         */
+        static bool isSampledType(const SourceConfig& config);
+
+        /**
+         * @brief Build and open the /proc collector of one DISKSTATS,
+         *        NETDEV, LOADAVG or PSI source (CGROUP sources have several,
+         *        see createCgroupCollectors)
+         * @return nullptr if the file cannot be opened
+         */
+        std::unique_ptr<SmartDataHub::ProcCollector> createCollector(
+            const std::string& sourceName, const SourceConfig& config);
+
+        /**
+         * @brief One file of a CGROUP source and the metric group
+         *        ("<source>.<group>.<metric>") it reports under
+         */
+        struct CgroupFile
+        {
+            std::string group;
+            logging::Context context;
+            std::unique_ptr<SmartDataHub::ProcCollector> collector;
+        };
+
+        /**
+         * @brief Build and open the collectors of one CGROUP source:
+         *        cpu.stat, memory.current, memory.stat, io.stat and
+         *        cpu.pressure of the configured (or the process's own)
+         *        cgroup. Files of controllers not enabled there are skipped.
+         */
+        std::vector<CgroupFile> createCgroupCollectors(const std::string& sourceName, const SourceConfig& config);
+
+        /**
+         * @brief Start the one thread that samples every /proc collector
+         *        source (when any is enabled)
+         */
+        void createCollectorThread();
+
+        /**
+         * @brief Sampling loop for all /proc collector sources: every due
+         *        file read in one pass per tick, each source's metrics as
+         *        one batch
+         */
+        void collectorWorker(std::vector<std::string> sourceNames);
+
+        static bool isCollectorType(SourceType type);
+
+        /**
+         * @brief Log every metric of one sample as "<source>.<metric>",
+         *        queued as one batch: percentages clamped to 0-100 as the
+         *        payload, other units as INFO with the value in the text
+         */
+        void publishMetrics(const std::string& sourceName, logging::Context context,
+                            async_logging::LogThrottle* throttle,
+                            const std::vector<SmartDataHub::Metric>& metrics);
+
+        /**
+         * @brief Start the ingest endpoint (when "ingest" is enabled)
+         */
+        void createIngestServer();
+
+        /**
+         * @brief Turn one round of pushed samples into one logBatch()
+         */
+        void publishIngestBatch(const std::vector<SmartDataHub::IngestSample>& batch);
+
+        static logging::Context contextForSource(const std::string& sourceName);
+
         AppConfig m_config;
         std::unique_ptr<async_logging::AsyncLogManager> m_logManager;
         std::vector<std::shared_ptr<logging::ILogSink>> m_sinks;
         std::vector<std::thread> m_sourceThreads;
+        std::unique_ptr<SmartDataHub::TelemetryReactor> m_reactor;
+        std::unique_ptr<SmartDataHub::TimerWheel> m_timerWheel;
+        std::unique_ptr<async_logging::ThreadPool> m_samplerPool;
+        std::mutex m_samplersMutex;
+        std::vector<std::pair<std::string, SmartDataHub::TimerWheel::TimerId>> m_sampleTimers;
+        std::mutex m_replayMutex;
+        std::map<std::string, std::shared_ptr<const SmartDataHub::ReplayTrace>> m_replayTraces; // by path, shared by streams
+        std::unique_ptr<SmartDataHub::TelemetryIngestServer> m_ingestServer;
+        SmartDataHub::RecordValues m_ingestValues; // ingest thread only
         std::atomic<bool> m_running{false};
     };
 
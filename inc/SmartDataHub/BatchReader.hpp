@@ -0,0 +1,59 @@
+#pragma once
+
+#include "ITelemetrySource.hpp"
+#include "IoUring.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace SmartDataHub
+{
+    // Reads one sample from each of many sources with as few syscalls as
+    // possible.
+    //
+    // Sources that can describe their next read (prepareRead) are queued
+    // on an io_uring and submitted together with one io_uring_enter();
+    // all others, or all of them when io_uring is unavailable or turned
+    // off, go through readSource() one by one. A read the ring fails
+    // (-errno other than EAGAIN) is retried with readSource() in the same
+    // round. Callers see the same samples either way. One thread per reader.
+    class BatchReader
+    {
+    public:
+        // index into the sources passed to readAll()
+        using SampleHandler = std::function<void(std::size_t index, const std::string &data)>;
+
+    private:
+        IoUring m_ring;
+        std::vector<std::size_t> m_queued;   // sources with a read in the ring
+        std::vector<std::size_t> m_fallback; // sources read with readSource()
+        std::string m_sample;                // reused for every sample
+
+        uint64_t m_submissions = 0;
+        uint64_t m_batchedReads = 0;
+        uint64_t m_plainReads = 0;
+        bool m_opcodeUnsupported = false; // ring turned off after this flush
+        bool m_readFailureLogged = false;
+
+        void flush(const std::vector<ITelemetrySource *> &sources, const SampleHandler &onSample);
+        void failedRead(int error);
+
+    public:
+        // queueDepth bounds the reads per submission; useIoUring = false
+        // (or a kernel without io_uring) gives plain readSource() calls
+        explicit BatchReader(bool useIoUring = true, unsigned queueDepth = 64);
+
+        BatchReader(const BatchReader &) = delete;
+        BatchReader &operator=(const BatchReader &) = delete;
+
+        void readAll(const std::vector<ITelemetrySource *> &sources, const SampleHandler &onSample);
+
+        bool usesIoUring() const;
+        uint64_t getSubmissions() const;  // io_uring_enter() calls
+        uint64_t getBatchedReads() const; // reads completed through the ring
+        uint64_t getPlainReads() const;   // readSource() fallbacks
+    };
+
+} // namespace SmartDataHub
@@ -0,0 +1,111 @@
+#pragma once
+#include "ProcCollector.hpp"
+#include "ProcCollectors.hpp" // DeviceCounters
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace SmartDataHub
+{
+    // Collectors for the cgroup v2 interface files of one cgroup, so a
+    // containerized agent reports what its own limits see rather than the
+    // host-wide /proc numbers. They are ProcCollectors: fd kept open, one
+    // pread per sample, batched by ProcSampler like the /proc files.
+    //
+    // Keyed files ("usage_usec 1234") are read line by line against a
+    // fixed key table, so a key the kernel does not print (cpu.stat of the
+    // root cgroup has no throttling keys) is just not reported.
+
+    // Directory of the process's cgroup from the contents of
+    // /proc/<pid>/cgroup (the "0::<path>" line) and /proc/<pid>/mountinfo
+    // (the cgroup2 mount). False if either is missing (cgroup v1 only).
+    bool resolveCgroupDir(std::string_view procCgroup, std::string_view mountInfo, std::string &dir);
+
+    // resolveCgroupDir() on the files of the calling process; empty if
+    // there is no cgroup v2 hierarchy
+    std::string discoverCgroupDir();
+
+    // cpu.stat: CPU used by the cgroup (usage, user, system in %cpu, i.e.
+    // 100 per busy core), the share of CFS periods that were throttled and
+    // throttled time in ms/s (only under a cpu.max limit)
+    class CgroupCpuStatCollector : public ProcCollector
+    {
+    public:
+        enum Field
+        {
+            UsageUsec,
+            UserUsec,
+            SystemUsec,
+            NrPeriods,
+            NrThrottled,
+            ThrottledUsec,
+            FieldCount
+        };
+
+    private:
+        uint64_t m_previous[FieldCount] = {};
+        unsigned m_previousFound = 0;
+
+    protected:
+        bool parse(std::string_view content, double elapsedSec, std::vector<Metric> &metrics) override;
+
+    public:
+        explicit CgroupCpuStatCollector(std::string path);
+    };
+
+    // memory.current: memory charged to the cgroup (kB)
+    class CgroupMemoryCollector : public ProcCollector
+    {
+    protected:
+        bool parse(std::string_view content, double elapsedSec, std::vector<Metric> &metrics) override;
+
+    public:
+        explicit CgroupMemoryCollector(std::string path);
+    };
+
+    // memory.stat: the main consumers (anon, file, kernel, shmem, dirty and
+    // writeback page cache, slab; kB) and page faults per second
+    class CgroupMemoryStatCollector : public ProcCollector
+    {
+    public:
+        enum Field
+        {
+            Anon,
+            File,
+            Kernel,
+            Shmem,
+            FileDirty,
+            FileWriteback,
+            Slab,
+            PgFault,
+            PgMajFault,
+            FieldCount
+        };
+
+    private:
+        uint64_t m_previous[FieldCount] = {};
+        unsigned m_previousFound = 0;
+
+    protected:
+        bool parse(std::string_view content, double elapsedSec, std::vector<Metric> &metrics) override;
+
+    public:
+        explicit CgroupMemoryStatCollector(std::string path);
+    };
+
+    // io.stat: per device ("8:0") read/write kB/s and IOPS of the cgroup.
+    // The filter takes "major:minor" names.
+    class CgroupIoStatCollector : public ProcCollector
+    {
+    private:
+        DeviceCounters m_devices;
+
+    protected:
+        bool parse(std::string_view content, double elapsedSec, std::vector<Metric> &metrics) override;
+
+    public:
+        explicit CgroupIoStatCollector(std::string path);
+    };
+
+} // namespace SmartDataHub
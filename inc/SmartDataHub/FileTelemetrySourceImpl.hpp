@@ -2,7 +2,11 @@
 
 #include "ITelemetrySource.hpp"
 #include "SafeFile.hpp"
+#include "FileWatch.hpp"
 #include <fcntl.h>
+#include <sys/stat.h>
+#include <string_view>
+#include <vector>
 #include <vsomeip/application.hpp>
 namespace SmartDataHub
 {
@@ -12,6 +16,21 @@ namespace SmartDataHub
     private:
         SafeFile m_file;        // RAII wrapper
         std::string m_filepath; // path to telemetry file
+        FileWatch m_watch;      // set up by enableWatch()
+
+        // Last seen mtime/size: a rewrite in place restarts readSource()
+        // from the first line instead of continuing at the old offset
+        struct timespec m_lastModified = {};
+        off_t m_lastSize = -1;
+
+        // procfs/sysfs: every readSource() is the first line of a fresh
+        // read from offset 0, which makes it one batchable pread
+        bool m_pseudoFile = false;
+        std::vector<char> m_sampleBuf; // target of prepareRead()
+
+        bool isNewerThanLastRead(const struct stat &info) const;
+        bool hasUnreadChange() const;
+        void rewindIfRewritten();
     public:
         explicit FileTelemetrySourceImpl(const std::string &path);
         // Rule of 0: NO special member functions
@@ -20,6 +39,39 @@ namespace SmartDataHub
         // ITelemetrySource interface implementation
         bool openSource() override;
         bool readSource(std::string &out) override;
+
+        // Same as readSource(std::string&) without the copy; the view is
+        // valid until the next read on this source
+        bool readSource(std::string_view &out);
+
+        // Plain sequential read: false at end of file, no wrap-around
+        bool readLine(std::string_view &out);
+        void rewind();
+
+        // Whole current content via one pread on the already open fd
+        // (see SafeFile::readSnapshot); use for procfs/sysfs sampling
+        bool readSnapshot(std::string_view &content);
+        bool isOpen() const;
+
+        // Event-driven mode: watch the file with inotify so callers can
+        // block in waitForData() instead of sleeping a fixed interval.
+        // Regular files only; procfs/sysfs never report changes.
+        bool enableWatch();
+        bool isWatching() const;
+
+        // Blocks until the file is written or timeoutMs passes (-1 = no
+        // timeout). Returns true when new data may be read. Reopens the
+        // file if it was replaced. Without a watch this just sleeps the
+        // timeout and returns true, i.e. plain polling.
+        bool waitForData(int timeoutMs);
+
+        // Reactor support: the inotify fd once enableWatch() succeeded
+        int getPollFd() const override;
+        bool acknowledgeReady() override;
+
+        // Batched I/O support: procfs/sysfs files that are not watched
+        bool prepareRead(ReadRequest &request) override;
+        bool completeRead(int result, std::string &out) override;
     };
 
 } // SmartDataHub
\ No newline at end of file
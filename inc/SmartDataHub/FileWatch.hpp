@@ -0,0 +1,53 @@
+#pragma once
+#include <sys/inotify.h> // inotify_init1(), inotify_add_watch()
+#include <sys/stat.h>    // stat(), ino_t, dev_t
+#include <string>
+
+namespace SmartDataHub
+{
+    // RAII wrapper around one inotify instance watching one file.
+    // Reports writes (IN_MODIFY / IN_CLOSE_WRITE) and replacement of the
+    // file (deleted or renamed over), re-arming the watch when the path
+    // reappears. Does not work for /proc and /sys, which emit no events.
+    class FileWatch
+    {
+    public:
+        enum class Event
+        {
+            None,     // timeout, nothing changed
+            Modified, // file content was written
+            Replaced  // file was deleted/renamed; the path must be reopened
+        };
+
+    private:
+        int inotifyFd = -1;
+        int watchFd = -1;
+        std::string watchedPath;
+        ino_t watchedInode = 0;
+        dev_t watchedDevice = 0;
+
+        bool addWatch();
+        bool pathStillWatched() const;
+        Event drainEvents();
+
+    public:
+        FileWatch() = default;
+
+        // Rule of 5
+        ~FileWatch();
+        FileWatch(FileWatch &&other) noexcept;
+        FileWatch &operator=(FileWatch &&other) noexcept;
+        FileWatch(const FileWatch &) = delete;
+        FileWatch &operator=(const FileWatch &) = delete;
+
+        // Operations
+        bool watch(const std::string &path); // Starts watching path
+        Event wait(int timeoutMs);           // -1 blocks until an event
+        void closeWatch();
+
+        // Utilities
+        bool isWatching() const;
+        int getFd() const; // readable when events are pending
+    };
+
+} // namespace SmartDataHub
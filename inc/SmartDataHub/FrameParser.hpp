@@ -0,0 +1,70 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace SmartDataHub
+{
+    // How a byte stream is cut into messages
+    enum class FramingMode
+    {
+        Raw,           // whatever one recv() returned is one message
+        Newline,       // "<payload>\n"
+        LengthPrefixed // 4-byte big-endian length, then the payload
+    };
+
+    // Persistent reassembly buffer for one stream connection.
+    //
+    // Bytes are received straight into the buffer (prepareWrite/commit),
+    // complete frames are handed out as views into it (nextFrame), and a
+    // partial frame simply stays buffered for the next recv. Consumed
+    // bytes are compacted away lazily, so the steady state does no
+    // allocation and no per-frame copy.
+    class FrameParser
+    {
+    private:
+        FramingMode mode;
+        size_t maxFrameSize;
+        std::vector<char> buffer;
+        size_t readPos = 0;  // start of the first unparsed byte
+        size_t writePos = 0; // end of received data
+        size_t scanPos = 0;  // newline search resumes here
+        bool corrupt = false;
+        bool skipping = false; // inside an oversized line
+        uint64_t droppedBytes = 0;
+
+    public:
+        static constexpr size_t LengthPrefixSize = 4;
+
+        explicit FrameParser(FramingMode framing = FramingMode::Newline, size_t maxFrame = 64 * 1024);
+
+        // Returns room for at least minSpace bytes at the end of the buffer
+        char *prepareWrite(size_t minSpace);
+        size_t writableSize() const;
+        void commit(size_t bytes); // marks bytes written after prepareWrite
+
+        // Next complete frame (without delimiter/prefix). The view stays
+        // valid until the next prepareWrite() or reset().
+        bool nextFrame(std::string_view &frame);
+        // True if nextFrame() would succeed without more data
+        bool hasCompleteFrame() const;
+
+        void reset();
+        // Frees the buffer if everything is consumed and it grew past
+        // keepBytes (e.g. after a burst); idle streams then cost nothing
+        void shrinkIfIdle(size_t keepBytes);
+
+        // Utilities
+        FramingMode getMode() const;
+        size_t bufferedBytes() const;
+        // A length prefix above maxFrameSize: the stream cannot be resynced
+        bool isCorrupt() const;
+        // Newline mode drops lines longer than maxFrameSize
+        uint64_t getDroppedBytes() const;
+
+        // Helper for senders: prefix + payload in one string
+        static void appendLengthPrefixed(std::vector<char> &out, std::string_view payload);
+    };
+
+} // namespace SmartDataHub
@@ -1,9 +1,21 @@
 #pragma once
 
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 namespace SmartDataHub {
 
+// One read a source needs for its next sample (see BatchReader)
+struct ReadRequest
+{
+    int fd = -1;
+    char* buffer = nullptr;
+    size_t length = 0;
+    int64_t offset = -1;   // -1: current file position
+    bool isSocket = false; // recv() with MSG_DONTWAIT instead of read()
+};
+
 class ITelemetrySource
 {
 public:
@@ -11,5 +23,36 @@ public:
     virtual bool openSource() = 0;
     virtual bool readSource(std::string& out) = 0;
     virtual ~ITelemetrySource() = default;
+
+    // Reactor support (see TelemetryReactor).
+    // A source that can announce new data returns an fd that turns
+    // readable when it has some; -1 means it is sampled on a timer.
+    // readSource() must not block when driven by the reactor.
+    virtual int getPollFd() const { return -1; }
+
+    // Called once getPollFd() is readable. Consumes the notification and
+    // returns true if readSource() has something new to return.
+    virtual bool acknowledgeReady() { return true; }
+
+    // True while readSource() can return more without touching the fd
+    // (e.g. several frames arrived in one recv). The reactor keeps
+    // reading until this is false, since epoll will not report them.
+    virtual bool hasPendingData() const { return false; }
+
+    // True once readSource() can never return anything new (peer gone,
+    // stream corrupt) although getPollFd() may stay readable. The reactor
+    // then stops polling the fd so it cannot spin the loop.
+    virtual bool isClosed() const { return false; }
+
+    // Batched I/O support (see BatchReader).
+    // A source whose next readSource() is exactly one read on one fd
+    // describes that read here, so many sources can be read with a single
+    // submission. false means the caller uses readSource() instead. The
+    // buffer must stay valid until completeRead().
+    virtual bool prepareRead(ReadRequest& /*request*/) { return false; }
+
+    // Result of that read (bytes or -errno); returns what readSource()
+    // would have returned.
+    virtual bool completeRead(int /*result*/, std::string& /*out*/) { return false; }
 };
-} // namespace SmartDataHub 
\ No newline at end of file
+} // namespace SmartDataHub
@@ -0,0 +1,70 @@
+#pragma once
+#include <linux/io_uring.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace SmartDataHub
+{
+    struct IoCompletion
+    {
+        uint64_t userData = 0;
+        int32_t result = 0; // bytes transferred or -errno
+    };
+
+    // Minimal io_uring on raw syscalls (no liburing dependency): queue
+    // reads, submit them all with one io_uring_enter(), reap completions.
+    //
+    // init() fails on kernels without io_uring or where it is filtered
+    // (seccomp, io_uring_disabled sysctl); callers then fall back to plain
+    // read(). One thread per ring.
+    class IoUring
+    {
+    private:
+        int m_ringFd = -1;
+        void *m_sqRing = nullptr;
+        void *m_cqRing = nullptr;
+        size_t m_sqRingSize = 0;
+        size_t m_cqRingSize = 0;
+        io_uring_sqe *m_sqes = nullptr;
+        size_t m_sqesSize = 0;
+
+        unsigned *m_sqHead = nullptr;
+        unsigned *m_sqTail = nullptr;
+        unsigned *m_sqMask = nullptr;
+        unsigned *m_sqArray = nullptr;
+        unsigned *m_cqHead = nullptr;
+        unsigned *m_cqTail = nullptr;
+        unsigned *m_cqMask = nullptr;
+        io_uring_cqe *m_cqes = nullptr;
+
+        unsigned m_entries = 0;
+        unsigned m_queued = 0; // prepared since the last submit
+
+        io_uring_sqe *nextSqe();
+
+    public:
+        IoUring() = default;
+        ~IoUring();
+
+        IoUring(const IoUring &) = delete;
+        IoUring &operator=(const IoUring &) = delete;
+
+        bool init(unsigned entries);
+        void close();
+        bool isReady() const;
+        unsigned getEntries() const;
+        unsigned getQueued() const;
+
+        // Both return false when the submission queue is full.
+        // offset -1 reads at (and advances) the current file position.
+        bool prepareRead(int fd, void *buffer, unsigned length, int64_t offset, uint64_t userData);
+        // recv() with MSG_DONTWAIT: an empty socket completes with -EAGAIN
+        bool prepareRecv(int fd, void *buffer, unsigned length, uint64_t userData);
+
+        // Submits everything queued and waits until at least waitFor
+        // completions are available. Returns the number submitted or -errno.
+        int submitAndWait(unsigned waitFor);
+        bool popCompletion(IoCompletion &completion);
+    };
+
+} // namespace SmartDataHub
@@ -0,0 +1,259 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace SmartDataHub
+{
+    // /proc/meminfo fields, in file order. Values are kB except the
+    // HugePages_* counts.
+    enum class MemField : uint8_t
+    {
+        MemTotal,
+        MemFree,
+        MemAvailable,
+        Buffers,
+        Cached,
+        SwapCached,
+        Active,
+        Inactive,
+        ActiveAnon,
+        InactiveAnon,
+        ActiveFile,
+        InactiveFile,
+        Unevictable,
+        Mlocked,
+        SwapTotal,
+        SwapFree,
+        Zswap,
+        Zswapped,
+        Dirty,
+        Writeback,
+        AnonPages,
+        Mapped,
+        Shmem,
+        KReclaimable,
+        Slab,
+        SReclaimable,
+        SUnreclaim,
+        KernelStack,
+        PageTables,
+        SecPageTables,
+        CommitLimit,
+        CommittedAS,
+        VmallocTotal,
+        VmallocUsed,
+        Percpu,
+        AnonHugePages,
+        ShmemHugePages,
+        FileHugePages,
+        HugePagesTotal,
+        HugePagesFree,
+        HugePagesRsvd,
+        HugePagesSurp,
+        Hugepagesize,
+        Hugetlb,
+        DirectMap4k,
+        DirectMap2M,
+        DirectMap1G,
+        Count
+    };
+
+    constexpr std::size_t MemFieldCount = static_cast<std::size_t>(MemField::Count);
+    static_assert(MemFieldCount <= 64, "MemFieldMask has one bit per field");
+
+    // Key of each field as it appears before the ':'
+    constexpr std::array<std::string_view, MemFieldCount> MemFieldKeys = {
+        "MemTotal", "MemFree", "MemAvailable", "Buffers", "Cached", "SwapCached", "Active", "Inactive",
+        "Active(anon)", "Inactive(anon)", "Active(file)", "Inactive(file)", "Unevictable", "Mlocked",
+        "SwapTotal", "SwapFree", "Zswap", "Zswapped", "Dirty", "Writeback", "AnonPages", "Mapped", "Shmem",
+        "KReclaimable", "Slab", "SReclaimable", "SUnreclaim", "KernelStack", "PageTables", "SecPageTables",
+        "CommitLimit", "Committed_AS", "VmallocTotal", "VmallocUsed", "Percpu", "AnonHugePages",
+        "ShmemHugePages", "FileHugePages", "HugePages_Total", "HugePages_Free", "HugePages_Rsvd",
+        "HugePages_Surp", "Hugepagesize", "Hugetlb", "DirectMap4k", "DirectMap2M", "DirectMap1G"};
+
+    using MemFieldMask = uint64_t;
+
+    constexpr MemFieldMask memFieldBit(MemField field)
+    {
+        return MemFieldMask{1} << static_cast<unsigned>(field);
+    }
+
+    constexpr MemFieldMask AllMemFields = MemFieldCount == 64 ? ~MemFieldMask{0}
+                                                               : (MemFieldMask{1} << MemFieldCount) - 1;
+
+    namespace detail
+    {
+        // Perfect hash of the keys above. The key length and four of its
+        // bytes (first, middle, last two) already tell every known key
+        // apart, so hashing costs the same for every line; a multiplier
+        // folds that digest to MemHashBits. The seed is searched at
+        // compile time, so a key that breaks the hash fails the build
+        // instead of colliding; 256 slots for ~50 keys keep that search
+        // to a few seeds.
+        constexpr unsigned MemHashBits = 8;
+        constexpr std::size_t MemHashSlots = std::size_t{1} << MemHashBits;
+        constexpr uint8_t MemHashEmpty = 0xFF;
+
+        constexpr uint64_t memKeyDigest(std::string_view key)
+        {
+            std::size_t n = key.size();
+            if (n < 2)
+            {
+                return n == 0 ? 0 : (uint64_t{static_cast<uint8_t>(key[0])} << 8) | 1;
+            }
+            return n | (uint64_t{static_cast<uint8_t>(key[0])} << 8) |
+                   (uint64_t{static_cast<uint8_t>(key[n / 2])} << 16) |
+                   (uint64_t{static_cast<uint8_t>(key[n - 2])} << 24) |
+                   (uint64_t{static_cast<uint8_t>(key[n - 1])} << 32);
+        }
+
+        constexpr unsigned memKeyHash(std::string_view key, uint64_t seed)
+        {
+            return static_cast<unsigned>(((memKeyDigest(key) ^ seed) * 0x9E3779B97F4A7C15ULL) >> (64 - MemHashBits));
+        }
+
+        constexpr bool memSeedIsPerfect(uint64_t seed)
+        {
+            bool used[MemHashSlots] = {};
+            for (std::string_view key : MemFieldKeys)
+            {
+                unsigned slot = memKeyHash(key, seed);
+                if (used[slot])
+                {
+                    return false;
+                }
+                used[slot] = true;
+            }
+            return true;
+        }
+
+        constexpr uint64_t findMemSeed()
+        {
+            uint64_t seed = 0;
+            while (!memSeedIsPerfect(seed))
+            {
+                ++seed;
+            }
+            return seed;
+        }
+
+        constexpr uint64_t MemHashSeed = findMemSeed();
+
+        // Slot -> MemField index, MemHashEmpty for unused slots
+        constexpr std::array<uint8_t, MemHashSlots> buildMemTable()
+        {
+            std::array<uint8_t, MemHashSlots> table{};
+            for (auto &slot : table)
+            {
+                slot = MemHashEmpty;
+            }
+            for (std::size_t i = 0; i < MemFieldCount; ++i)
+            {
+                table[memKeyHash(MemFieldKeys[i], MemHashSeed)] = static_cast<uint8_t>(i);
+            }
+            return table;
+        }
+
+        constexpr std::array<uint8_t, MemHashSlots> MemHashTable = buildMemTable();
+    } // namespace detail
+
+    // Field named `key` ("Cached", "HugePages_Free"); false for keys this
+    // parser does not know (they are skipped)
+    constexpr bool lookupMemField(std::string_view key, MemField &field)
+    {
+        uint8_t index = detail::MemHashTable[detail::memKeyHash(key, detail::MemHashSeed)];
+        if (index == detail::MemHashEmpty || MemFieldKeys[index] != key)
+        {
+            return false;
+        }
+        field = static_cast<MemField>(index);
+        return true;
+    }
+
+    namespace detail
+    {
+        constexpr bool memKeysRoundTrip()
+        {
+            for (std::size_t i = 0; i < MemFieldCount; ++i)
+            {
+                MemField field = MemField::Count;
+                if (!lookupMemField(MemFieldKeys[i], field) || field != static_cast<MemField>(i))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    } // namespace detail
+
+    static_assert(detail::memKeysRoundTrip(), "MemFieldKeys out of sync with MemField");
+
+    // What a field is logged as a share of: MemTotal for the parts of RAM
+    // (HugePages_Total as pages * Hugepagesize), SwapTotal for SwapFree and
+    // Zswapped, HugePages_Total for the other HugePages_* counts.
+    // MemField::Count for the totals themselves and for fields that are no
+    // part of any of them (CommitLimit, Committed_AS, VmallocTotal,
+    // Hugepagesize, DirectMap*): those are logged in kB.
+    constexpr MemField memPercentBase(MemField field)
+    {
+        switch (field)
+        {
+        case MemField::MemTotal:
+        case MemField::SwapTotal:
+        case MemField::CommitLimit:
+        case MemField::CommittedAS:
+        case MemField::VmallocTotal:
+        case MemField::Hugepagesize:
+        case MemField::DirectMap4k:
+        case MemField::DirectMap2M:
+        case MemField::DirectMap1G:
+        case MemField::Count:
+            return MemField::Count;
+        case MemField::SwapFree:
+        case MemField::Zswapped:
+            return MemField::SwapTotal;
+        case MemField::HugePagesFree:
+        case MemField::HugePagesRsvd:
+        case MemField::HugePagesSurp:
+            return MemField::HugePagesTotal;
+        default:
+            return MemField::MemTotal;
+        }
+    }
+
+    // Fields percent() reads besides the one asked for
+    constexpr MemFieldMask MemPercentBases = memFieldBit(MemField::MemTotal) | memFieldBit(MemField::SwapTotal) |
+                                             memFieldBit(MemField::HugePagesTotal) |
+                                             memFieldBit(MemField::Hugepagesize);
+
+    // One /proc/meminfo sample: raw values plus which ones were present
+    struct MemInfo
+    {
+        std::array<uint64_t, MemFieldCount> values{};
+        MemFieldMask found = 0;
+
+        bool has(MemField field) const { return (found & memFieldBit(field)) != 0; }
+        uint64_t get(MemField field) const { return values[static_cast<std::size_t>(field)]; }
+
+        // Value as a share of memPercentBase(field). 0 for fields without
+        // one, or when that total is missing or zero.
+        double percent(MemField field) const
+        {
+            MemField base = memPercentBase(field);
+            if (base == MemField::Count)
+            {
+                return 0.0;
+            }
+            double value = static_cast<double>(get(field));
+            if (field == MemField::HugePagesTotal)
+            {
+                value *= static_cast<double>(get(MemField::Hugepagesize));
+            }
+            uint64_t total = get(base);
+            return total == 0 ? 0.0 : value * 100.0 / static_cast<double>(total);
+        }
+    };
+
+} // namespace SmartDataHub
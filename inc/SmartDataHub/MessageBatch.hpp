@@ -0,0 +1,49 @@
+#pragma once
+#include <sys/socket.h> // mmsghdr
+#include <sys/uio.h>    // iovec
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace SmartDataHub
+{
+    // Preallocated receive slots for recvmmsg().
+    //
+    // All slots live in one contiguous allocation made up front; a batch
+    // receive fills the first size() of them and the messages are handed
+    // out as views. Nothing is allocated per message or per receive.
+    class MessageBatch
+    {
+    private:
+        size_t slotSize;
+        std::vector<char> storage;
+        std::vector<iovec> iovecs;
+        std::vector<mmsghdr> headers;
+        size_t count = 0;
+
+        void linkSlots(); // point every header at its iovec and slot
+
+    public:
+        MessageBatch(size_t capacity, size_t maxMessageSize);
+
+        MessageBatch(const MessageBatch &other);
+        MessageBatch &operator=(const MessageBatch &other);
+        MessageBatch(MessageBatch &&other) noexcept;
+        MessageBatch &operator=(MessageBatch &&other) noexcept;
+        ~MessageBatch() = default;
+
+        // recvmmsg() arguments; every slot is armed for a full-size message
+        mmsghdr *data();
+        unsigned int capacity() const;
+        void setReceived(size_t received);
+
+        size_t size() const;
+        bool empty() const;
+        size_t getSlotSize() const;
+        std::string_view operator[](size_t index) const;
+        // The message was longer than the slot and was cut (MSG_TRUNC)
+        bool truncated(size_t index) const;
+        void clear();
+    };
+
+} // namespace SmartDataHub
@@ -0,0 +1,16 @@
+#pragma once
+#include <string_view>
+
+namespace SmartDataHub
+{
+    // One value of a multi-metric sample (e.g. "Cached" at 31.5 percent of
+    // MemTotal, "sda.read_kBps" at 2048 kB/s). `name` points into the
+    // collector and stays valid until its next sample.
+    struct Metric
+    {
+        std::string_view name;
+        double value = 0.0;
+        std::string_view unit; // empty: percent
+    };
+
+} // namespace SmartDataHub
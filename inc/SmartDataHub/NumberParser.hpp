@@ -0,0 +1,83 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace SmartDataHub
+{
+    // Float parsing for sample payloads ("17.5", "42 13 99.1", "1,2,3").
+    //
+    // Locale-free, allocation-free and exception-free. parseFloats()
+    // classifies 64 bytes at a time (SSE2 where available) into digit and
+    // delimiter masks and takes every token boundary of the window from
+    // them. Plain decimals of up to eight integer and eight fraction digits
+    // are converted here (SWAR for the longer digit runs, see ProcScan.hpp);
+    // everything else (exponents, inf/nan, long mantissas) goes to
+    // std::from_chars. Results match from_chars, except that a decimal
+    // whose digits read as an integer of 2^24 or more is rounded through
+    // double and may differ in the last bit.
+
+    enum class NumberStatus : uint8_t
+    {
+        Ok,
+        Invalid,   // not a number, or trailing characters in the token
+        OutOfRange // a number, but not a finite float
+    };
+
+    std::string_view toString(NumberStatus status) noexcept;
+
+    // Parses the number at `pos` (no leading blanks; '-' allowed) and moves
+    // `pos` past it, like from_chars. On error `pos` is left unchanged.
+    NumberStatus scanFloat(const char *&pos, const char *end, float &value) noexcept;
+
+    // Result of one parseFloats() call
+    struct NumberBatch
+    {
+        size_t count = 0;    // tokens written to values[]/status[]
+        size_t errors = 0;   // of those, not NumberStatus::Ok (value 0)
+        size_t consumed = 0; // bytes of the text used; resume from there
+    };
+
+    // Parses the blank-, comma- or semicolon-separated tokens of `text`
+    // into values[i] with status[i], up to `capacity` tokens. A bad token
+    // costs only its own element. With `offsets`, offsets[i] is where
+    // token i starts in `text`.
+    NumberBatch parseFloats(std::string_view text, float *values, NumberStatus *status, size_t capacity,
+                            size_t *offsets = nullptr) noexcept;
+
+    // One number per record (socket frames, ring records, ingest samples),
+    // all parsed in one parseFloats() pass. Records that follow each other
+    // in one buffer one delimiter apart (newline-framed reads) are parsed
+    // where they are; others are copied end to end. A record's value is
+    // its first token; a record without tokens reads as 0. Views passed to
+    // add() must stay valid until parse(). Buffers are kept between
+    // batches.
+    class RecordValues
+    {
+    public:
+        void clear();
+        void add(std::string_view record);
+        void parse(); // after the last add()
+
+        size_t size() const;
+        float value(size_t record) const;
+        NumberStatus status(size_t record) const;
+
+        // The same rule for a single record
+        static NumberStatus parseOne(std::string_view record, float &value) noexcept;
+
+    private:
+        std::string m_text;           // copied records
+        std::string_view m_span;      // or the records in the caller's buffer
+        bool m_borrowed = false;
+        std::vector<size_t> m_starts; // of each record in the text
+        std::vector<float> m_values;  // per record after parse()
+        std::vector<NumberStatus> m_status;
+        std::vector<float> m_tokenValues;
+        std::vector<NumberStatus> m_tokenStatus;
+        std::vector<size_t> m_tokenOffsets;
+    };
+
+} // namespace SmartDataHub
@@ -0,0 +1,66 @@
+#pragma once
+#include "ITelemetrySource.hpp" // ReadRequest
+#include "Metric.hpp"
+#include "SafeFile.hpp"
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace SmartDataHub
+{
+    // A procfs file sampled into named metrics once per tick.
+    //
+    // The fd is opened once and kept; every sample is one pread of the
+    // whole file from offset 0 into a buffer reused across samples, either
+    // through collect() or as one entry of a batched submission
+    // (prepareRead/completeRead, see ProcSampler). Subclasses only parse.
+    class ProcCollector
+    {
+    private:
+        std::string m_path;
+        SafeFile m_file;
+        std::vector<char> m_buffer;
+        std::vector<std::string> m_filter;
+
+        using Clock = std::chrono::steady_clock;
+        Clock::time_point m_lastSample;
+        bool m_sampled = false;
+
+        bool parseSample(std::string_view content, std::vector<Metric> &metrics);
+
+    protected:
+        // One snapshot of the file. `elapsedSec` is the time since the
+        // previous snapshot, 0 for the first (rate metrics need two).
+        // Appends to `metrics`; names must stay valid until the next call.
+        virtual bool parse(std::string_view content, double elapsedSec, std::vector<Metric> &metrics) = 0;
+
+        // True if `name` (device, interface) passes setFilter()
+        bool accepts(std::string_view name) const;
+        bool hasFilter() const;
+
+    public:
+        explicit ProcCollector(std::string path);
+        virtual ~ProcCollector() = default;
+
+        ProcCollector(const ProcCollector &) = delete;
+        ProcCollector &operator=(const ProcCollector &) = delete;
+
+        bool open();
+        bool isOpen() const;
+        const std::string &getPath() const;
+
+        // Only report these devices/interfaces (empty: all)
+        void setFilter(std::vector<std::string> names);
+
+        // Plain pread + parse
+        bool collect(std::vector<Metric> &metrics);
+
+        // The same read described for a batched submission; the buffer
+        // stays valid until completeRead()
+        bool prepareRead(ReadRequest &request);
+        // Result of that read (bytes or -errno), parsed into `metrics`
+        bool completeRead(int result, std::vector<Metric> &metrics);
+    };
+
+} // namespace SmartDataHub
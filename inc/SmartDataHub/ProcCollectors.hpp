@@ -0,0 +1,95 @@
+#pragma once
+#include "ProcCollector.hpp"
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace SmartDataHub
+{
+    // Counters of every device (or interface) of one sample next to those
+    // of the previous sample. Storage and metric names are kept while the
+    // device list stays the same, so a steady sample allocates nothing.
+    class DeviceCounters
+    {
+    private:
+        size_t m_countersPerDevice;
+        std::vector<std::string_view> m_suffixes;
+        std::vector<std::string> m_devices;
+        std::vector<std::string> m_metricNames; // "<device>.<suffix>", per device
+        std::vector<uint64_t> m_current;
+        std::vector<uint64_t> m_previous;
+        size_t m_count = 0;
+        bool m_changed = false;
+
+    public:
+        DeviceCounters(size_t countersPerDevice, std::initializer_list<std::string_view> metricSuffixes);
+
+        void begin();
+        // Counter slots of the next device in this sample
+        uint64_t *add(std::string_view device);
+        // True if the device list matches the previous sample, i.e.
+        // previous() is a valid baseline for every device
+        bool end();
+
+        size_t size() const;
+        const uint64_t *current(size_t device) const;
+        const uint64_t *previous(size_t device) const;
+        std::string_view metricName(size_t device, size_t metric) const;
+    };
+
+    // /proc/diskstats: per block device read/write IOPS, throughput (kB/s)
+    // and utilization (share of the interval with I/O in flight). loop and
+    // ram devices are skipped unless named in the filter.
+    class DiskStatsCollector : public ProcCollector
+    {
+    private:
+        DeviceCounters m_devices;
+
+    protected:
+        bool parse(std::string_view content, double elapsedSec, std::vector<Metric> &metrics) override;
+
+    public:
+        explicit DiskStatsCollector(std::string path = "/proc/diskstats");
+    };
+
+    // /proc/net/dev: per interface receive/transmit kB/s and packets/s
+    class NetDevCollector : public ProcCollector
+    {
+    private:
+        DeviceCounters m_interfaces;
+
+    protected:
+        bool parse(std::string_view content, double elapsedSec, std::vector<Metric> &metrics) override;
+
+    public:
+        explicit NetDevCollector(std::string path = "/proc/net/dev");
+    };
+
+    // /proc/loadavg: 1/5/15 minute load averages, runnable and total tasks
+    class LoadAvgCollector : public ProcCollector
+    {
+    protected:
+        bool parse(std::string_view content, double elapsedSec, std::vector<Metric> &metrics) override;
+
+    public:
+        explicit LoadAvgCollector(std::string path = "/proc/loadavg");
+    };
+
+    // /proc/pressure/{cpu,memory,io}: "some" and "full" stall averages plus
+    // the stall share of the last interval, from the total= counter
+    class PressureCollector : public ProcCollector
+    {
+    private:
+        uint64_t m_previousTotal[2] = {};
+        bool m_haveTotal[2] = {};
+
+    protected:
+        bool parse(std::string_view content, double elapsedSec, std::vector<Metric> &metrics) override;
+
+    public:
+        explicit PressureCollector(std::string path = "/proc/pressure/cpu");
+    };
+
+} // namespace SmartDataHub
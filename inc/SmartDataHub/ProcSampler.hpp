@@ -0,0 +1,69 @@
+#pragma once
+
+#include "IoUring.hpp"
+#include "Metric.hpp"
+#include "ProcCollector.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace SmartDataHub
+{
+    // One sampling pass per tick across many ProcCollectors.
+    //
+    // Each collector has its own interval; sampleDue() reads every
+    // collector that is due with one io_uring submission (one pread each
+    // when io_uring is off or unavailable), then parses them one after the
+    // other into a reused metric buffer. A read the ring fails is retried
+    // with collect() in the same pass. One thread per sampler.
+    class ProcSampler
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+        // index returned by add(); metrics are valid during the call
+        using MetricsHandler = std::function<void(std::size_t index, const std::vector<Metric> &metrics)>;
+
+    private:
+        struct Entry
+        {
+            std::unique_ptr<ProcCollector> collector;
+            Clock::duration interval;
+            Clock::time_point due;
+        };
+
+        std::vector<Entry> m_entries;
+        IoUring m_ring;
+        bool m_useIoUring;
+        std::vector<std::size_t> m_queued;
+        std::vector<std::size_t> m_fallback;
+        std::vector<Metric> m_metrics;
+
+        uint64_t m_submissions = 0;
+        bool m_opcodeUnsupported = false; // ring turned off after this flush
+        bool m_readFailureLogged = false;
+
+        void flush(const MetricsHandler &onMetrics);
+        void failedRead(int error);
+        void deliver(std::size_t index, bool ok, const MetricsHandler &onMetrics);
+
+    public:
+        explicit ProcSampler(bool useIoUring = false);
+
+        ProcSampler(const ProcSampler &) = delete;
+        ProcSampler &operator=(const ProcSampler &) = delete;
+
+        // Takes an opened collector; the first sample is due right away
+        std::size_t add(std::unique_ptr<ProcCollector> collector, int intervalMs);
+        std::size_t size() const;
+
+        // Samples every due collector; returns when the next one is due
+        Clock::time_point sampleDue(const MetricsHandler &onMetrics);
+
+        bool usesIoUring() const;
+        uint64_t getSubmissions() const; // io_uring_enter() calls
+    };
+
+} // namespace SmartDataHub
@@ -0,0 +1,182 @@
+#pragma once
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace SmartDataHub
+{
+    // Scanners for procfs text ("cpu  4705 356 584 ...", "MemTotal:  16 kB").
+    //
+    // They work on the raw read buffer: no locale, no allocation, no
+    // exceptions. Numbers of up to seven digits are parsed from one 64-bit
+    // load (SWAR: a digit mask and three multiplies, no per-byte loop);
+    // longer ones and the tail of the buffer use std::from_chars.
+
+    namespace detail
+    {
+        constexpr uint64_t SwarOnes = 0x0101010101010101ULL;
+
+        // Number of leading ASCII digits in the 8 bytes of `chunk`
+        inline unsigned swarDigitCount(uint64_t chunk) noexcept
+        {
+            // Only '0'..'9' have a high nibble of 3 both as is and plus 6;
+            // every other byte leaves a non-zero nibble in `bad`
+            uint64_t high = chunk & (SwarOnes * 0xF0);
+            uint64_t shifted = (chunk + SwarOnes * 0x06) & (SwarOnes * 0xF0);
+            uint64_t bad = (high ^ (SwarOnes * 0x30)) | (shifted ^ (SwarOnes * 0x30));
+            return bad == 0 ? 8u : static_cast<unsigned>(__builtin_ctzll(bad)) / 8u;
+        }
+
+        // Value of the first `digits` (1..8) bytes of `chunk`
+        inline uint64_t swarParseDigits(uint64_t chunk, unsigned digits) noexcept
+        {
+            // Move the digits to the top and fill the bottom with '0', i.e.
+            // leading zeros, so one eight-digit reduction fits every length
+            if (digits < 8)
+            {
+                unsigned padBits = (8 - digits) * 8;
+                chunk = (chunk << padBits) | ((SwarOnes * '0') >> (64 - padBits));
+            }
+            uint64_t value = chunk & (SwarOnes * 0x0F);
+            value = (value * 2561) >> 8;
+            value = ((value & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+            return ((value & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+        }
+    } // namespace detail
+
+    // Skips spaces/tabs, parses one unsigned decimal and advances `pos`
+    // past it. False (pos unchanged) if no digit follows or it overflows.
+    inline bool scanUnsigned(const char *&pos, const char *end, uint64_t &value) noexcept
+    {
+        const char *start = pos;
+        while (start < end && (*start == ' ' || *start == '\t'))
+        {
+            ++start;
+        }
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        // Most procfs counters are short: one chunk holds the whole number
+        // and the byte that ends it. Eight digits or more (and the last
+        // bytes of the buffer) go to from_chars, which checks overflow.
+        if (end - start >= 8)
+        {
+            uint64_t chunk;
+            std::memcpy(&chunk, start, sizeof(chunk));
+            unsigned digits = detail::swarDigitCount(chunk);
+            if (digits == 0)
+            {
+                return false;
+            }
+            if (digits < 8)
+            {
+                value = detail::swarParseDigits(chunk, digits);
+                pos = start + digits;
+                return true;
+            }
+        }
+#endif
+
+        uint64_t parsed = 0;
+        auto converted = std::from_chars(start, end, parsed);
+        if (converted.ec != std::errc())
+        {
+            return false;
+        }
+        value = parsed;
+        pos = converted.ptr;
+        return true;
+    }
+
+    // Fixed-point decimal as procfs prints it ("0.52", "12.07", "3"): the
+    // integer and fraction digits go through scanUnsigned, so no locale
+    // and no strtod. False (pos unchanged) if no digit follows.
+    inline bool scanDecimal(const char *&pos, const char *end, double &value) noexcept
+    {
+        static constexpr double Scale[] = {1.0, 1e-1, 1e-2, 1e-3, 1e-4, 1e-5, 1e-6, 1e-7, 1e-8,
+                                           1e-9, 1e-10, 1e-11, 1e-12, 1e-13, 1e-14, 1e-15, 1e-16};
+        const char *cursor = pos;
+        uint64_t whole = 0;
+        if (!scanUnsigned(cursor, end, whole))
+        {
+            return false;
+        }
+        double result = static_cast<double>(whole);
+        if (cursor + 1 < end && *cursor == '.' && static_cast<unsigned char>(cursor[1] - '0') <= 9)
+        {
+            const char *digits = ++cursor;
+            uint64_t fraction = 0;
+            if (!scanUnsigned(cursor, end, fraction) || cursor - digits > 16)
+            {
+                return false;
+            }
+            result += static_cast<double>(fraction) * Scale[cursor - digits];
+        }
+        value = result;
+        pos = cursor;
+        return true;
+    }
+
+    // Parses consecutive blank-separated unsigned fields from the start of
+    // `text` into fields[0..maxFields). Returns how many were found.
+    inline size_t scanFields(std::string_view text, uint64_t *fields, size_t maxFields) noexcept
+    {
+        const char *pos = text.data();
+        const char *end = pos + text.size();
+        size_t count = 0;
+        while (count < maxFields && scanUnsigned(pos, end, fields[count]))
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    // Value of the line "<label> <number> ..." (e.g. "MemAvailable:") in a
+    // procfs key/value file. Searches from `from` and moves it past the
+    // match, so labels in file order are found in one pass.
+    inline bool scanLabeledValue(std::string_view content, size_t &from, std::string_view label,
+                                 uint64_t &value) noexcept
+    {
+        size_t at = from;
+        while ((at = content.find(label, at)) != std::string_view::npos)
+        {
+            if (at == 0 || content[at - 1] == '\n')
+            {
+                const char *pos = content.data() + at + label.size();
+                if (!scanUnsigned(pos, content.data() + content.size(), value))
+                {
+                    return false;
+                }
+                from = static_cast<size_t>(pos - content.data());
+                return true;
+            }
+            at += label.size();
+        }
+        return false;
+    }
+
+    // Next line of `content` starting at `from` (without the '\n');
+    // false once the content is exhausted
+    inline bool nextLine(std::string_view content, size_t &from, std::string_view &line) noexcept
+    {
+        if (from >= content.size())
+        {
+            return false;
+        }
+        const char *start = content.data() + from;
+        const char *newline = static_cast<const char *>(std::memchr(start, '\n', content.size() - from));
+        size_t length = newline == nullptr ? content.size() - from : static_cast<size_t>(newline - start);
+        line = std::string_view(start, length);
+        from += length + 1;
+        return true;
+    }
+
+    // Rate of a monotonic counter between two samples. Counters restart
+    // from 0 when their device or cgroup is re-created: that interval is 0.
+    inline double perSecond(uint64_t current, uint64_t previous, double elapsedSec) noexcept
+    {
+        return current >= previous ? static_cast<double>(current - previous) / elapsedSec : 0.0;
+    }
+
+} // namespace SmartDataHub
@@ -0,0 +1,142 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace async_logging
+{
+    class ThreadPool;
+}
+
+namespace SmartDataHub
+{
+    // One process of a top-N sample. `name` points into the collector and
+    // stays valid until its next sample.
+    struct ProcessUsage
+    {
+        int pid = 0;
+        std::string_view name;   // comm, as in /proc/<pid>/stat
+        double cpuPercent = 0.0; // of one core over the interval (top-style)
+        uint64_t rssKb = 0;
+    };
+
+    // Per-process CPU and RSS from /proc/<pid>/stat, the N busiest per tick.
+    //
+    // Built for hosts with tens of thousands of processes:
+    //   - pids come from getdents64() on one /proc fd kept open, and are
+    //     merged into the previous tick's sorted list, so a process keeps
+    //     its state (and its stat fd) for as long as it lives
+    //   - stat fds are opened with openat() relative to that fd and kept
+    //     open up to `maxOpenFds`, but never more than a quarter of the
+    //     RLIMIT_NOFILE soft limit, so sockets and log files of the rest
+    //     of the process still get fds; beyond that a read opens and
+    //     closes. On EMFILE/ENFILE the shard closes fds it kept and
+    //     retries rather than skipping the pid.
+    //   - every read is a pread into a slot of one arena, parsed in place
+    //   - with a ThreadPool the pid list is split into contiguous shards,
+    //     each keeping a bounded min-heap of its N busiest; the heaps are
+    //     merged on the calling thread
+    // One thread calls sample(); the pool only runs the shards.
+    class ProcessCollector
+    {
+    public:
+        explicit ProcessCollector(std::string procRoot = "/proc", std::size_t maxOpenFds = 1024);
+        ~ProcessCollector();
+
+        ProcessCollector(const ProcessCollector &) = delete;
+        ProcessCollector &operator=(const ProcessCollector &) = delete;
+
+        bool open();
+        bool isOpen() const;
+
+        // Shards run on `pool` (nullptr: on the calling thread only)
+        void setThreadPool(async_logging::ThreadPool *pool);
+
+        // Rescans the pids and fills `top` with the `topN` busiest
+        // processes since the previous call, busiest first. The first call
+        // only sets the baseline (`top` empty).
+        bool sample(std::size_t topN, std::vector<ProcessUsage> &top);
+
+        std::size_t getProcessCount() const;
+        std::size_t getOpenFdCount() const;
+        std::size_t getMaxOpenFds() const; // after the RLIMIT_NOFILE cap
+
+        // Fields of one /proc/<pid>/stat line. False if it is malformed.
+        struct StatFields
+        {
+            std::string_view comm;
+            uint64_t ticks = 0;     // utime + stime
+            uint64_t startTime = 0; // ticks after boot
+            uint64_t rssPages = 0;
+        };
+        static bool parseStat(std::string_view content, StatFields &fields) noexcept;
+
+    private:
+        static constexpr std::size_t CommCapacity = 64;
+
+        struct Process
+        {
+            int pid = 0;
+            int fd = -1;
+            uint64_t startTime = 0;
+            uint64_t ticks = 0;
+            uint64_t delta = 0; // ticks during the last interval
+            uint64_t rssPages = 0;
+            bool known = false;  // ticks/startTime are from an earlier read
+            bool ranked = false; // delta covers the last interval
+            uint8_t commLength = 0;
+            char comm[CommCapacity];
+        };
+
+        // Min-heap entry: the busiest stay, the least busy is evicted
+        struct Candidate
+        {
+            uint64_t delta;
+            std::size_t index;
+        };
+
+        struct Shard
+        {
+            std::size_t begin = 0;
+            std::size_t end = 0;
+            char *slot = nullptr;
+            std::size_t evict = 0;   // next kept fd to close on EMFILE
+            bool exhausted = false;  // hit EMFILE: keep no new fds this tick
+            std::vector<Candidate> heap;
+        };
+
+        std::string m_procRoot;
+        int m_rootFd = -1;
+        std::size_t m_maxOpenFds;
+        std::atomic<std::size_t> m_openFds{0};
+        async_logging::ThreadPool *m_pool = nullptr;
+
+        std::vector<char> m_dirents; // getdents64() buffer
+        std::vector<int> m_pids;     // this tick, sorted
+        std::vector<Process> m_processes;
+        std::vector<Process> m_merged;
+        std::vector<char> m_arena; // one read slot per shard
+        std::vector<Shard> m_shards;
+        std::vector<Candidate> m_top;
+
+        using Clock = std::chrono::steady_clock;
+        Clock::time_point m_lastSample;
+        uint64_t m_lastSampleTicks = 0; // boot-relative, for new processes
+        bool m_sampled = false;
+        long m_ticksPerSecond;
+        long m_pageKb;
+
+        bool listPids();
+        void mergePids();
+        void closeProcess(Process &process);
+        void scanShard(Shard &shard, std::size_t topN);
+        bool readStat(Process &process, Shard &shard);
+        bool releaseFd(Shard &shard, const Process &keep);
+        uint64_t bootTicks() const;
+    };
+
+} // namespace SmartDataHub
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "ITelemetrySource.hpp"
+#include "ReplayTrace.hpp"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace SmartDataHub
+{
+
+    // Plays a recorded trace (see ReplayTrace) back as a live source, for
+    // load tests that reproduce a production incident.
+    //
+    // Samples come out at their recorded offsets from the first one,
+    // divided by `speed` (1 = as recorded, N = N times faster, 0 = as fast
+    // as the reader takes them). Due times are absolute from openSource(),
+    // so a slow reader catches up instead of shifting the rest of the
+    // trace; getMaxLagUs() shows how far behind it fell. A timerfd armed
+    // at the next due time is the poll fd, so many streams can share one
+    // TelemetryReactor thread; each wakeup hands out at most MaxBurst
+    // samples before yielding. Several streams may play one trace.
+    class ReplayTelemetrySourceImpl : public ITelemetrySource
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr size_t MaxBurst = 256;
+
+        explicit ReplayTelemetrySourceImpl(const std::string &path, double speed = 1.0, bool loop = false);
+        explicit ReplayTelemetrySourceImpl(std::shared_ptr<const ReplayTrace> trace, double speed = 1.0,
+                                           bool loop = false);
+        ~ReplayTelemetrySourceImpl() override;
+
+        ReplayTelemetrySourceImpl(const ReplayTelemetrySourceImpl &) = delete;
+        ReplayTelemetrySourceImpl &operator=(const ReplayTelemetrySourceImpl &) = delete;
+
+        // ITelemetrySource interface implementation.
+        // openSource() (re)starts playback from the first sample.
+        bool openSource() override;
+        bool readSource(std::string &out) override; // copies the next due sample
+        int getPollFd() const override;
+        bool acknowledgeReady() override;
+        bool hasPendingData() const override;
+
+        // Next due sample, in place (valid as long as the trace)
+        bool readRecord(std::string_view &record);
+        // Due samples, up to MaxBurst. Returns the number added.
+        size_t readRecords(std::vector<std::string_view> &records);
+        // Sleeps until a sample is due (true) or timeoutMs passes (false)
+        bool waitForData(int timeoutMs);
+
+        // End of a trace played without loop
+        bool isFinished() const;
+        uint64_t getReplayedCount() const;
+        uint64_t getMaxLagUs() const;
+        const std::shared_ptr<const ReplayTrace> &getTrace() const;
+
+    private:
+        std::string m_path;
+        std::shared_ptr<const ReplayTrace> m_trace;
+        double m_speed;
+        bool m_loop;
+        int m_timerFd = -1;
+
+        Clock::time_point m_start;
+        size_t m_offset = 0;
+        uint64_t m_firstUs = 0;     // first timestamp of the trace
+        uint64_t m_lastUs = 0;      // of the current pass, never decreasing
+        uint64_t m_loopShiftUs = 0; // added per completed pass
+        uint64_t m_passRecords = 0;
+
+        bool m_haveNext = false;
+        std::string_view m_next;
+        Clock::time_point m_nextDue;
+        size_t m_burst = MaxBurst;
+
+        uint64_t m_replayed = 0;
+        uint64_t m_maxLagUs = 0;
+
+        bool loadNext();
+        void arm();
+    };
+
+} // SmartDataHub
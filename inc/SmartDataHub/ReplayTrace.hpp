@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace SmartDataHub
+{
+    // Binary traces start with these 8 bytes; anything else is read as text
+    constexpr char ReplayBinaryMagic[8] = {'T', 'L', 'M', 'T', 'R', 'C', '1', '\n'};
+    constexpr size_t ReplayRecordHeaderSize = sizeof(uint64_t) + sizeof(uint32_t);
+
+    enum class ReplayFormat
+    {
+        Text,   // "<timestamp us> <sample>\n"; blank and '#' lines skipped
+        Binary, // magic, then per record: uint64 timestamp us, uint32 length,
+                // sample bytes (host byte order, no padding)
+    };
+
+    // A recorded telemetry trace, mmap-ed read-only and shared by every
+    // replay stream playing it. Records are not indexed: a stream walks
+    // the mapping with next(), so opening is O(1) and many streams over
+    // one trace cost one mapping. Samples are views into the mapping and
+    // stay valid as long as the trace.
+    class ReplayTrace
+    {
+    public:
+        // nullptr if the file cannot be opened or mapped
+        static std::shared_ptr<const ReplayTrace> open(const std::string &path);
+        ~ReplayTrace();
+
+        ReplayTrace(const ReplayTrace &) = delete;
+        ReplayTrace &operator=(const ReplayTrace &) = delete;
+
+        // Offset of the first record
+        size_t begin() const;
+        // Record at `offset`, which is moved past it. False at the end of
+        // the trace (or at a truncated binary record). Malformed text lines
+        // are skipped.
+        bool next(size_t &offset, uint64_t &timeUs, std::string_view &sample) const;
+
+        ReplayFormat getFormat() const;
+        const std::string &getPath() const;
+        size_t getSize() const;
+
+        // Appends one binary record (after ReplayBinaryMagic) to `out`
+        static void appendBinaryRecord(std::string &out, uint64_t timeUs, std::string_view sample);
+
+    private:
+        ReplayTrace(std::string path, const char *data, size_t size);
+
+        std::string m_path;
+        const char *m_data;
+        size_t m_size;
+        ReplayFormat m_format;
+
+        bool nextText(size_t &offset, uint64_t &timeUs, std::string_view &sample) const;
+        bool nextBinary(size_t &offset, uint64_t &timeUs, std::string_view &sample) const;
+    };
+
+} // namespace SmartDataHub
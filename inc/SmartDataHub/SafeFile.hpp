@@ -2,7 +2,11 @@
 
 #include <unistd.h> // read, write, close, lseek
 #include <fcntl.h>  // open, O_RDONLY, O_WRONLY
+#include <sys/uio.h> // writev, iovec
+#include <initializer_list>
 #include <string>
+#include <string_view>
+#include <vector>
 namespace SmartDataHub
 {
 
@@ -11,6 +15,18 @@ namespace SmartDataHub
     private:
         int _fd = -1;
 
+        // Read-ahead buffer: readline() refills it with large reads and
+        // scans it with memchr instead of issuing one read() per byte
+        std::vector<char> _readBuf;
+        size_t _readPos = 0; // first unconsumed byte
+        size_t _readEnd = 0; // one past the last buffered byte
+
+        // Whole-file snapshot kept separately so it does not disturb readline()
+        std::vector<char> _snapshotBuf;
+
+        void resetReadBuffer();
+        bool fillReadBuffer(ssize_t &NoOfBytes);
+
     public:
         // rule of 5
         SafeFile() = default;
@@ -25,8 +41,32 @@ namespace SmartDataHub
 
         // Operations
         bool openFile(const char *_path, const int &flags);
+        // Both return false at end of file once no data is left.
+        // The string_view overload points into the internal buffer and
+        // stays valid until the next read, seek or close.
         bool readline(std::string &line);
-        bool writeline(std::string &line);
+        bool readline(std::string_view &line);
+        // Reads the whole file from offset 0 with pread, leaving the file
+        // position alone. Meant for /proc and sysfs files that are sampled
+        // repeatedly through one open fd. The buffer grows until the
+        // content fits and is reused across calls; the view stays valid
+        // until the next readSnapshot() or close.
+        bool readSnapshot(std::string_view &content);
+        // Writes go out in as few syscalls as possible: short writes are
+        // continued and EINTR is retried, so true means every byte landed.
+        bool writeline(const std::string &line);
+        bool writeAll(std::string_view data);
+        bool writev(const struct iovec *buffers, int count);
+        bool writev(std::initializer_list<std::string_view> buffers);
+        // line + '\n' in a single writev
+        bool appendLine(std::string_view line);
+
+        // Atomic-line mode: switches the fd to O_APPEND so every write lands
+        // at the current end of file. Combined with appendLine() (one
+        // syscall per line) several processes can share one output file
+        // without interleaving inside a line.
+        bool setAtomicAppend(bool enable);
+        bool isAtomicAppend() const;
         void closeFile();
         void seekToBeginning();
         // Utilities
@@ -4,13 +4,24 @@
 #include <unistd.h>     // close()
 #include <string>
 #include <cstring> // memset(), strcpy()
+#include "MessageBatch.hpp"
 
 namespace SmartDataHub
 {
+    // AF_UNIX socket type
+    enum class SocketKind
+    {
+        Stream,    // SOCK_STREAM: byte stream, needs framing
+        SeqPacket, // SOCK_SEQPACKET: connected, message boundaries kept
+        Datagram   // SOCK_DGRAM: connectionless, receiver binds the path
+    };
+
     class SafeSocket
     {
     private:
         int sockfd = -1 ; 
+        SocketKind kind = SocketKind::Stream;
+        std::string boundPath; // unlinked again on close
     public:
         // Constructors
         SafeSocket() = default;
@@ -23,15 +34,25 @@ namespace SmartDataHub
         SafeSocket &operator=(const SafeSocket &) = delete;
 
         // Operations
-        bool createSocket();                         // Creates socket
+        bool createSocket(SocketKind type = SocketKind::Stream); // Creates socket
         bool connectSocket(const std::string &path); // Connects to server
+        // Receives datagrams sent to path. A socket file there that nobody
+        // is bound to is replaced; anything else fails with EADDRINUSE.
+        // Paths longer than sun_path fail with ENAMETOOLONG.
+        bool bindSocket(const std::string &path);
+        bool listenSocket(const std::string &path, int backlog = SOMAXCONN); // Server: bind + listen
+        bool acceptConnection(SafeSocket &client);   // accept4(), non-blocking; false when none pending
         ssize_t sendData(const std::string &data);   // Sends data
         ssize_t receiveData(std::string &data);      // Receives data
+        ssize_t receiveInto(char *buffer, size_t length); // recv() straight into caller memory
+        int receiveBatch(MessageBatch &batch);       // recvmmsg(): every queued message, one syscall
         void closeSocket();                          // Closes socket
 
         // Utilities
         bool isConnected() const;
         int getFd() const;
+        SocketKind getKind() const;
+        int getPeerPid() const; // SO_PEERCRED of a connected socket, -1 if unknown
     };
 
 } // namespace SmartDataHub
@@ -0,0 +1,84 @@
+#pragma once
+#include <linux/futex.h> // FUTEX_WAIT, FUTEX_WAKE
+#include <sys/syscall.h> // SYS_futex
+#include <unistd.h>      // syscall()
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+
+namespace SmartDataHub
+{
+    // Shared-memory SPSC ring used by ShmRingWriter (producer process) and
+    // ShmTelemetrySourceImpl (consumer). Both sides include this header;
+    // it is the whole protocol.
+    //
+    // Memory layout (shm_open object, native byte order):
+    //
+    //   offset    0  ShmRingHeader  (4 cache lines, see below)
+    //   offset  256  data area      (capacity bytes, power of two)
+    //
+    // Positions (head, tail) are monotonic byte counters; the offset into
+    // the data area is position & (capacity - 1). A record is
+    //
+    //   uint32_t length | payload | padding to a multiple of 8
+    //
+    // and never straddles the end of the data area: if it does not fit,
+    // the writer stores a length of ShmRingWrapMarker and continues at
+    // offset 0. Records can therefore be read in place as one contiguous
+    // view. The reader publishes tail only after it is done with a view.
+    //
+    // Wakeup: a reader that finds the ring empty sets readerWaiting and
+    // sleeps on wakeSequence (futex). A writer that turned the ring from
+    // empty to non-empty while readerWaiting is set bumps wakeSequence and
+    // issues FUTEX_WAKE; every other write is just a store.
+    constexpr uint32_t ShmRingMagic = 0x544C4D52; // "TLMR"
+    constexpr uint32_t ShmRingVersion = 1;
+    constexpr uint32_t ShmRingWrapMarker = 0xFFFFFFFF;
+    constexpr size_t ShmRingRecordAlign = 8;
+    constexpr size_t ShmRingLengthSize = sizeof(uint32_t);
+
+    struct ShmRingHeader
+    {
+        // Written once by the consumer before producers attach
+        alignas(64) uint32_t magic;
+        uint32_t version;
+        uint64_t capacity;
+
+        alignas(64) std::atomic<uint64_t> head; // written by the producer
+        alignas(64) std::atomic<uint64_t> tail; // written by the consumer
+
+        alignas(64) std::atomic<uint32_t> readerWaiting;
+        std::atomic<uint32_t> wakeSequence; // futex word
+    };
+
+    static_assert(sizeof(ShmRingHeader) == 256, "ShmRingHeader layout is part of the protocol");
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "ring positions must be lock-free");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "futex word must be lock-free");
+
+    constexpr size_t ShmRingDataOffset = sizeof(ShmRingHeader);
+
+    // Bytes a record of `length` occupies in the data area
+    inline size_t shmRingRecordSize(size_t length)
+    {
+        return (ShmRingLengthSize + length + ShmRingRecordAlign - 1) & ~(ShmRingRecordAlign - 1);
+    }
+
+    // Largest payload a ring accepts; keeps wrap padding from starving it
+    inline size_t shmRingMaxRecord(uint64_t capacity)
+    {
+        return static_cast<size_t>(capacity / 4) - ShmRingLengthSize;
+    }
+
+    // Shared (not process-private) futex operations on the ring header
+    inline void shmRingFutexWake(std::atomic<uint32_t> &word)
+    {
+        syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+    }
+
+    inline void shmRingFutexWait(std::atomic<uint32_t> &word, uint32_t expected, const timespec *timeout)
+    {
+        syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT, expected, timeout, nullptr, 0);
+    }
+
+} // namespace SmartDataHub
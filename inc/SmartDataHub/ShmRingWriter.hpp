@@ -0,0 +1,200 @@
+#pragma once
+#include "ShmRingLayout.hpp"
+#include <fcntl.h>    // O_RDWR
+#include <sys/mman.h> // shm_open(), mmap()
+#include <sys/stat.h> // fstat()
+#include <unistd.h>   // close()
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace SmartDataHub
+{
+    // Producer side of the shared-memory ring (header-only, so agents only
+    // need this header and ShmRingLayout.hpp).
+    //
+    // Attaches to a ring created by ShmTelemetrySourceImpl. Exactly one
+    // writer per ring. tryWrite() never blocks: a full ring drops the record
+    // and counts it, so a stalled consumer cannot stall the producer.
+    class ShmRingWriter
+    {
+    private:
+        int m_fd = -1;
+        void *m_map = nullptr;
+        size_t m_mapSize = 0;
+        ShmRingHeader *m_header = nullptr;
+        char *m_data = nullptr;
+        uint64_t m_capacity = 0;
+        uint64_t m_head = 0;       // next write position (private copy of head)
+        uint64_t m_cachedTail = 0; // refreshed only when the ring looks full
+        uint64_t m_dropped = 0;
+        uint64_t m_wakeups = 0;
+
+    public:
+        ShmRingWriter() = default;
+        ~ShmRingWriter()
+        {
+            detach();
+        }
+
+        ShmRingWriter(const ShmRingWriter &) = delete;
+        ShmRingWriter &operator=(const ShmRingWriter &) = delete;
+
+        ShmRingWriter(ShmRingWriter &&other) noexcept
+        {
+            *this = std::move(other);
+        }
+        ShmRingWriter &operator=(ShmRingWriter &&other) noexcept
+        {
+            if (this != &other)
+            {
+                detach();
+                m_fd = other.m_fd;
+                m_map = other.m_map;
+                m_mapSize = other.m_mapSize;
+                m_header = other.m_header;
+                m_data = other.m_data;
+                m_capacity = other.m_capacity;
+                m_head = other.m_head;
+                m_cachedTail = other.m_cachedTail;
+                m_dropped = other.m_dropped;
+                m_wakeups = other.m_wakeups;
+                other.m_fd = -1;
+                other.m_map = nullptr;
+                other.m_header = nullptr;
+            }
+            return *this;
+        }
+
+        // `name` as given to ShmTelemetrySourceImpl (e.g. "/tlm-gpu")
+        bool attach(const std::string &name)
+        {
+            detach();
+            m_fd = shm_open(name.c_str(), O_RDWR | O_CLOEXEC, 0);
+            if (m_fd < 0)
+            {
+                return false;
+            }
+
+            struct stat info;
+            if (fstat(m_fd, &info) != 0 || static_cast<size_t>(info.st_size) < ShmRingDataOffset)
+            {
+                detach();
+                return false;
+            }
+            m_mapSize = static_cast<size_t>(info.st_size);
+            m_map = mmap(nullptr, m_mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+            if (m_map == MAP_FAILED)
+            {
+                m_map = nullptr;
+                detach();
+                return false;
+            }
+
+            m_header = static_cast<ShmRingHeader *>(m_map);
+            m_capacity = m_header->capacity;
+            if (m_header->magic != ShmRingMagic || m_header->version != ShmRingVersion ||
+                m_mapSize < ShmRingDataOffset + m_capacity)
+            {
+                detach();
+                return false;
+            }
+
+            m_data = static_cast<char *>(m_map) + ShmRingDataOffset;
+            m_head = m_header->head.load(std::memory_order_relaxed);
+            m_cachedTail = m_header->tail.load(std::memory_order_acquire);
+            return true;
+        }
+
+        void detach()
+        {
+            if (m_map != nullptr)
+            {
+                munmap(m_map, m_mapSize);
+                m_map = nullptr;
+            }
+            if (m_fd >= 0)
+            {
+                close(m_fd);
+                m_fd = -1;
+            }
+            m_header = nullptr;
+            m_data = nullptr;
+        }
+
+        bool isAttached() const
+        {
+            return m_header != nullptr;
+        }
+
+        // Copies the record into the ring and publishes it; false (and
+        // counted as dropped) if the ring is full or the record too large
+        bool tryWrite(std::string_view record)
+        {
+            if (m_header == nullptr)
+            {
+                return false;
+            }
+            if (record.size() > shmRingMaxRecord(m_capacity))
+            {
+                ++m_dropped;
+                return false;
+            }
+
+            size_t size = shmRingRecordSize(record.size());
+            uint64_t offset = m_head & (m_capacity - 1);
+            uint64_t untilEnd = m_capacity - offset;
+            uint64_t needed = size > untilEnd ? untilEnd + size : size;
+
+            if (m_head + needed - m_cachedTail > m_capacity)
+            {
+                m_cachedTail = m_header->tail.load(std::memory_order_acquire);
+                if (m_head + needed - m_cachedTail > m_capacity)
+                {
+                    ++m_dropped;
+                    return false;
+                }
+            }
+
+            uint64_t published = m_head;
+            if (size > untilEnd)
+            {
+                // Records stay contiguous: skip the tail end of the area
+                uint32_t marker = ShmRingWrapMarker;
+                std::memcpy(m_data + offset, &marker, sizeof(marker));
+                m_head += untilEnd;
+                offset = 0;
+            }
+
+            uint32_t length = static_cast<uint32_t>(record.size());
+            std::memcpy(m_data + offset, &length, sizeof(length));
+            std::memcpy(m_data + offset + ShmRingLengthSize, record.data(), record.size());
+            m_head += size;
+
+            // seq_cst store/load pair with the reader's readerWaiting/head:
+            // either it sees this record or this writer sees it waiting
+            m_header->head.store(m_head, std::memory_order_seq_cst);
+            if (m_header->readerWaiting.load(std::memory_order_seq_cst) != 0 &&
+                m_header->tail.load(std::memory_order_seq_cst) == published)
+            {
+                // The ring went from empty to non-empty under a sleeping reader
+                m_header->wakeSequence.fetch_add(1, std::memory_order_seq_cst);
+                shmRingFutexWake(m_header->wakeSequence);
+                ++m_wakeups;
+            }
+            return true;
+        }
+
+        uint64_t getDropped() const
+        {
+            return m_dropped;
+        }
+
+        // FUTEX_WAKE calls issued (the only syscalls on the write path)
+        uint64_t getWakeups() const
+        {
+            return m_wakeups;
+        }
+    };
+
+} // namespace SmartDataHub
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "ITelemetrySource.hpp"
+#include "ShmRingLayout.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace SmartDataHub
+{
+
+    // Consumer side of the shared-memory ring (layout in ShmRingLayout.hpp).
+    //
+    // openSource() creates the shm object `name` (e.g. "/tlm-gpu") and
+    // initialises the ring; it returns at once, and one ShmRingWriter may
+    // attach by name at any time after. The object is unlinked again when
+    // the source is destroyed. Records are read in place: a view stays
+    // valid until the next read or wait on this source, which is when its
+    // space is handed back to the writer.
+    //
+    // A head or record length from the writer that would reach outside the
+    // data area is ring corruption: it is reported on stderr, no further
+    // records are returned, and the next read or wait closes the ring
+    // (isOpen() turns false, isCorrupt() true).
+    class ShmTelemetrySourceImpl : public ITelemetrySource
+    {
+    private:
+        std::string m_name;
+        size_t m_capacity;
+        int m_fd = -1;
+        void *m_map = nullptr;
+        size_t m_mapSize = 0;
+        ShmRingHeader *m_header = nullptr;
+        const char *m_data = nullptr;
+        uint64_t m_readPos = 0;    // end of the records handed out so far
+        uint64_t m_cachedHead = 0; // refreshed only when caught up
+        bool m_corrupt = false;
+
+        bool nextRecord(std::string_view &record);
+        void markCorrupt(const char *reason);
+        bool closeIfCorrupt(); // true if the ring is (now) closed
+        void closeRing();
+
+    public:
+        // capacity is rounded up to a power of two (at least 4 KiB)
+        explicit ShmTelemetrySourceImpl(const std::string &name, size_t capacity = 1024 * 1024);
+        ~ShmTelemetrySourceImpl() override;
+
+        ShmTelemetrySourceImpl(const ShmTelemetrySourceImpl &) = delete;
+        ShmTelemetrySourceImpl &operator=(const ShmTelemetrySourceImpl &) = delete;
+
+        // ITelemetrySource interface implementation
+        bool openSource() override;
+        bool readSource(std::string &out) override; // copies one record
+        bool hasPendingData() const override;
+
+        // Next record, in place
+        bool readRecord(std::string_view &record);
+        // Every record available now, in place. Returns the number added.
+        size_t readRecords(std::vector<std::string_view> &records);
+        // Hands the space of the views returned so far back to the writer
+        void releaseRecords();
+
+        // Sleeps on the ring's futex until a record arrives (true) or
+        // timeoutMs passes (false). Releases outstanding views first.
+        bool waitForData(int timeoutMs);
+
+        // Utilities
+        bool isOpen() const;
+        bool isCorrupt() const; // closed for a bad head or record length
+        const std::string &getName() const;
+        size_t getCapacity() const;
+    };
+
+} // SmartDataHub
@@ -2,6 +2,10 @@
 
 #include "ITelemetrySource.hpp"
 #include "SafeSocket.hpp"
+#include "FrameParser.hpp"
+#include <optional>
+#include <string_view>
+#include <vector>
 
 namespace SmartDataHub
 {
@@ -11,15 +15,57 @@ namespace SmartDataHub
     private:
         SafeSocket m_socket;
         std::string m_socketpath;
+        FrameParser m_frames; // reassembly buffer, survives across reads
+        SocketKind m_kind = SocketKind::Stream;
+        std::optional<MessageBatch> m_batch; // message-oriented kinds only
+        size_t m_batchPos = 0;               // next message readSource() hands out
+        bool m_peerClosed = false;
+
+        // One recv() into the reassembly buffer; false on EOF/EAGAIN/error
+        bool receiveChunk();
+        // One recvmmsg() into m_batch; false when nothing was received
+        bool receiveMessages();
 
     public:
-        explicit SocketTelemetrySourceImpl(const std::string &path);
+        // Raw keeps the historical behaviour: one recv() = one message
+        explicit SocketTelemetrySourceImpl(const std::string &path,
+                                           FramingMode framing = FramingMode::Raw,
+                                           size_t maxFrameSize = 64 * 1024);
+        // Message-oriented socket: each datagram / packet is one sample and
+        // up to batchSize of them are pulled per recvmmsg(). SeqPacket
+        // connects to `path`; Datagram binds it and producers sendto() it.
+        // SeqPacket reports an empty message as the peer closing.
+        SocketTelemetrySourceImpl(const std::string &path, SocketKind kind,
+                                  size_t batchSize = 64, size_t maxMessageSize = 4096);
         // Rule of 0: NO special member functions
         // Compiler generates them using SafeFile's Rule of 5
 
         // ITelemetrySource interface implementation
         bool openSource() override;
+        // Next complete frame; receives more only when none is buffered
         bool readSource(std::string &out) override;
+
+        // Performs at most one recv() (recvmmsg() for message kinds) and
+        // appends every complete frame now buffered to `frames` (views into
+        // the source's buffer, valid until the next read on this source).
+        // Returns the number added.
+        size_t readFrames(std::vector<std::string_view> &frames);
+
+        // Reactor support: the (non-blocking) socket itself
+        int getPollFd() const override;
+        bool hasPendingData() const override;
+        // Peer closed, or the stream is corrupt and no longer read
+        bool isClosed() const override;
+
+        // Batched I/O support: stream sockets with no frame buffered
+        bool prepareRead(ReadRequest &request) override;
+        bool completeRead(int result, std::string &out) override;
+
+        // Utilities
+        bool isPeerClosed() const;
+        SocketKind getKind() const;
+        // Length-prefixed stream carried a frame above maxFrameSize
+        bool isCorrupt() const;
     };
 
 } // SmartDataHub
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "FrameParser.hpp"
+#include "SafeSocket.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace SmartDataHub
+{
+    // One sample pushed by an agent; both views are valid only for the
+    // duration of the BatchHandler call
+    struct IngestSample
+    {
+        std::string_view source; // connection identity
+        std::string_view data;
+    };
+
+    struct IngestLimits
+    {
+        size_t maxConnections = 4096; // further clients are accepted and closed at once; start()
+                                      // lowers it to half the RLIMIT_NOFILE soft limit
+        size_t maxFrameSize = 4096;   // longer frames are dropped (newline) or close the connection
+        int backlog = SOMAXCONN;
+    };
+
+    struct IngestStats
+    {
+        uint64_t accepted = 0;
+        uint64_t rejected = 0; // over maxConnections, or no fd left to accept them
+        uint64_t active = 0;
+        uint64_t samples = 0;
+        uint64_t corrupt = 0; // connections closed for an oversized length prefix
+        uint64_t droppedBytes = 0;
+    };
+
+    // Listening Unix-socket endpoint many local agents push samples into.
+    //
+    // A single thread runs an epoll loop over the listening socket and every
+    // connection (accept4, non-blocking, level-triggered, one recv per
+    // connection per wakeup). Each connection owns a FrameParser: nothing is
+    // allocated before its first byte, steady traffic keeps one 4 KiB buffer,
+    // bursts are released once consumed, and no connection can hold more
+    // than about twice maxFrameSize.
+    //
+    // When accept4() fails with EMFILE/ENFILE the pending clients would keep
+    // the level-triggered listener readable and the loop spinning. A spare
+    // fd is kept for this: it is closed to accept one client, which is then
+    // closed (counted as rejected), and reopened. If even that fails the
+    // listener is left out of the epoll set and tried again every 100 ms.
+    //
+    // A connection's identity is "pid:<pid>" (SO_PEERCRED) unless its first
+    // frame is "@<name>", which names it instead and is not a sample.
+    // All samples read in one epoll round go to the handler as one batch.
+    class TelemetryIngestServer
+    {
+    public:
+        using BatchHandler = std::function<void(const std::vector<IngestSample> &batch)>;
+        using ThreadStartHook = std::function<void()>;
+
+        static constexpr char IdentityPrefix = '@';
+
+    private:
+        struct Connection
+        {
+            SafeSocket socket;
+            FrameParser frames;
+            std::string identity;
+            bool named = false; // first frame seen
+            bool closing = false;
+
+            Connection(SafeSocket &&accepted, FramingMode framing, size_t maxFrameSize);
+        };
+
+        std::string m_path;
+        FramingMode m_framing;
+        IngestLimits m_limits;
+        BatchHandler m_handler;
+        ThreadStartHook m_threadStartHook;
+
+        SafeSocket m_listener;
+        int m_epollFd = -1;
+        int m_wakeFd = -1;
+        int m_spareFd = -1;      // given up to reject clients on EMFILE
+        bool m_listening = true; // listener in the epoll set
+        std::chrono::steady_clock::time_point m_parkedAt;
+        std::unordered_map<int, std::unique_ptr<Connection>> m_connections; // by fd
+        std::vector<IngestSample> m_batch;
+        std::vector<Connection *> m_touched; // read this round
+        std::thread m_thread;
+        std::atomic<bool> m_running{false};
+
+        std::atomic<uint64_t> m_accepted{0};
+        std::atomic<uint64_t> m_rejected{0};
+        std::atomic<uint64_t> m_active{0};
+        std::atomic<uint64_t> m_samples{0};
+        std::atomic<uint64_t> m_corrupt{0};
+        std::atomic<uint64_t> m_droppedBytes{0};
+
+        void run();
+        void acceptPending();
+        void rejectPending(); // out of fds
+        bool openSpare();
+        void setListening(bool listening);
+        void readConnection(Connection &connection);
+        void finishRound(); // hand out the batch, then release/close
+        void closeConnection(Connection &connection);
+
+    public:
+        TelemetryIngestServer(const std::string &path, BatchHandler handler,
+                              FramingMode framing = FramingMode::Newline, IngestLimits limits = {});
+        ~TelemetryIngestServer();
+
+        TelemetryIngestServer(const TelemetryIngestServer &) = delete;
+        TelemetryIngestServer &operator=(const TelemetryIngestServer &) = delete;
+
+        void setThreadStartHook(ThreadStartHook hook);
+
+        // Binds the path (replacing a stale socket file) and starts the loop
+        bool start();
+        void stop(); // closes every connection and unlinks the path
+
+        bool isRunning() const;
+        IngestStats getStats() const;
+        const IngestLimits &getLimits() const; // after start()'s fd limit clamp
+        const std::string &getPath() const;
+    };
+
+} // namespace SmartDataHub
@@ -1,55 +1,120 @@
 #pragma once
 
 #include "FileTelemetrySourceImpl.hpp"
+#include "MemInfo.hpp"
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace SmartDataHub
 {
 
 class TelemetryParser
 {
-private:
-    // Data sources (using YOUR existing class!)
-    FileTelemetrySourceImpl m_cpuSource;
-    FileTelemetrySourceImpl m_memSource;
-
+public:
     // CPU stats structure (for tracking between reads)
     struct CpuStats
     {
-        unsigned long long user = 0;
-        unsigned long long nice = 0;
-        unsigned long long system = 0;
-        unsigned long long idle = 0;
-        unsigned long long iowait = 0;
-        unsigned long long irq = 0;
-        unsigned long long softirq = 0;
-        unsigned long long steal = 0;
-
-        unsigned long long getTotal() const;
-        unsigned long long getIdle() const;
+        uint64_t user = 0;
+        uint64_t nice = 0;
+        uint64_t system = 0;
+        uint64_t idle = 0;
+        uint64_t iowait = 0;
+        uint64_t irq = 0;
+        uint64_t softirq = 0;
+        uint64_t steal = 0;
+
+        uint64_t getTotal() const;
+        uint64_t getIdle() const;
+    };
+
+    // Per-core counters from the "cpuN" lines, one array per field
+    // (structure of arrays) so the delta loop walks contiguous lanes
+    struct PerCoreCounters
+    {
+        std::vector<uint32_t> core;   // N of "cpuN" (offline cores are absent)
+        std::vector<uint64_t> total;  // CpuStats::getTotal()
+        std::vector<uint64_t> idle;   // CpuStats::getIdle()
+
+        std::size_t size() const { return core.size(); }
     };
 
+    struct CoreUsage
+    {
+        uint32_t core = 0;
+        float usage = 0.0f;  // percent
+    };
+
+private:
+    // Data sources (using YOUR existing class!)
+    FileTelemetrySourceImpl m_cpuSource;
+    FileTelemetrySourceImpl m_memSource;
+
     CpuStats m_prevCpu;
     CpuStats m_currCpu;
     bool m_firstRead = true;
 
+    // Per-core mode: previous/current swap each sample, storage is reused
+    PerCoreCounters m_prevCores;
+    PerCoreCounters m_currCores;
+    std::vector<float> m_coreUsage;
+    std::vector<uint32_t> m_rank;
+
     // Helper methods
-    bool parseCpuLine(const std::string& line);
-    bool parseMemLine(const std::string& line, unsigned long long& memTotal, 
-                      unsigned long long& memAvailable);
+    static bool ensureOpen(FileTelemetrySourceImpl& source);
 
 public:
     TelemetryParser();
+    // Other files with the same format (tests, containers with a bind-mounted /proc)
+    TelemetryParser(std::string statPath, std::string memInfoPath);
+
+    // Scanners over raw procfs text (see ProcScan.hpp): no allocation,
+    // no locale, no exceptions. Public for tests and benchmarks.
+    // "cpu  user nice system idle iowait irq softirq steal ..."
+    static bool parseCpuLine(std::string_view line, CpuStats& stats) noexcept;
+    // MemTotal and MemAvailable (kB) from /proc/meminfo content
+    static bool parseMemInfo(std::string_view content, uint64_t& memTotal, uint64_t& memAvailable) noexcept;
+    // Every field of `wanted` in one pass over /proc/meminfo content,
+    // stopping once all are found. Keys are dispatched through the
+    // compile-time perfect hash in MemInfo.hpp; unknown keys are skipped.
+    // Costs about 30 ns per line read, so all fields (~55 lines) cost
+    // 30-60x parseMemInfo(), which stops after the third line.
+    // True if every wanted field was present.
+    static bool parseMemInfoFields(std::string_view content, MemFieldMask wanted, MemInfo& info) noexcept;
+    // Every "cpuN" line of /proc/stat content in one pass; the arrays are
+    // resized, not reallocated, once they have grown to the core count
+    static std::size_t parsePerCore(std::string_view content, PerCoreCounters& counters);
+    // usage[i] = busy share of core i between the two samples, in percent.
+    // Branch-free over the arrays so the compiler can vectorize it.
+    static void computeUsage(const uint64_t* prevTotal, const uint64_t* prevIdle,
+                             const uint64_t* currTotal, const uint64_t* currIdle,
+                             float* usage, std::size_t count) noexcept;
 
     // Rule of 0: No special member functions!
 
-    // Open sources
+    // Open sources (optional: the getters open lazily and then keep
+    // both fds open for the parser's lifetime)
     bool open();
 
     // Get usage percentages
     double getCpuUsage();
     double getMemUsage();
 
+    // One read of /proc/meminfo into `info` (fields missing on this
+    // kernel are left out of info.found). False on read error.
+    bool getMemInfo(MemInfo& info, MemFieldMask wanted = AllMemFields);
+
+    // Per-core mode: one read of /proc/stat, usage of every online core
+    // since the previous call (all 0 on the first call or after hotplug).
+    // False on read/parse error, which leaves no cores. Results stay
+    // valid until the next call.
+    bool samplePerCore();
+    const std::vector<uint32_t>& getCores() const;
+    const std::vector<float>& getCoreUsage() const;
+    // The k busiest cores of the last sample, busiest first (k = 0: all)
+    void getTopCores(std::size_t k, std::vector<CoreUsage>& out);
+
     // Get formatted strings
     std::string getCpuString();
     std::string getMemString();
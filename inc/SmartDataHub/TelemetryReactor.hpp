@@ -0,0 +1,138 @@
+#pragma once
+
+#include "BatchReader.hpp"
+#include "ITelemetrySource.hpp"
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace SmartDataHub
+{
+
+    // Drives many telemetry sources from a small, fixed set of threads.
+    //
+    // Each thread owns one epoll instance (a shard). Sources with a poll fd
+    // (sockets, watched files) are read when that fd turns readable; all
+    // other sources are read on a periodic timerfd. Sources that share a
+    // shard and an interval share one timerfd, so hundreds of /proc
+    // samplers cost a handful of fds and wakeups. Everything due in one
+    // epoll round is read through the shard's BatchReader, i.e. with a
+    // single io_uring submission when batched reads are enabled.
+    class TelemetryReactor
+    {
+    public:
+        // Runs on a reactor thread for every sample a source produced
+        using SampleHandler = std::function<void(const std::string &sourceName, const std::string &data)>;
+        // Runs first on each reactor thread (naming, pinning, ...)
+        using ThreadStartHook = std::function<void(std::size_t threadIndex)>;
+
+    private:
+        struct Registration;
+        struct TimerGroup;
+
+        // What an epoll event points at
+        struct PollTarget
+        {
+            enum class Kind
+            {
+                Wakeup,
+                Source,
+                Timer
+            };
+            Kind kind = Kind::Wakeup;
+            Registration *registration = nullptr;
+            TimerGroup *timer = nullptr;
+        };
+
+        struct Registration
+        {
+            std::string name;
+            std::unique_ptr<ITelemetrySource> source;
+            SampleHandler handler;
+            PollTarget target;
+            bool pollable = false;
+        };
+
+        struct TimerGroup
+        {
+            int timerFd = -1;
+            std::vector<Registration *> members;
+            PollTarget target;
+        };
+
+        struct Shard
+        {
+            int epollFd = -1;
+            int wakeFd = -1; // eventfd, written by stop() and post()
+            PollTarget wakeTarget;
+            std::vector<std::unique_ptr<Registration>> registrations;
+            std::map<int, std::unique_ptr<TimerGroup>> timers; // by interval (ms)
+            std::thread thread;
+
+            // Per-round scratch, reused to keep the loop allocation-free
+            std::unique_ptr<BatchReader> reader;
+            std::vector<std::pair<Registration *, uint32_t>> readyEvents;
+            std::vector<Registration *> due;
+            std::vector<ITelemetrySource *> dueSources;
+
+            // Tasks from post(), run between epoll rounds
+            std::mutex postedMutex;
+            std::vector<std::function<void()>> posted;
+            std::vector<std::function<void()>> runningPosted;
+        };
+
+        std::vector<std::unique_ptr<Shard>> m_shards;
+        ThreadStartHook m_threadStartHook;
+        std::atomic<bool> m_running{false};
+        std::atomic<bool> m_stopped{false}; // post() refuses from here on
+        std::size_t m_sourceCount = 0;
+        bool m_batchedReads = false;
+
+        Shard &pickShard();
+        TimerGroup *timerFor(Shard &shard, int intervalMs);
+        void runShard(std::size_t index);
+        void readOnce(Registration &registration);
+        void readDue(Shard &shard); // one sample from every source in shard.due
+        void onSourcesReady(Shard &shard);
+        void collectTimer(Shard &shard, TimerGroup &timer);
+        void runPosted(Shard &shard);
+
+    public:
+        explicit TelemetryReactor(std::size_t threadCount = 1);
+        ~TelemetryReactor();
+
+        TelemetryReactor(const TelemetryReactor &) = delete;
+        TelemetryReactor &operator=(const TelemetryReactor &) = delete;
+
+        // Takes an already opened source. Must be called before start().
+        // intervalMs is only used when the source has no poll fd.
+        bool addSource(const std::string &name, std::unique_ptr<ITelemetrySource> source,
+                       int intervalMs, SampleHandler handler);
+
+        void setThreadStartHook(ThreadStartHook hook);
+
+        // Runs `task` on reactor thread `threadIndex % getThreadCount()`
+        // after its current epoll round (e.g. a TimerWheel callback next
+        // to the sources of that thread). Tasks posted before start() run
+        // once it starts; false after stop().
+        bool post(std::size_t threadIndex, std::function<void()> task);
+
+        // Reads due sources through io_uring (falls back to readSource()
+        // when the kernel has none). Must be called before start().
+        void setBatchedReads(bool enable);
+
+        bool start();
+        void stop(); // joins all reactor threads
+
+        bool isRunning() const;
+        std::size_t getSourceCount() const;
+        std::size_t getThreadCount() const;
+    };
+
+} // namespace SmartDataHub
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace SmartDataHub
+{
+    // Sampling jitter of one timer: how late each callback started
+    // compared to its deadline.
+    struct TimerStats
+    {
+        uint64_t fires = 0;
+        uint64_t missed = 0;   // periods skipped because the wheel fell behind
+        uint64_t overruns = 0; // deadlines skipped because the callback still ran
+        double meanLatenessUs = 0.0;
+        uint64_t maxLatenessUs = 0;
+        uint64_t p99LatenessUs = 0; // upper bound, from a log2 histogram
+    };
+
+    // Periodic timers for thousands of samplers on one thread.
+    //
+    // Timers sit in a hierarchical wheel (5 levels of 64 slots, 1 ms ticks
+    // by default): scheduling, cancelling and every tick are O(1), and a
+    // timer far in the future is cascaded to a finer level only once per
+    // level. The wheel thread sleeps on a timerfd armed at the absolute
+    // time of the next occupied slot (or the next cascade), found from a
+    // per-level occupancy bitmap, so an idle wheel does not wake per tick.
+    //
+    // Deadlines advance by exactly one period from the previous deadline,
+    // not from when the callback ran, so rates do not drift; if the wheel
+    // falls behind by whole periods they are skipped (counted as missed)
+    // and the phase is kept. A callback still running at its next
+    // deadline is not started twice (counted as an overrun).
+    //
+    // Callbacks run on the wheel thread unless the timer has an Executor
+    // (a ThreadPool, a TelemetryReactor thread, ...).
+    class TimerWheel
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using TimerId = uint64_t;
+        using Callback = std::function<void()>;
+        // Hands a callback to another thread; runs it inline if empty
+        using Executor = std::function<void(std::function<void()>)>;
+        // Runs first on the wheel thread (naming, pinning, ...)
+        using ThreadStartHook = std::function<void()>;
+
+        static constexpr unsigned LevelBits = 6;
+        static constexpr std::size_t SlotsPerLevel = std::size_t{1} << LevelBits;
+        static constexpr std::size_t Levels = 5;
+        static constexpr std::size_t HistogramBuckets = 24; // log2 microseconds
+
+    private:
+        struct Timer
+        {
+            TimerId id = 0;
+            Clock::duration period{};
+            Clock::time_point deadline;
+            uint64_t expiryTick = 0;
+            Callback callback;
+            Executor executor;
+
+            // Wheel position (guarded by m_mutex)
+            Timer *prev = nullptr;
+            Timer *next = nullptr;
+            uint8_t level = 0;
+            uint8_t slot = 0;
+            bool linked = false;
+
+            std::atomic<bool> running{false};
+            std::atomic<uint64_t> fires{0};
+            std::atomic<uint64_t> missed{0};
+            std::atomic<uint64_t> overruns{0};
+            std::atomic<uint64_t> latenessSumUs{0};
+            std::atomic<uint64_t> latenessMaxUs{0};
+            std::array<std::atomic<uint64_t>, HistogramBuckets> histogram{};
+        };
+
+        struct Fired
+        {
+            std::shared_ptr<Timer> timer;
+            Clock::time_point deadline;
+        };
+
+        Clock::duration m_tick;
+        Clock::time_point m_start;
+        uint64_t m_now = 0; // last processed tick
+
+        std::mutex m_mutex;
+        std::unordered_map<TimerId, std::shared_ptr<Timer>> m_timers;
+        std::array<std::array<Timer *, SlotsPerLevel>, Levels> m_slots{};
+        std::array<uint64_t, Levels> m_occupied{}; // bit per non-empty slot
+        TimerId m_nextId = 1;
+        uint64_t m_armedTick = 0; // 0: disarmed
+
+        int m_timerFd = -1;
+        int m_wakeFd = -1; // eventfd: stop() or an earlier deadline
+        std::thread m_thread;
+        std::atomic<bool> m_running{false};
+        ThreadStartHook m_threadStartHook;
+
+        std::vector<Fired> m_fired; // per-wakeup scratch (wheel thread)
+        std::vector<Timer *> m_cascade;
+
+        uint64_t tickFor(Clock::time_point deadline) const;
+        void link(Timer &timer);
+        void unlink(Timer &timer);
+        void advance(uint64_t target);
+        void cascade(std::size_t level, std::size_t slot);
+        void expire(Timer &timer, Clock::time_point now);
+        uint64_t nextWakeTick() const;
+        void arm(uint64_t tick);
+        void wake();
+        void run();
+        static void dispatch(const Fired &fired);
+
+    public:
+        explicit TimerWheel(Clock::duration tick = std::chrono::milliseconds(1));
+        ~TimerWheel();
+
+        TimerWheel(const TimerWheel &) = delete;
+        TimerWheel &operator=(const TimerWheel &) = delete;
+
+        // First call at now + firstDelay, then every `period`. Thread-safe,
+        // before or after start(). Returns 0 if period is not positive.
+        TimerId schedule(Clock::duration period, Callback callback, Executor executor = {},
+                         Clock::duration firstDelay = Clock::duration::zero());
+        // A callback already handed out still finishes
+        bool cancel(TimerId id);
+
+        void setThreadStartHook(ThreadStartHook hook);
+
+        bool start();
+        void stop(); // joins the wheel thread
+
+        bool isRunning() const;
+        std::size_t getTimerCount();
+        TimerStats getStats(TimerId id);
+    };
+
+} // namespace SmartDataHub
@@ -9,6 +9,7 @@ namespace logging
     public:
         ConsoleSinkImpl() = default;
        void write(const LogMessage & msg) override ;
+       void flush() override;
         ~ConsoleSinkImpl() override = default;
     };
 
@@ -16,6 +16,7 @@ namespace logging
     public:
         FileSinkImpl(const std::string &filepath);
         void write(const LogMessage &msg) override;
+        void flush() override;
         ~FileSinkImpl() override = default;
     };
 
@@ -10,6 +10,8 @@ namespace logging
     public:
         ILogSink() = default;
         virtual void write(const LogMessage &msg) = 0;
+        // Push any buffered output to its destination (no-op by default)
+        virtual void flush() {}
         virtual ~ILogSink() = default;
     };
 
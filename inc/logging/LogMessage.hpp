@@ -21,7 +21,9 @@ namespace logging
     {
         CPU,
         GPU,
-        RAM
+        RAM,
+        DISK,
+        NET
     };
 
     using TimeStamp = std::chrono::system_clock::time_point;
@@ -38,18 +40,7 @@ namespace logging
 
         void AssignSeverity()
         {
-            if (payload <= 25)
-            {
-                severity = Severity::INFO;
-            }
-            else if (payload > 25 && payload < 75)
-            {
-                severity = Severity::WARN;
-            }
-            else if (payload >= 75)
-            {
-                severity = Severity::CRITICAL;
-            }
+            severity = severityForPayload(payload);
         }
 
         std::string contextToString(Context ctx) const
@@ -62,6 +53,10 @@ namespace logging
                 return "GPU";
             case Context::RAM:
                 return "RAM";
+            case Context::DISK:
+                return "DISK";
+            case Context::NET:
+                return "NET";
             default:
                 return "UNKNOWN";
             }
@@ -97,6 +92,21 @@ namespace logging
         }
 
     public:
+        // Severity the payload-only constructor will assign, so front ends
+        // can filter before paying for message construction
+        static Severity severityForPayload(uint8_t value)
+        {
+            if (value <= 25)
+            {
+                return Severity::INFO;
+            }
+            else if (value < 75)
+            {
+                return Severity::WARN;
+            }
+            return Severity::CRITICAL;
+        }
+
         //  Constructor with pre-computed severity (for LogFormatter)
         LogMessage(std::string application_name, Context cxt, Severity sev, uint8_t Payload)
             : app_name{application_name}, context{cxt}, severity{sev}, payload{Payload}
@@ -121,6 +131,19 @@ namespace logging
 
             text = "[" + TimeStampformated + "]" + " [" + contextformated + "]" + " [" + app_name + "]" + " [" + severityformated + "]" + " Payload value is: " + std::to_string(payload) + "%";
         }
+        // Measured quantity that is not a percentage ("1520.5 kB/s", "3 tasks"):
+        // the value goes into the text with its unit, payload stays 0
+        LogMessage(std::string application_name, Context cxt, Severity sev, double value, const std::string &unit)
+            : app_name{application_name}, context{cxt}, severity{sev}, payload{0}
+        {
+            time = std::chrono::system_clock::now();
+            std::ostringstream valueformated;
+            valueformated << std::fixed << std::setprecision(1) << value;
+
+            text = "[" + timeToString(time) + "]" + " [" + contextToString(context) + "]" +
+                   " [" + app_name + "]" + " [" + severityToString(severity) + "]" +
+                   " Value is: " + valueformated.str() + " " + unit;
+        }
         // DEFAULT ALL SPECIAL MEMBER FUNCTIONS (Rule of 0 approach)
         ~LogMessage() = default;                             // Destructor
         LogMessage(const LogMessage &) = default;            // Copy constructor
@@ -1,29 +1,49 @@
 #include "inc/AsyncLogging/AsyncLogManager.hpp"
+#include <algorithm>
 #include <iostream>
 
 namespace async_logging
 {
 
+// One lane per logging::Severity, most urgent first
+constexpr std::size_t LaneCount = 3;
+
 AsyncLogManager::AsyncLogManager(const std::string& name,
                                  std::vector<std::shared_ptr<logging::ILogSink>> sinks,
                                  std::size_t bufferCapacity,
                                  bool useThreadPool,
-                                 std::size_t poolSize)
+                                 std::size_t poolSize,
+                                 ThreadConfig workerConfig,
+                                 ThreadConfig poolConfig,
+                                 LaneConfig laneConfig)
     : m_name{name}
-    , m_sinks{std::move(sinks)}
-    , m_buffer{bufferCapacity}
+    , m_sinks{new SinkList(std::move(sinks))}
+    , m_sinkEpoch{0}
+    , m_quiescentEpoch{0}
+    , m_workerActive{false}
+    , m_buffer{LaneCount,
+               bufferCapacity,
+               std::max<std::size_t>(bufferCapacity * laneConfig.criticalReservePercent / 100,
+                                     laneConfig.criticalReservePercent > 0 ? 1 : 0),
+               laneConfig.starvationLimit}
     , m_running{false}
+    , m_inFlight{0}
+    , m_hasThrottles{false}
     , m_useThreadPool{useThreadPool}
+    , m_workerConfig{std::move(workerConfig)}
 {
     if (m_useThreadPool)
     {
-        m_threadPool.emplace(poolSize);
+        m_threadPool.emplace(poolSize, std::move(poolConfig));
     }
 }
 
 AsyncLogManager::~AsyncLogManager()
 {
     stop();
+
+    reclaimRetiredSinks();
+    delete m_sinks.load();
 }
 
 void AsyncLogManager::start()
@@ -35,6 +55,11 @@ void AsyncLogManager::start()
 
     m_running.store(true);
 
+    {
+        std::lock_guard<std::mutex> lock(m_sinkWriteMutex);
+        m_workerActive = true;
+    }
+
     if (m_useThreadPool)
     {
         m_workerThread = std::thread(&AsyncLogManager::workerFunctionWithPool, this);
@@ -59,19 +84,41 @@ void AsyncLogManager::stop()
     {
         m_workerThread.join();
     }
+
+    {
+        std::lock_guard<std::mutex> lock(m_sinkWriteMutex);
+        m_workerActive = false;
+    }
+    reclaimRetiredSinks();
 }
 
 void AsyncLogManager::workerFunction()
 {
+    applyThreadConfig(m_workerConfig);
+
     while (m_running.load() || !m_buffer.isEmpty())
     {
-        auto optMsg = m_buffer.pop();
+        markQuiescent();
+        auto optEntry = m_buffer.pop();
 
-        if (optMsg.has_value())
+        if (!optEntry.has_value())
         {
-            for (const auto& sink : m_sinks)
+            continue;
+        }
+
+        if (auto* msg = std::get_if<logging::LogMessage>(&optEntry.value()))
+        {
+            for (const auto& sink : *m_sinks.load())
             {
-                sink->write(optMsg.value());
+                sink->write(*msg);
+            }
+        }
+        else
+        {
+            auto& request = *std::get<std::shared_ptr<FlushRequest>>(optEntry.value());
+            if (reachedFlushMarker(request))
+            {
+                completeFlush(request);
             }
         }
     }
@@ -79,24 +126,99 @@ void AsyncLogManager::workerFunction()
 
 void AsyncLogManager::workerFunctionWithPool()
 {
+    applyThreadConfig(m_workerConfig);
+
     while (m_running.load() || !m_buffer.isEmpty())
     {
-        auto optMsg = m_buffer.pop();
+        markQuiescent();
+        auto optEntry = m_buffer.pop();
 
-        if (optMsg.has_value())
+        if (!optEntry.has_value())
         {
-            // Copy the message for each sink task
-            logging::LogMessage msg = optMsg.value();
+            continue;
+        }
 
-            for (const auto& sink : m_sinks)
+        if (auto* msg = std::get_if<logging::LogMessage>(&optEntry.value()))
+        {
+            dispatchToPool(*msg);
+        }
+        else
+        {
+            auto& request = *std::get<std::shared_ptr<FlushRequest>>(optEntry.value());
+            if (reachedFlushMarker(request))
             {
-                // Capture sink and message by value (shared_ptr is cheap to copy)
-                m_threadPool->enqueueTask([sink, msg]() {
-                    sink->write(msg);
-                });
+                // This thread is the only producer for the pool, so once it is
+                // idle every message ahead of the marker has been written.
+                waitForPoolIdle();
+                completeFlush(request);
             }
         }
     }
+
+    // Make stop() a delivery guarantee in pool mode as well
+    waitForPoolIdle();
+}
+
+void AsyncLogManager::markQuiescent()
+{
+    m_quiescentEpoch.store(m_sinkEpoch.load());
+}
+
+void AsyncLogManager::dispatchToPool(const logging::LogMessage& msg)
+{
+    const SinkList& sinks = *m_sinks.load();
+
+    {
+        std::lock_guard<std::mutex> lock(m_inFlightMutex);
+        m_inFlight += sinks.size();
+    }
+
+    for (const auto& sink : sinks)
+    {
+        // Capture sink and message by value (shared_ptr is cheap to copy)
+        m_threadPool->enqueueTask([this, sink, msg]() {
+            sink->write(msg);
+
+            std::lock_guard<std::mutex> lock(m_inFlightMutex);
+            if (--m_inFlight == 0)
+            {
+                m_inFlightDone.notify_all();
+            }
+        });
+    }
+}
+
+void AsyncLogManager::waitForPoolIdle()
+{
+    std::unique_lock<std::mutex> lock(m_inFlightMutex);
+    m_inFlightDone.wait(lock, [this] { return m_inFlight == 0; });
+}
+
+bool AsyncLogManager::reachedFlushMarker(FlushRequest& request)
+{
+    // Only the worker thread consumes markers, no synchronization needed
+    return --request.pendingLanes == 0;
+}
+
+void AsyncLogManager::completeFlush(FlushRequest& request)
+{
+    for (const auto& sink : *m_sinks.load())
+    {
+        sink->flush();
+    }
+
+    auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - request.requested);
+
+    {
+        std::lock_guard<std::mutex> lock(m_flushStatsMutex);
+        ++m_flushStats.count;
+        m_flushStats.last = latency;
+        m_flushStats.max = std::max(m_flushStats.max, latency);
+        m_flushStats.total += latency;
+    }
+
+    request.done.set_value();
 }
 
 bool AsyncLogManager::log(logging::LogMessage msg)
@@ -106,12 +228,197 @@ bool AsyncLogManager::log(logging::LogMessage msg)
         return false;
     }
 
-    return m_buffer.push(std::move(msg));
+    std::size_t lane = laneFor(msg.getSeverity());
+    return m_buffer.push(std::move(msg), lane);
+}
+
+std::size_t AsyncLogManager::logBatch(std::vector<logging::LogMessage>& messages)
+{
+    if (!m_running.load())
+    {
+        return 0;
+    }
+
+    return m_buffer.pushBatch(messages.begin(), messages.end(), [](const logging::LogMessage& msg) {
+        return laneFor(msg.getSeverity());
+    });
+}
+
+void AsyncLogManager::setThrottle(const std::string& appName, ThrottleConfig config)
+{
+    std::unique_lock<std::shared_mutex> lock(m_throttleMutex);
+    m_throttles[appName] = std::make_shared<LogThrottle>(config);
+    m_hasThrottles.store(true);
+}
+
+std::shared_ptr<LogThrottle> AsyncLogManager::getThrottle(const std::string& appName) const
+{
+    if (!m_hasThrottles.load())
+    {
+        return nullptr;
+    }
+
+    std::shared_lock<std::shared_mutex> lock(m_throttleMutex);
+    auto it = m_throttles.find(appName);
+    return it != m_throttles.end() ? it->second : nullptr;
+}
+
+bool AsyncLogManager::admit(const std::string& appName, logging::Severity severity)
+{
+    if (!m_hasThrottles.load())
+    {
+        return true;
+    }
+
+    std::shared_lock<std::shared_mutex> lock(m_throttleMutex);
+    auto it = m_throttles.find(appName);
+    return it == m_throttles.end() || it->second->admit(severity);
+}
+
+std::map<std::string, ThrottleCounters> AsyncLogManager::getThrottleCounters() const
+{
+    std::shared_lock<std::shared_mutex> lock(m_throttleMutex);
+
+    std::map<std::string, ThrottleCounters> counters;
+    for (const auto& [appName, throttle] : m_throttles)
+    {
+        counters[appName] = throttle->getCounters();
+    }
+    return counters;
+}
+
+std::size_t AsyncLogManager::laneFor(logging::Severity severity)
+{
+    switch (severity)
+    {
+    case logging::Severity::CRITICAL:
+        return 0;
+    case logging::Severity::WARN:
+        return 1;
+    default:
+        return 2;
+    }
+}
+
+std::optional<std::future<void>> AsyncLogManager::startFlush(const std::chrono::steady_clock::time_point* deadline)
+{
+    auto request = std::make_shared<FlushRequest>();
+    request->requested = std::chrono::steady_clock::now();
+    request->pendingLanes = m_buffer.laneCount();
+    std::future<void> result = request->done.get_future();
+
+    bool queued = m_running.load() &&
+                  (deadline ? m_buffer.pushToAllLanesFor(request, *deadline) : m_buffer.pushToAllLanes(request));
+    if (!queued)
+    {
+        // Saturated lanes: the marker never made it in
+        if (deadline && m_running.load() && !m_buffer.isStopped())
+        {
+            return std::nullopt;
+        }
+        // Nothing can be pending once the worker is gone
+        request->done.set_value();
+    }
+
+    return result;
+}
+
+std::future<void> AsyncLogManager::flushAsync()
+{
+    return std::move(*startFlush(nullptr));
+}
+
+void AsyncLogManager::flush()
+{
+    flushAsync().wait();
+}
+
+bool AsyncLogManager::flushFor(std::chrono::milliseconds timeout)
+{
+    // Queueing the marker can block on full lanes: it shares the timeout
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    auto done = startFlush(&deadline);
+    return done && done->wait_until(deadline) == std::future_status::ready;
+}
+
+FlushStats AsyncLogManager::getFlushStats() const
+{
+    std::lock_guard<std::mutex> lock(m_flushStatsMutex);
+    return m_flushStats;
 }
 
 void AsyncLogManager::addSink(std::shared_ptr<logging::ILogSink> sink)
 {
-    m_sinks.push_back(std::move(sink));
+    std::lock_guard<std::mutex> lock(m_sinkWriteMutex);
+
+    auto next = new SinkList(*m_sinks.load());
+    next->push_back(std::move(sink));
+    publishSinks(next);
+}
+
+bool AsyncLogManager::removeSink(const std::shared_ptr<logging::ILogSink>& sink)
+{
+    std::lock_guard<std::mutex> lock(m_sinkWriteMutex);
+
+    const SinkList& current = *m_sinks.load();
+    auto it = std::find(current.begin(), current.end(), sink);
+    if (it == current.end())
+    {
+        return false;
+    }
+
+    auto next = new SinkList(current.begin(), it);
+    next->insert(next->end(), it + 1, current.end());
+    publishSinks(next);
+    return true;
+}
+
+std::size_t AsyncLogManager::getSinkCount() const
+{
+    // Only the worker is covered by the epoch scheme, other readers lock
+    std::lock_guard<std::mutex> lock(m_sinkWriteMutex);
+    return m_sinks.load()->size();
+}
+
+// Caller holds m_sinkWriteMutex
+void AsyncLogManager::publishSinks(SinkList* next)
+{
+    const SinkList* previous = m_sinks.exchange(next);
+    std::uint64_t epoch = m_sinkEpoch.fetch_add(1) + 1;
+
+    if (!m_workerActive)
+    {
+        delete previous;
+        return;
+    }
+
+    m_retiredSinks.push_back({epoch, previous});
+
+    // Free whatever the worker has provably moved past
+    std::uint64_t quiescent = m_quiescentEpoch.load();
+    auto firstFreeable = std::partition(m_retiredSinks.begin(), m_retiredSinks.end(),
+                                        [quiescent](const RetiredSinks& r) { return r.epoch > quiescent; });
+    for (auto it = firstFreeable; it != m_retiredSinks.end(); ++it)
+    {
+        delete it->sinks;
+    }
+    m_retiredSinks.erase(firstFreeable, m_retiredSinks.end());
+}
+
+void AsyncLogManager::reclaimRetiredSinks()
+{
+    std::lock_guard<std::mutex> lock(m_sinkWriteMutex);
+
+    if (m_workerActive)
+    {
+        return;
+    }
+
+    for (const auto& retired : m_retiredSinks)
+    {
+        delete retired.sinks;
+    }
+    m_retiredSinks.clear();
 }
 
 bool AsyncLogManager::isRunning() const
@@ -0,0 +1,129 @@
+#include "inc/AsyncLogging/LogThrottle.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace async_logging
+{
+
+static std::int64_t nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// Per-thread xorshift64*, seeded from the thread's stack address
+static double nextUniform()
+{
+    thread_local std::uint64_t state =
+        reinterpret_cast<std::uintptr_t>(&state) * 0x9E3779B97F4A7C15ULL | 1ULL;
+
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    std::uint64_t value = state * 0x2545F4914F6CDD1DULL;
+
+    return static_cast<double>(value >> 11) * (1.0 / 9007199254740992.0);
+}
+
+LogThrottle::LogThrottle(ThrottleConfig config)
+    : m_config{config}
+    , m_intervalNs{0}
+    , m_toleranceNs{0}
+    , m_theoreticalArrivalNs{0}
+    , m_infoSeen{0}
+    , m_admitted{0}
+    , m_rateLimited{0}
+    , m_sampledOut{0}
+{
+    if (m_config.ratePerSec > 0.0)
+    {
+        double burst = m_config.burst > 0.0 ? m_config.burst : m_config.ratePerSec;
+        burst = std::max(burst, 1.0);
+
+        m_intervalNs = static_cast<std::int64_t>(1e9 / m_config.ratePerSec);
+        m_toleranceNs = static_cast<std::int64_t>((burst - 1.0) * static_cast<double>(m_intervalNs));
+    }
+    m_config.infoSampleEvery = std::max<std::uint32_t>(m_config.infoSampleEvery, 1);
+}
+
+bool LogThrottle::takeToken()
+{
+    if (m_intervalNs == 0)
+    {
+        return true;
+    }
+
+    std::int64_t now = nowNs();
+    std::int64_t tat = m_theoreticalArrivalNs.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        std::int64_t start = std::max(tat, now);
+        if (start - now > m_toleranceNs)
+        {
+            return false;
+        }
+        if (m_theoreticalArrivalNs.compare_exchange_weak(tat, start + m_intervalNs,
+                                                         std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+}
+
+bool LogThrottle::keepInfoSample()
+{
+    if (m_config.infoSampleEvery > 1 &&
+        m_infoSeen.fetch_add(1, std::memory_order_relaxed) % m_config.infoSampleEvery != 0)
+    {
+        return false;
+    }
+    if (m_config.infoSampleProbability < 1.0 && nextUniform() >= m_config.infoSampleProbability)
+    {
+        return false;
+    }
+    return true;
+}
+
+bool LogThrottle::admit(logging::Severity severity)
+{
+    if (severity == logging::Severity::CRITICAL && m_config.exemptCritical)
+    {
+        m_admitted.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Sample first so dropped INFO does not consume tokens
+    if (severity == logging::Severity::INFO && !keepInfoSample())
+    {
+        m_sampledOut.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    if (!takeToken())
+    {
+        m_rateLimited.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    m_admitted.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+ThrottleCounters LogThrottle::getCounters() const
+{
+    ThrottleCounters counters;
+    counters.admitted = m_admitted.load(std::memory_order_relaxed);
+    counters.rateLimited = m_rateLimited.load(std::memory_order_relaxed);
+    counters.sampledOut = m_sampledOut.load(std::memory_order_relaxed);
+    return counters;
+}
+
+const ThrottleConfig& LogThrottle::getConfig() const
+{
+    return m_config;
+}
+
+} // namespace async_logging
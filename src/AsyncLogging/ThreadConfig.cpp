@@ -0,0 +1,121 @@
+#include "inc/AsyncLogging/ThreadConfig.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+namespace async_logging
+{
+
+// Linux limits thread names to 16 bytes including the terminator
+constexpr std::size_t MaxThreadNameLength = 15;
+
+static bool applyName(const std::string& name)
+{
+    std::string shortName = name.substr(0, MaxThreadNameLength);
+    int rc = pthread_setname_np(pthread_self(), shortName.c_str());
+    if (rc != 0)
+    {
+        std::cerr << "[ThreadConfig] Cannot name thread '" << shortName << "': "
+                  << std::strerror(rc) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static bool applyAffinity(const std::vector<int>& cpus, const std::string& name)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+
+    bool anyValid = false;
+    for (int cpu : cpus)
+    {
+        if (cpu >= 0 && cpu < CPU_SETSIZE)
+        {
+            CPU_SET(cpu, &set);
+            anyValid = true;
+        }
+    }
+
+    if (!anyValid)
+    {
+        std::cerr << "[ThreadConfig] No valid CPU in affinity list for '" << name << "'" << std::endl;
+        return false;
+    }
+
+    int rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (rc != 0)
+    {
+        std::cerr << "[ThreadConfig] Cannot pin '" << name << "': " << std::strerror(rc) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static bool applyBatchScheduling(const std::string& name)
+{
+    sched_param param{};
+    param.sched_priority = 0;
+
+    int rc = pthread_setschedparam(pthread_self(), SCHED_BATCH, &param);
+    if (rc != 0)
+    {
+        std::cerr << "[ThreadConfig] Cannot set SCHED_BATCH for '" << name << "': "
+                  << std::strerror(rc) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static bool applyNice(int niceLevel, const std::string& name)
+{
+    // On Linux, PRIO_PROCESS with a thread id only affects that thread
+    pid_t tid = static_cast<pid_t>(syscall(SYS_gettid));
+    if (setpriority(PRIO_PROCESS, static_cast<id_t>(tid), niceLevel) != 0)
+    {
+        std::cerr << "[ThreadConfig] Cannot set nice " << niceLevel << " for '" << name << "': "
+                  << std::strerror(errno) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool applyThreadConfig(const ThreadConfig& config, const std::string& suffix)
+{
+    if (config.isDefault())
+    {
+        return true;
+    }
+
+    bool ok = true;
+    std::string fullName = config.name.empty() ? std::string{} : config.name + suffix;
+
+    if (!fullName.empty())
+    {
+        ok = applyName(fullName) && ok;
+    }
+    if (!config.cpus.empty())
+    {
+        ok = applyAffinity(config.cpus, fullName) && ok;
+    }
+    // Switch policy first: changing to SCHED_BATCH keeps the nice value
+    if (config.batchScheduling)
+    {
+        ok = applyBatchScheduling(fullName) && ok;
+    }
+    if (config.niceLevel.has_value())
+    {
+        ok = applyNice(config.niceLevel.value(), fullName) && ok;
+    }
+
+    return ok;
+}
+
+} // namespace async_logging
@@ -4,12 +4,13 @@
 namespace async_logging
 {
 
-ThreadPool::ThreadPool(std::size_t numThreads)
+ThreadPool::ThreadPool(std::size_t numThreads, ThreadConfig config)
     : m_stop{false}
+    , m_config{std::move(config)}
 {
     for (std::size_t i = 0; i < numThreads; ++i)
     {
-        m_workers.emplace_back(&ThreadPool::workerLoop, this);
+        m_workers.emplace_back(&ThreadPool::workerLoop, this, i);
     }
 
     std::cout << "[ThreadPool] Created with " << numThreads << " threads" << std::endl;
@@ -35,8 +36,10 @@ ThreadPool::~ThreadPool()
     std::cout << "[ThreadPool] Destroyed, all threads joined" << std::endl;
 }
 
-void ThreadPool::workerLoop()
+void ThreadPool::workerLoop(std::size_t index)
 {
+    applyThreadConfig(m_config, "-" + std::to_string(index));
+
     while (true)
     {
         std::function<void()> task;
@@ -15,10 +15,80 @@ namespace facade
     SourceType stringToSourceType(const std::string& str)
     {
         if (str == "FILE") return SourceType::FILE;
+        if (str == "SOCKET") return SourceType::SOCKET;
+        if (str == "SHM") return SourceType::SHM;
+        if (str == "PERCORE") return SourceType::PERCORE;
+        if (str == "MEMINFO") return SourceType::MEMINFO;
+        if (str == "DISKSTATS") return SourceType::DISKSTATS;
+        if (str == "NETDEV") return SourceType::NETDEV;
+        if (str == "LOADAVG") return SourceType::LOADAVG;
+        if (str == "PSI") return SourceType::PSI;
+        if (str == "CGROUP") return SourceType::CGROUP;
+        if (str == "PROCESSES") return SourceType::PROCESSES;
+        if (str == "REPLAY") return SourceType::REPLAY;
         if (str == "VSOMEIP") return SourceType::VSOMEIP;
         throw std::runtime_error("Unknown source type: " + str);
     }
 
+    /**
+     * Helper function to convert SourceType to string
+     */
+    const char* sourceTypeToString(SourceType type)
+    {
+        switch (type) {
+            case SourceType::FILE: return "FILE";
+            case SourceType::SOCKET: return "SOCKET";
+            case SourceType::SHM: return "SHM";
+            case SourceType::PERCORE: return "PERCORE";
+            case SourceType::MEMINFO: return "MEMINFO";
+            case SourceType::DISKSTATS: return "DISKSTATS";
+            case SourceType::NETDEV: return "NETDEV";
+            case SourceType::LOADAVG: return "LOADAVG";
+            case SourceType::PSI: return "PSI";
+            case SourceType::CGROUP: return "CGROUP";
+            case SourceType::PROCESSES: return "PROCESSES";
+            case SourceType::REPLAY: return "REPLAY";
+            case SourceType::VSOMEIP: return "VSOMEIP";
+        }
+        return "UNKNOWN";
+    }
+
+    /**
+     * Helper function to convert a /proc/meminfo key to MemField
+     */
+    SmartDataHub::MemField stringToMemField(const std::string& str)
+    {
+        SmartDataHub::MemField field = SmartDataHub::MemField::Count;
+        if (!SmartDataHub::lookupMemField(str, field)) {
+            throw std::runtime_error("Unknown meminfo field: " + str);
+        }
+        return field;
+    }
+
+    /**
+     * Helper function to convert string to SocketKind
+     */
+    SmartDataHub::SocketKind stringToSocketKind(const std::string& str)
+    {
+        if (str == "STREAM") return SmartDataHub::SocketKind::Stream;
+        if (str == "SEQPACKET") return SmartDataHub::SocketKind::SeqPacket;
+        if (str == "DGRAM") return SmartDataHub::SocketKind::Datagram;
+        throw std::runtime_error("Unknown socket type: " + str);
+    }
+
+    /**
+     * Helper function to convert SocketKind to string
+     */
+    const char* socketKindToString(SmartDataHub::SocketKind kind)
+    {
+        switch (kind) {
+            case SmartDataHub::SocketKind::Stream: return "STREAM";
+            case SmartDataHub::SocketKind::SeqPacket: return "SEQPACKET";
+            case SmartDataHub::SocketKind::Datagram: return "DGRAM";
+        }
+        return "UNKNOWN";
+    }
+
     /**
      * Helper function to convert string to SinkType
      */
@@ -29,6 +99,54 @@ namespace facade
         throw std::runtime_error("Unknown sink type: " + str);
     }
 
+    /**
+     * Helper function to convert string to FramingMode (ingest and SOCKET streams)
+     */
+    SmartDataHub::FramingMode stringToFramingMode(const std::string& str)
+    {
+        if (str == "NEWLINE") return SmartDataHub::FramingMode::Newline;
+        if (str == "LENGTH_PREFIXED") return SmartDataHub::FramingMode::LengthPrefixed;
+        throw std::runtime_error("Unknown framing: " + str);
+    }
+
+    /**
+     * Helper function to parse one thread role ("logger", "pool", "sources")
+     */
+    void parseThreadConfig(const json& j, async_logging::ThreadConfig& config)
+    {
+        if (j.contains("name")) {
+            config.name = j["name"].get<std::string>();
+        }
+        if (j.contains("cpus") && j["cpus"].is_array()) {
+            config.cpus = j["cpus"].get<std::vector<int>>();
+        }
+        if (j.contains("nice")) {
+            config.niceLevel = j["nice"].get<int>();
+        }
+        if (j.contains("batch")) {
+            config.batchScheduling = j["batch"].get<bool>();
+        }
+    }
+
+    /**
+     * Helper function to print one thread role
+     */
+    void printThreadConfig(const std::string& role, const async_logging::ThreadConfig& config)
+    {
+        std::cout << "  " << role << ": name=" << config.name << " cpus=[";
+        for (size_t i = 0; i < config.cpus.size(); ++i) {
+            std::cout << (i ? "," : "") << config.cpus[i];
+        }
+        std::cout << "]";
+        if (config.niceLevel) {
+            std::cout << " nice=" << *config.niceLevel;
+        }
+        if (config.batchScheduling) {
+            std::cout << " SCHED_BATCH";
+        }
+        std::cout << std::endl;
+    }
+
     AppConfig AppConfig::fromJson(const std::string& filePath)
     {
         // Open and parse JSON file
@@ -56,6 +174,15 @@ namespace facade
         if (j.contains("threadPoolSize")) {
             config.threadPoolSize = j["threadPoolSize"].get<size_t>();
         }
+        if (j.contains("reactorThreads")) {
+            config.reactorThreads = j["reactorThreads"].get<size_t>();
+        }
+        if (j.contains("samplerThreads")) {
+            config.samplerThreads = j["samplerThreads"].get<size_t>();
+        }
+        if (j.contains("ioUring")) {
+            config.ioUring = j["ioUring"].get<bool>();
+        }
         if (j.contains("logFilePath")) {
             config.logFilePath = j["logFilePath"].get<std::string>();
         }
@@ -77,6 +204,72 @@ namespace facade
                 if (sourceJson.contains("parseRateMs")) {
                     srcConfig.parseRateMs = sourceJson["parseRateMs"].get<int>();
                 }
+                if (sourceJson.contains("eventDriven")) {
+                    srcConfig.eventDriven = sourceJson["eventDriven"].get<bool>();
+                }
+                if (sourceJson.contains("socketType")) {
+                    srcConfig.socketKind = stringToSocketKind(sourceJson["socketType"].get<std::string>());
+                }
+                if (sourceJson.contains("framing")) {
+                    srcConfig.framing = stringToFramingMode(sourceJson["framing"].get<std::string>());
+                }
+                if (sourceJson.contains("batchSize")) {
+                    srcConfig.batchSize = sourceJson["batchSize"].get<size_t>();
+                }
+                if (sourceJson.contains("ringCapacity")) {
+                    srcConfig.ringCapacity = sourceJson["ringCapacity"].get<size_t>();
+                }
+                if (sourceJson.contains("topK")) {
+                    srcConfig.topK = sourceJson["topK"].get<size_t>();
+                }
+                if (sourceJson.contains("scanThreads")) {
+                    srcConfig.scanThreads = sourceJson["scanThreads"].get<size_t>();
+                }
+                if (sourceJson.contains("maxOpenFds")) {
+                    srcConfig.maxOpenFds = sourceJson["maxOpenFds"].get<size_t>();
+                }
+                if (sourceJson.contains("fields") && sourceJson["fields"].is_array()) {
+                    srcConfig.memFields = 0;
+                    for (const auto& field : sourceJson["fields"]) {
+                        srcConfig.memFields |= SmartDataHub::memFieldBit(stringToMemField(field.get<std::string>()));
+                    }
+                }
+                if (sourceJson.contains("devices") && sourceJson["devices"].is_array()) {
+                    srcConfig.devices = sourceJson["devices"].get<std::vector<std::string>>();
+                }
+                if (sourceJson.contains("resource")) {
+                    srcConfig.resource = sourceJson["resource"].get<std::string>();
+                    if (srcConfig.resource != "cpu" && srcConfig.resource != "memory" && srcConfig.resource != "io") {
+                        throw std::runtime_error("Unknown pressure resource: " + srcConfig.resource);
+                    }
+                }
+                if (sourceJson.contains("speed")) {
+                    srcConfig.speed = sourceJson["speed"].get<double>();
+                    if (srcConfig.speed < 0.0) {
+                        throw std::runtime_error("Replay speed must not be negative: " + sourceName);
+                    }
+                }
+                if (sourceJson.contains("loop")) {
+                    srcConfig.loop = sourceJson["loop"].get<bool>();
+                }
+                if (sourceJson.contains("streams")) {
+                    srcConfig.streams = sourceJson["streams"].get<size_t>();
+                }
+                if (srcConfig.type == SourceType::PSI && srcConfig.path.empty()) {
+                    srcConfig.path = "/proc/pressure/" + srcConfig.resource;
+                }
+                if (sourceJson.contains("rateLimitPerSec")) {
+                    srcConfig.throttle.ratePerSec = sourceJson["rateLimitPerSec"].get<double>();
+                }
+                if (sourceJson.contains("rateBurst")) {
+                    srcConfig.throttle.burst = sourceJson["rateBurst"].get<double>();
+                }
+                if (sourceJson.contains("infoSampleEvery")) {
+                    srcConfig.throttle.infoSampleEvery = sourceJson["infoSampleEvery"].get<uint32_t>();
+                }
+                if (sourceJson.contains("infoSampleProbability")) {
+                    srcConfig.throttle.infoSampleProbability = sourceJson["infoSampleProbability"].get<double>();
+                }
                 if (sourceJson.contains("sinks") && sourceJson["sinks"].is_array()) {
                     for (const auto& sink : sourceJson["sinks"]) {
                         srcConfig.sinks.push_back(stringToSinkType(sink.get<std::string>()));
@@ -87,6 +280,45 @@ namespace facade
             }
         }
 
+        // Parse ingest endpoint
+        if (j.contains("ingest") && j["ingest"].is_object()) {
+            const auto& ingestJson = j["ingest"];
+            if (ingestJson.contains("enabled")) {
+                config.ingest.enabled = ingestJson["enabled"].get<bool>();
+            }
+            if (ingestJson.contains("path")) {
+                config.ingest.path = ingestJson["path"].get<std::string>();
+            }
+            if (ingestJson.contains("framing")) {
+                config.ingest.framing = stringToFramingMode(ingestJson["framing"].get<std::string>());
+            }
+            if (ingestJson.contains("maxConnections")) {
+                config.ingest.limits.maxConnections = ingestJson["maxConnections"].get<size_t>();
+            }
+            if (ingestJson.contains("maxFrameSize")) {
+                config.ingest.limits.maxFrameSize = ingestJson["maxFrameSize"].get<size_t>();
+            }
+            if (ingestJson.contains("sinks") && ingestJson["sinks"].is_array()) {
+                for (const auto& sink : ingestJson["sinks"]) {
+                    config.ingest.sinks.push_back(stringToSinkType(sink.get<std::string>()));
+                }
+            }
+        }
+
+        // Parse thread placement
+        if (j.contains("threads") && j["threads"].is_object()) {
+            const auto& threads = j["threads"];
+            if (threads.contains("logger")) {
+                parseThreadConfig(threads["logger"], config.loggerThread);
+            }
+            if (threads.contains("pool")) {
+                parseThreadConfig(threads["pool"], config.poolThreads);
+            }
+            if (threads.contains("sources")) {
+                parseThreadConfig(threads["sources"], config.sourceThreads);
+            }
+        }
+
         return config;
     }
 
@@ -96,6 +328,11 @@ namespace facade
         std::cout << "App Name: " << appName << std::endl;
         std::cout << "Buffer Size: " << bufferSize << std::endl;
         std::cout << "Thread Pool Size: " << threadPoolSize << std::endl;
+        std::cout << "Source Threads: "
+                  << (reactorThreads > 0 ? std::to_string(reactorThreads) + " reactor" : std::string("one per source"))
+                  << (reactorThreads > 0 && ioUring ? " (io_uring batched reads)" : "")
+                  << (reactorThreads > 0 ? std::string() : ", " + std::to_string(samplerThreads) + " sampler")
+                  << std::endl;
         std::cout << "Log File Path: " << logFilePath << std::endl;
         std::cout << std::endl;
 
@@ -103,15 +340,69 @@ namespace facade
         for (const auto& [name, src] : sources) {
             std::cout << "  " << name << ":" << std::endl;
             std::cout << "    Enabled: " << (src.enabled ? "true" : "false") << std::endl;
-            std::cout << "    Type: " << (src.type == SourceType::FILE ? "FILE" : "VSOMEIP") << std::endl;
+            std::cout << "    Type: " << sourceTypeToString(src.type);
+            if (src.type == SourceType::SOCKET) {
+                if (src.socketKind == SmartDataHub::SocketKind::Stream) {
+                    std::cout << " (" << socketKindToString(src.socketKind)
+                              << (src.framing == SmartDataHub::FramingMode::LengthPrefixed ? ", length-prefixed)" : ", newline)");
+                } else {
+                    std::cout << " (" << socketKindToString(src.socketKind) << ", batch " << src.batchSize << ")";
+                }
+            } else if (src.type == SourceType::SHM) {
+                std::cout << " (ring " << src.ringCapacity << " bytes)";
+            } else if (src.type == SourceType::PERCORE) {
+                std::cout << (src.topK > 0 ? " (top " + std::to_string(src.topK) + " cores)" : " (all cores)");
+            } else if (src.type == SourceType::MEMINFO) {
+                std::cout << " (" << __builtin_popcountll(src.memFields) << " fields)";
+            } else if (src.type == SourceType::DISKSTATS || src.type == SourceType::NETDEV) {
+                std::cout << " (";
+                for (size_t i = 0; i < src.devices.size(); ++i) {
+                    std::cout << (i ? "," : "") << src.devices[i];
+                }
+                std::cout << (src.devices.empty() ? "all devices)" : ")");
+            } else if (src.type == SourceType::PSI) {
+                std::cout << " (" << src.resource << ")";
+            } else if (src.type == SourceType::CGROUP) {
+                std::cout << (src.path.empty() ? " (own cgroup)" : "");
+            } else if (src.type == SourceType::PROCESSES) {
+                std::cout << " (top " << (src.topK > 0 ? src.topK : 10) << ", "
+                          << src.scanThreads << " scan threads, " << src.maxOpenFds << " kept fds)";
+            } else if (src.type == SourceType::REPLAY) {
+                std::cout << " (";
+                if (src.speed > 0.0) {
+                    std::cout << src.speed << "x";
+                } else {
+                    std::cout << "max speed";
+                }
+                std::cout << (src.loop ? ", looped" : "") << ", " << src.streams << " streams)";
+            }
+            std::cout << std::endl;
             std::cout << "    Path: " << src.path << std::endl;
-            std::cout << "    Parse Rate: " << src.parseRateMs << "ms" << std::endl;
+            std::cout << "    Parse Rate: " << src.parseRateMs << "ms"
+                      << (src.eventDriven ? " (event-driven)" : "") << std::endl;
+            if (!src.throttle.isUnlimited()) {
+                std::cout << "    Throttle: " << src.throttle.ratePerSec << "/s"
+                          << ", INFO 1 in " << src.throttle.infoSampleEvery
+                          << ", INFO p=" << src.throttle.infoSampleProbability << std::endl;
+            }
             std::cout << "    Sinks: ";
             for (const auto& sink : src.sinks) {
                 std::cout << (sink == SinkType::CONSOLE ? "CONSOLE" : "FILE") << " ";
             }
             std::cout << std::endl;
         }
+
+        if (ingest.enabled) {
+            std::cout << std::endl << "Ingest: " << ingest.path
+                      << (ingest.framing == SmartDataHub::FramingMode::LengthPrefixed ? " (length-prefixed)" : " (newline)")
+                      << ", max " << ingest.limits.maxConnections << " connections"
+                      << ", max frame " << ingest.limits.maxFrameSize << " bytes" << std::endl;
+        }
+
+        std::cout << std::endl << "Threads:" << std::endl;
+        printThreadConfig("logger", loggerThread);
+        printThreadConfig("pool", poolThreads);
+        printThreadConfig("sources", sourceThreads);
     }
 
 } // namespace facade
@@ -3,10 +3,19 @@
 #include "inc/logging/FileSinkImpl.hpp"
 #include "inc/logging/LogMessage.hpp"
 #include "inc/SmartDataHub/FileTelemetrySourceImpl.hpp"
+#include "inc/SmartDataHub/NumberParser.hpp"
+#include "inc/SmartDataHub/TelemetryParser.hpp"
+#include "inc/SmartDataHub/CgroupCollectors.hpp"
+#include "inc/SmartDataHub/ProcCollectors.hpp"
+#include "inc/SmartDataHub/ProcSampler.hpp"
+#include "inc/SmartDataHub/ProcessCollector.hpp"
+#include "inc/SmartDataHub/ReplayTelemetrySourceImpl.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <csignal>
 #include <chrono>
+#include <poll.h>
 
 namespace facade
 {
@@ -37,7 +46,9 @@ namespace facade
             m_sinks,
             m_config.bufferSize,
             true,  // use thread pool
-            m_config.threadPoolSize
+            m_config.threadPoolSize,
+            m_config.loggerThread,
+            m_config.poolThreads
         );
 
         std::cout << "[TelemetryApp] Initialized successfully" << std::endl;
@@ -64,6 +75,12 @@ namespace facade
                 if (sink == SinkType::FILE) needFile = true;
             }
         }
+        if (m_config.ingest.enabled) {
+            for (const auto& sink : m_config.ingest.sinks) {
+                if (sink == SinkType::CONSOLE) needConsole = true;
+                if (sink == SinkType::FILE) needFile = true;
+            }
+        }
 
         // Create required sinks
         if (needConsole) {
@@ -94,8 +111,22 @@ namespace facade
         m_logManager->start();
         std::cout << "[TelemetryApp] AsyncLogManager started" << std::endl;
 
-        // Create source threads
-        createSourceThreads();
+        // Periodic samplers share one timer wheel instead of sleeping
+        createTimerWheel();
+
+        // Either one reactor for all sources or one thread per source
+        if (m_config.reactorThreads > 0) {
+            createReactor();
+        } else {
+            createSourceThreads();
+        }
+
+        createCollectorThread();
+        m_timerWheel->start();
+
+        if (m_config.ingest.enabled) {
+            createIngestServer();
+        }
 
         std::cout << "[TelemetryApp] Application started. Press Ctrl+C to stop." << std::endl;
     }
@@ -108,74 +139,836 @@ namespace facade
                 continue;
             }
 
+            if (!srcConfig.throttle.isUnlimited()) {
+                m_logManager->setThrottle(name, srcConfig.throttle);
+            }
+
+            // Sampled together by createCollectorThread()
+            if (isCollectorType(srcConfig.type)) {
+                continue;
+            }
+            if (isSampledType(srcConfig)) {
+                if (auto sampler = makeSampler(name, srcConfig)) {
+                    addSampler(name, srcConfig.parseRateMs, std::move(sampler));
+                }
+                continue;
+            }
+
             std::cout << "[TelemetryApp] Starting source thread: " << name << std::endl;
             
-            m_sourceThreads.emplace_back(&TelemetryApp::sourceWorker, this, name, srcConfig);
+            // Replay streams each get a thread, all playing one mapping
+            std::size_t streams = srcConfig.type == SourceType::REPLAY ? std::max<std::size_t>(srcConfig.streams, 1) : 1;
+            for (std::size_t i = 0; i < streams; ++i) {
+                m_sourceThreads.emplace_back(&TelemetryApp::sourceWorker, this, name, srcConfig);
+            }
         }
     }
 
-    void TelemetryApp::sourceWorker(const std::string& sourceName, const SourceConfig& config)
+    std::unique_ptr<SmartDataHub::ITelemetrySource> TelemetryApp::createSource(
+        const std::string& sourceName, const SourceConfig& config)
     {
-        std::cout << "[" << sourceName << "] Worker thread started" << std::endl;
+        if (config.type == SourceType::SOCKET) {
+            std::unique_ptr<SmartDataHub::SocketTelemetrySourceImpl> socketSource;
+            if (config.socketKind == SmartDataHub::SocketKind::Stream) {
+                socketSource = std::make_unique<SmartDataHub::SocketTelemetrySourceImpl>(
+                    config.path, config.framing);
+            } else {
+                socketSource = std::make_unique<SmartDataHub::SocketTelemetrySourceImpl>(
+                    config.path, config.socketKind, config.batchSize);
+            }
+            if (!socketSource->openSource()) {
+                std::cerr << "[" << sourceName << "] Failed to open socket " << config.path << std::endl;
+                return nullptr;
+            }
+            return socketSource;
+        }
 
-        // Create the appropriate source
-        std::unique_ptr<SmartDataHub::ITelemetrySource> source;
+        if (config.type == SourceType::SHM) {
+            auto shmSource = std::make_unique<SmartDataHub::ShmTelemetrySourceImpl>(
+                config.path, config.ringCapacity);
+            if (!shmSource->openSource()) {
+                std::cerr << "[" << sourceName << "] Failed to create ring " << config.path << std::endl;
+                return nullptr;
+            }
+            return shmSource;
+        }
 
-        if (config.type == SourceType::FILE) {
-            source = std::make_unique<SmartDataHub::FileTelemetrySourceImpl>(config.path);
-        } else {
+        if (config.type == SourceType::REPLAY) {
+            std::shared_ptr<const SmartDataHub::ReplayTrace> trace;
+            {
+                std::lock_guard<std::mutex> lock(m_replayMutex);
+                auto& cached = m_replayTraces[config.path];
+                if (!cached) {
+                    cached = SmartDataHub::ReplayTrace::open(config.path);
+                }
+                trace = cached;
+            }
+            auto replaySource = std::make_unique<SmartDataHub::ReplayTelemetrySourceImpl>(
+                std::move(trace), config.speed, config.loop);
+            if (!replaySource->getTrace() || !replaySource->openSource()) {
+                std::cerr << "[" << sourceName << "] Failed to open trace " << config.path << std::endl;
+                return nullptr;
+            }
+            return replaySource;
+        }
+
+        if (config.type != SourceType::FILE) {
             std::cerr << "[" << sourceName << "] VSOMEIP source not yet integrated, skipping" << std::endl;
-            return;
+            return nullptr;
+        }
+
+        auto fileSource = std::make_unique<SmartDataHub::FileTelemetrySourceImpl>(config.path);
+        if (config.eventDriven && !fileSource->enableWatch()) {
+            std::cerr << "[" << sourceName << "] Cannot watch " << config.path
+                      << ", falling back to polling" << std::endl;
         }
 
         // Open the source
-        if (!source->openSource()) {
+        if (!fileSource->openSource()) {
             std::cerr << "[" << sourceName << "] Failed to open source!" << std::endl;
+            return nullptr;
+        }
+        return fileSource;
+    }
+
+    bool TelemetryApp::isCollectorType(SourceType type)
+    {
+        return type == SourceType::DISKSTATS || type == SourceType::NETDEV ||
+               type == SourceType::LOADAVG || type == SourceType::PSI || type == SourceType::CGROUP;
+    }
+
+    std::unique_ptr<SmartDataHub::ProcCollector> TelemetryApp::createCollector(
+        const std::string& sourceName, const SourceConfig& config)
+    {
+        std::unique_ptr<SmartDataHub::ProcCollector> collector;
+        switch (config.type) {
+            case SourceType::DISKSTATS:
+                collector = config.path.empty() ? std::make_unique<SmartDataHub::DiskStatsCollector>()
+                                                : std::make_unique<SmartDataHub::DiskStatsCollector>(config.path);
+                break;
+            case SourceType::NETDEV:
+                collector = config.path.empty() ? std::make_unique<SmartDataHub::NetDevCollector>()
+                                                : std::make_unique<SmartDataHub::NetDevCollector>(config.path);
+                break;
+            case SourceType::LOADAVG:
+                collector = config.path.empty() ? std::make_unique<SmartDataHub::LoadAvgCollector>()
+                                                : std::make_unique<SmartDataHub::LoadAvgCollector>(config.path);
+                break;
+            case SourceType::PSI:
+                collector = std::make_unique<SmartDataHub::PressureCollector>(config.path);
+                break;
+            default:
+                return nullptr;
+        }
+
+        collector->setFilter(config.devices);
+        if (!collector->open()) {
+            std::cerr << "[" << sourceName << "] Cannot open " << collector->getPath() << std::endl;
+            return nullptr;
+        }
+        return collector;
+    }
+
+    std::vector<TelemetryApp::CgroupFile> TelemetryApp::createCgroupCollectors(
+        const std::string& sourceName, const SourceConfig& config)
+    {
+        std::vector<CgroupFile> files;
+        std::string dir = config.path.empty() ? SmartDataHub::discoverCgroupDir() : config.path;
+        if (dir.empty()) {
+            std::cerr << "[" << sourceName << "] No cgroup v2 hierarchy" << std::endl;
+            return files;
+        }
+        std::cout << "[" << sourceName << "] Sampling cgroup " << dir << std::endl;
+
+        files.push_back({"cpu", logging::Context::CPU, std::make_unique<SmartDataHub::CgroupCpuStatCollector>(dir + "/cpu.stat")});
+        files.push_back({"memory", logging::Context::RAM, std::make_unique<SmartDataHub::CgroupMemoryCollector>(dir + "/memory.current")});
+        files.push_back({"memory", logging::Context::RAM, std::make_unique<SmartDataHub::CgroupMemoryStatCollector>(dir + "/memory.stat")});
+        files.push_back({"io", logging::Context::DISK, std::make_unique<SmartDataHub::CgroupIoStatCollector>(dir + "/io.stat")});
+        files.push_back({"cpu_pressure", logging::Context::CPU, std::make_unique<SmartDataHub::PressureCollector>(dir + "/cpu.pressure")});
+
+        // memory.* and io.* only exist where the controller is enabled
+        std::vector<CgroupFile> opened;
+        for (auto& file : files) {
+            file.collector->setFilter(config.devices);
+            if (!file.collector->open()) {
+                std::cerr << "[" << sourceName << "] Skipping " << file.collector->getPath() << std::endl;
+                continue;
+            }
+            opened.push_back(std::move(file));
+        }
+        return opened;
+    }
+
+    void TelemetryApp::createCollectorThread()
+    {
+        std::vector<std::string> sourceNames;
+        for (const auto& [name, srcConfig] : m_config.sources) {
+            if (srcConfig.enabled && isCollectorType(srcConfig.type)) {
+                sourceNames.push_back(name);
+            }
+        }
+        if (sourceNames.empty()) {
             return;
         }
 
+        std::cout << "[TelemetryApp] Starting collector thread for " << sourceNames.size() << " source(s)" << std::endl;
+        m_sourceThreads.emplace_back(&TelemetryApp::collectorWorker, this, std::move(sourceNames));
+    }
+
+    void TelemetryApp::collectorWorker(std::vector<std::string> sourceNames)
+    {
+        async_logging::applyThreadConfig(m_config.sourceThreads, "-proc");
+
+        struct Target
+        {
+            std::string name;
+            logging::Context context;
+            std::shared_ptr<async_logging::LogThrottle> throttle;
+        };
+        std::vector<Target> targets;
+
+        SmartDataHub::ProcSampler sampler(m_config.ioUring);
+        for (const auto& name : sourceNames) {
+            const SourceConfig& config = m_config.sources.at(name);
+            if (config.type == SourceType::CGROUP) {
+                auto throttle = m_logManager->getThrottle(name);
+                for (auto& file : createCgroupCollectors(name, config)) {
+                    sampler.add(std::move(file.collector), config.parseRateMs);
+                    targets.push_back({name + "." + file.group, file.context, throttle});
+                }
+                continue;
+            }
+
+            auto collector = createCollector(name, config);
+            if (!collector) {
+                continue;
+            }
+
+            logging::Context context = logging::Context::CPU;
+            if (config.type == SourceType::DISKSTATS || (config.type == SourceType::PSI && config.resource == "io")) {
+                context = logging::Context::DISK;
+            } else if (config.type == SourceType::NETDEV) {
+                context = logging::Context::NET;
+            } else if (config.type == SourceType::PSI && config.resource == "memory") {
+                context = logging::Context::RAM;
+            }
+
+            sampler.add(std::move(collector), config.parseRateMs);
+            targets.push_back({name, context, m_logManager->getThrottle(name)});
+        }
+        if (targets.empty()) {
+            return;
+        }
+
+        const auto onMetrics = [this, &targets](std::size_t index, const std::vector<SmartDataHub::Metric>& metrics) {
+            const Target& target = targets[index];
+            publishMetrics(target.name, target.context, target.throttle.get(), metrics);
+        };
+
+        while (m_running && !g_shutdownRequested) {
+            auto next = sampler.sampleDue(onMetrics);
+
+            // Short waits keep shutdown responsive
+            auto wait = std::min<std::chrono::steady_clock::duration>(
+                next - std::chrono::steady_clock::now(), std::chrono::milliseconds(100));
+            if (wait > std::chrono::steady_clock::duration::zero()) {
+                std::this_thread::sleep_for(wait);
+            }
+        }
+
+        std::cout << "[TelemetryApp] Collector thread stopped (" << (sampler.usesIoUring() ? "io_uring, " : "")
+                  << sampler.getSubmissions() << " batched submissions)" << std::endl;
+    }
+
+    logging::Context TelemetryApp::contextForSource(const std::string& sourceName)
+    {
         // Determine context from source name
-        logging::Context context = logging::Context::CPU;
-        if (sourceName == "RAM") context = logging::Context::RAM;
-        else if (sourceName == "GPU") context = logging::Context::GPU;
+        if (sourceName == "RAM") return logging::Context::RAM;
+        if (sourceName == "GPU") return logging::Context::GPU;
+        return logging::Context::CPU;
+    }
+
+    std::optional<logging::LogMessage> TelemetryApp::buildSample(const std::string& sourceName,
+                                                                 logging::Context context,
+                                                                 async_logging::LogThrottle* throttle,
+                                                                 std::string_view rawData)
+    {
+        float value = 0.0f;
+        SmartDataHub::NumberStatus status = SmartDataHub::RecordValues::parseOne(rawData, value);
+        status = sampleValue(rawData, status, value);
+        return buildSample(sourceName, context, throttle, value, status);
+    }
+
+    std::optional<logging::LogMessage> TelemetryApp::buildSample(const std::string& sourceName,
+                                                                 logging::Context context,
+                                                                 async_logging::LogThrottle* throttle, float value,
+                                                                 SmartDataHub::NumberStatus status)
+    {
+        if (status != SmartDataHub::NumberStatus::Ok) {
+            std::cerr << "[" << sourceName << "] Parse error: " << SmartDataHub::toString(status) << std::endl;
+            return std::nullopt;
+        }
+
+        // Clamp to 0-100
+        value = std::min(100.0f, std::max(0.0f, value));
+        uint8_t payload = static_cast<uint8_t>(value);
+
+        // Shed load before the message is built
+        if (throttle && !throttle->admit(logging::LogMessage::severityForPayload(payload))) {
+            return std::nullopt;
+        }
+        return logging::LogMessage(sourceName, context, payload);
+    }
+
+    SmartDataHub::NumberStatus TelemetryApp::sampleValue(std::string_view rawData, SmartDataHub::NumberStatus status,
+                                                         float& value)
+    {
+        if (status != SmartDataHub::NumberStatus::Invalid) {
+            return status;
+        }
+
+        // Simple parsing - just extract first number, in place
+        value = 0.0f;
+        size_t pos = rawData.find_first_of("0123456789");
+        if (pos == std::string_view::npos) {
+            return SmartDataHub::NumberStatus::Ok;
+        }
+        const char* number = rawData.data() + pos;
+        return SmartDataHub::scanFloat(number, rawData.data() + rawData.size(), value);
+    }
+
+    void TelemetryApp::publishSample(const std::string& sourceName, logging::Context context,
+                                     async_logging::LogThrottle* throttle, const std::string& rawData)
+    {
+        auto msg = buildSample(sourceName, context, throttle, rawData);
+
+        // Create and log message
+        if (msg && !m_logManager->log(std::move(*msg))) {
+            std::cerr << "[" << sourceName << "] Failed to log message" << std::endl;
+        }
+    }
+
+    void TelemetryApp::publishBatch(const std::string& sourceName, logging::Context context,
+                                    async_logging::LogThrottle* throttle,
+                                    const std::vector<std::string_view>& rawData, SmartDataHub::RecordValues& values)
+    {
+        values.clear();
+        for (std::string_view sample : rawData) {
+            values.add(sample);
+        }
+        values.parse();
+
+        std::vector<logging::LogMessage> batch;
+        batch.reserve(rawData.size());
+        for (size_t i = 0; i < rawData.size(); ++i) {
+            float value = values.value(i);
+            SmartDataHub::NumberStatus status = sampleValue(rawData[i], values.status(i), value);
+            if (auto msg = buildSample(sourceName, context, throttle, value, status)) {
+                batch.push_back(std::move(*msg));
+            }
+        }
+
+        if (!batch.empty() && m_logManager->logBatch(batch) < batch.size()) {
+            std::cerr << "[" << sourceName << "] Failed to log batch" << std::endl;
+        }
+    }
+
+    void TelemetryApp::socketWorker(const std::string& sourceName, SmartDataHub::SocketTelemetrySourceImpl& source)
+    {
+        logging::Context context = contextForSource(sourceName);
+        auto throttle = m_logManager->getThrottle(sourceName);
+
+        std::vector<std::string_view> samples;
+        SmartDataHub::RecordValues values;
+        // A corrupt stream is no longer read, so its fd would stay readable
+        while (m_running && !g_shutdownRequested && !source.isClosed()) {
+            // Short waits keep shutdown responsive
+            pollfd pfd{source.getPollFd(), POLLIN, 0};
+            if (poll(&pfd, 1, 100) <= 0) {
+                continue;
+            }
+
+            samples.clear();
+            if (source.readFrames(samples) > 0) {
+                publishBatch(sourceName, context, throttle.get(), samples, values);
+            }
+        }
+
+        if (source.isCorrupt()) {
+            std::cerr << "[" << sourceName << "] Frame above the size limit, stream closed" << std::endl;
+        } else if (source.isPeerClosed()) {
+            std::cout << "[" << sourceName << "] Peer closed the socket" << std::endl;
+        }
+    }
+
+    void TelemetryApp::shmWorker(const std::string& sourceName, SmartDataHub::ShmTelemetrySourceImpl& source)
+    {
+        logging::Context context = contextForSource(sourceName);
+        auto throttle = m_logManager->getThrottle(sourceName);
+
+        std::vector<std::string_view> samples;
+        SmartDataHub::RecordValues values;
+        while (m_running && !g_shutdownRequested && source.isOpen()) {
+            // Short waits keep shutdown responsive
+            if (!source.waitForData(100)) {
+                continue;
+            }
+
+            samples.clear();
+            if (source.readRecords(samples) > 0) {
+                publishBatch(sourceName, context, throttle.get(), samples, values);
+            }
+        }
+        if (source.isCorrupt()) {
+            std::cerr << "[" << sourceName << "] Shared-memory ring corrupt, source stopped" << std::endl;
+        }
+    }
+
+    void TelemetryApp::replayWorker(const std::string& sourceName, SmartDataHub::ReplayTelemetrySourceImpl& source)
+    {
+        logging::Context context = contextForSource(sourceName);
+        auto throttle = m_logManager->getThrottle(sourceName);
+        auto started = std::chrono::steady_clock::now();
+
+        std::vector<std::string_view> samples;
+        SmartDataHub::RecordValues values;
+        while (m_running && !g_shutdownRequested && !source.isFinished()) {
+            // Short waits keep shutdown responsive
+            if (!source.waitForData(100)) {
+                continue;
+            }
+
+            samples.clear();
+            if (source.readRecords(samples) > 0) {
+                publishBatch(sourceName, context, throttle.get(), samples, values);
+            }
+        }
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        std::cout << "[" << sourceName << "] Replayed " << source.getReplayedCount() << " samples"
+                  << (source.isFinished() ? " (end of trace)" : "") << ", "
+                  << static_cast<uint64_t>(seconds > 0.0 ? source.getReplayedCount() / seconds : 0.0)
+                  << "/s, max lag " << source.getMaxLagUs() << "us" << std::endl;
+    }
+
+    SmartDataHub::TimerWheel::Callback TelemetryApp::makeFileSampler(
+        const std::string& sourceName, std::shared_ptr<SmartDataHub::ITelemetrySource> source)
+    {
+        logging::Context context = contextForSource(sourceName);
+        // Resolved once so the per-sample check is a single atomic operation
+        auto throttle = m_logManager->getThrottle(sourceName);
+
+        return [this, sourceName, source, context, throttle]() {
+            std::string rawData;
+            if (source->readSource(rawData)) {
+                publishSample(sourceName, context, throttle.get(), rawData);
+            }
+        };
+    }
+
+    SmartDataHub::TimerWheel::Callback TelemetryApp::makePerCoreSampler(const std::string& sourceName,
+                                                                        const SourceConfig& config)
+    {
+        auto parser = std::make_shared<SmartDataHub::TelemetryParser>(
+            config.path.empty() ? "/proc/stat" : config.path, "/proc/meminfo");
+        if (!parser->samplePerCore()) {
+            std::cerr << "[" << sourceName << "] Cannot read per-core counters" << std::endl;
+            return {};
+        }
+        std::cout << "[" << sourceName << "] Sampling " << parser->getCores().size() << " cores" << std::endl;
+
+        // Reused across ticks; the wheel never runs one sampler twice at once
+        struct State
+        {
+            std::vector<SmartDataHub::TelemetryParser::CoreUsage> cores;
+            std::vector<logging::LogMessage> batch;
+        };
+        auto state = std::make_shared<State>();
+        auto throttle = m_logManager->getThrottle(sourceName);
+        const std::size_t topK = config.topK;
+
+        return [this, sourceName, parser, state, throttle, topK]() {
+            if (!parser->samplePerCore()) {
+                return;
+            }
+
+            parser->getTopCores(topK, state->cores);
+            state->batch.clear();
+            for (const auto& core : state->cores) {
+                uint8_t payload = static_cast<uint8_t>(core.usage);
+                if (throttle && !throttle->admit(logging::LogMessage::severityForPayload(payload))) {
+                    continue;
+                }
+                state->batch.emplace_back(sourceName + ".cpu" + std::to_string(core.core), logging::Context::CPU, payload);
+            }
+
+            if (!state->batch.empty() && m_logManager->logBatch(state->batch) < state->batch.size()) {
+                std::cerr << "[" << sourceName << "] Failed to log batch" << std::endl;
+            }
+        };
+    }
+
+    void TelemetryApp::publishMetrics(const std::string& sourceName, logging::Context context,
+                                      async_logging::LogThrottle* throttle,
+                                      const std::vector<SmartDataHub::Metric>& metrics)
+    {
+        std::vector<logging::LogMessage> batch;
+        batch.reserve(metrics.size());
+        std::string name = sourceName + ".";
+        for (const auto& metric : metrics) {
+            name.resize(sourceName.size() + 1);
+            name.append(metric.name);
+
+            if (!metric.unit.empty()) {
+                if (throttle && !throttle->admit(logging::Severity::INFO)) {
+                    continue;
+                }
+                batch.emplace_back(name, context, logging::Severity::INFO, metric.value, std::string(metric.unit));
+                continue;
+            }
+
+            uint8_t payload = static_cast<uint8_t>(std::min(100.0, std::max(0.0, metric.value)));
+            if (throttle && !throttle->admit(logging::LogMessage::severityForPayload(payload))) {
+                continue;
+            }
+            batch.emplace_back(name, context, payload);
+        }
+
+        if (!batch.empty() && m_logManager->logBatch(batch) < batch.size()) {
+            std::cerr << "[" << sourceName << "] Failed to log batch" << std::endl;
+        }
+    }
+
+    SmartDataHub::TimerWheel::Callback TelemetryApp::makeMemInfoSampler(const std::string& sourceName,
+                                                                        const SourceConfig& config)
+    {
+        struct State
+        {
+            SmartDataHub::TelemetryParser parser;
+            SmartDataHub::MemInfo info;
+            std::vector<SmartDataHub::Metric> metrics;
+        };
+        auto state = std::make_shared<State>(State{
+            SmartDataHub::TelemetryParser("/proc/stat", config.path.empty() ? "/proc/meminfo" : config.path), {}, {}});
+        auto throttle = m_logManager->getThrottle(sourceName);
+
+        // The totals are parsed too so the parts of them can be logged as
+        // a share; the rest is logged in kB
+        const SmartDataHub::MemFieldMask wanted = config.memFields;
+        const SmartDataHub::MemFieldMask parsed = wanted | SmartDataHub::MemPercentBases;
+
+        return [this, sourceName, state, throttle, wanted, parsed]() {
+            if (!state->parser.getMemInfo(state->info, parsed)) {
+                return;
+            }
+            state->metrics.clear();
+            for (std::size_t i = 0; i < SmartDataHub::MemFieldCount; ++i) {
+                auto field = static_cast<SmartDataHub::MemField>(i);
+                if ((wanted & state->info.found & SmartDataHub::memFieldBit(field)) == 0) {
+                    continue;
+                }
+                if (SmartDataHub::memPercentBase(field) == SmartDataHub::MemField::Count) {
+                    state->metrics.push_back({SmartDataHub::MemFieldKeys[i],
+                                              static_cast<double>(state->info.get(field)), "kB"});
+                } else {
+                    state->metrics.push_back({SmartDataHub::MemFieldKeys[i], state->info.percent(field), {}});
+                }
+            }
+            publishMetrics(sourceName, logging::Context::RAM, throttle.get(), state->metrics);
+        };
+    }
+
+    SmartDataHub::TimerWheel::Callback TelemetryApp::makeProcessSampler(const std::string& sourceName,
+                                                                        const SourceConfig& config)
+    {
+        struct State
+        {
+            SmartDataHub::ProcessCollector collector;
+            std::unique_ptr<async_logging::ThreadPool> scanPool;
+            std::vector<SmartDataHub::ProcessUsage> top;
+            std::vector<std::string> names; // "<comm>[<pid>].cpu", ".rss" per entry, reused
+            std::vector<SmartDataHub::Metric> metrics;
+
+            State(const std::string& procRoot, std::size_t maxOpenFds) : collector(procRoot, maxOpenFds) {}
+        };
+        const std::string procRoot = config.path.empty() ? "/proc" : config.path;
+        auto state = std::make_shared<State>(procRoot, config.maxOpenFds);
+        if (!state->collector.open()) {
+            std::cerr << "[" << sourceName << "] Cannot open " << procRoot << std::endl;
+            return {};
+        }
+
+        if (config.scanThreads > 0) {
+            async_logging::ThreadConfig poolConfig = m_config.sourceThreads;
+            poolConfig.name += "-" + sourceName;
+            state->scanPool = std::make_unique<async_logging::ThreadPool>(config.scanThreads, poolConfig);
+            state->collector.setThreadPool(state->scanPool.get());
+        }
+
+        const std::size_t topK = config.topK > 0 ? config.topK : 10;
+        auto throttle = m_logManager->getThrottle(sourceName);
+
+        return [this, sourceName, state, throttle, topK]() {
+            if (!state->collector.sample(topK, state->top) || state->top.empty()) {
+                return;
+            }
+            state->names.resize(std::max(state->names.size(), state->top.size() * 2));
+            state->metrics.clear();
+            for (std::size_t i = 0; i < state->top.size(); ++i) {
+                const auto& process = state->top[i];
+                std::string& cpuName = state->names[2 * i];
+                cpuName.assign(process.name);
+                cpuName += '[';
+                cpuName += std::to_string(process.pid);
+                cpuName += ']';
+                std::string& rssName = state->names[2 * i + 1];
+                rssName = cpuName + ".rss";
+                cpuName += ".cpu";
+                state->metrics.push_back({cpuName, process.cpuPercent, "%cpu"});
+                state->metrics.push_back({rssName, static_cast<double>(process.rssKb), "kB"});
+            }
+            publishMetrics(sourceName, logging::Context::CPU, throttle.get(), state->metrics);
+        };
+    }
+
+    bool TelemetryApp::isSampledType(const SourceConfig& config)
+    {
+        return (config.type == SourceType::FILE && !config.eventDriven) || config.type == SourceType::PERCORE ||
+               config.type == SourceType::MEMINFO || config.type == SourceType::PROCESSES;
+    }
+
+    SmartDataHub::TimerWheel::Callback TelemetryApp::makeSampler(const std::string& sourceName,
+                                                                 const SourceConfig& config)
+    {
+        switch (config.type) {
+            case SourceType::PERCORE:
+                return makePerCoreSampler(sourceName, config);
+            case SourceType::MEMINFO:
+                return makeMemInfoSampler(sourceName, config);
+            case SourceType::PROCESSES:
+                return makeProcessSampler(sourceName, config);
+            default:
+                break;
+        }
+
+        std::shared_ptr<SmartDataHub::ITelemetrySource> source = createSource(sourceName, config);
+        if (!source) {
+            return {};
+        }
+        return makeFileSampler(sourceName, std::move(source));
+    }
+
+    void TelemetryApp::createTimerWheel()
+    {
+        m_timerWheel = std::make_unique<SmartDataHub::TimerWheel>();
+        const async_logging::ThreadConfig threadConfig = m_config.sourceThreads;
+        m_timerWheel->setThreadStartHook([threadConfig]() {
+            async_logging::applyThreadConfig(threadConfig, "-wheel");
+        });
+
+        // With a reactor the callbacks run on its threads instead
+        if (m_config.reactorThreads == 0) {
+            async_logging::ThreadConfig poolConfig = m_config.sourceThreads;
+            poolConfig.name += "-smp";
+            m_samplerPool = std::make_unique<async_logging::ThreadPool>(
+                std::max<std::size_t>(m_config.samplerThreads, 1), poolConfig);
+        }
+    }
+
+    void TelemetryApp::addSampler(const std::string& sourceName, int periodMs, SmartDataHub::TimerWheel::Callback sampler)
+    {
+        SmartDataHub::TimerWheel::Executor executor;
+        std::lock_guard<std::mutex> lock(m_samplersMutex);
+        if (!m_running) {
+            return; // stop() has already torn down the wheel's executors
+        }
+        if (m_reactor) {
+            // Spread over the reactor threads, next to their sources
+            SmartDataHub::TelemetryReactor* reactor = m_reactor.get();
+            std::size_t thread = m_sampleTimers.size();
+            executor = [reactor, thread](std::function<void()> task) { reactor->post(thread, std::move(task)); };
+        } else if (m_samplerPool) {
+            async_logging::ThreadPool* pool = m_samplerPool.get();
+            executor = [pool](std::function<void()> task) { pool->enqueueTask(std::move(task)); };
+        }
+
+        auto id = m_timerWheel->schedule(std::chrono::milliseconds(std::max(periodMs, 1)), std::move(sampler),
+                                         std::move(executor));
+        m_sampleTimers.emplace_back(sourceName, id);
+        std::cout << "[" << sourceName << "] Sampling every " << periodMs << "ms on the timer wheel" << std::endl;
+    }
+
+    void TelemetryApp::sourceWorker(const std::string& sourceName, const SourceConfig& config)
+    {
+        async_logging::applyThreadConfig(m_config.sourceThreads, "-" + sourceName);
+        std::cout << "[" << sourceName << "] Worker thread started" << std::endl;
+
+        // Create the appropriate source
+        std::unique_ptr<SmartDataHub::ITelemetrySource> source = createSource(sourceName, config);
+        if (!source) {
+            return;
+        }
+
+        // Socket sources are read as soon as data is queued, in batches
+        if (auto* socketSource = dynamic_cast<SmartDataHub::SocketTelemetrySourceImpl*>(source.get())) {
+            socketWorker(sourceName, *socketSource);
+            std::cout << "[" << sourceName << "] Worker thread stopped" << std::endl;
+            return;
+        }
+        if (auto* shmSource = dynamic_cast<SmartDataHub::ShmTelemetrySourceImpl*>(source.get())) {
+            shmWorker(sourceName, *shmSource);
+            std::cout << "[" << sourceName << "] Worker thread stopped" << std::endl;
+            return;
+        }
+        if (auto* replaySource = dynamic_cast<SmartDataHub::ReplayTelemetrySourceImpl*>(source.get())) {
+            replayWorker(sourceName, *replaySource);
+            std::cout << "[" << sourceName << "] Worker thread stopped" << std::endl;
+            return;
+        }
+
+        // Event-driven file sources wait for writes; without a watch the
+        // source is polled by the timer wheel instead
+        auto* watchedSource = dynamic_cast<SmartDataHub::FileTelemetrySourceImpl*>(source.get());
+        if (!watchedSource || !watchedSource->isWatching()) {
+            addSampler(sourceName, config.parseRateMs, makeFileSampler(sourceName, std::move(source)));
+            std::cout << "[" << sourceName << "] Worker thread stopped" << std::endl;
+            return;
+        }
+
+        logging::Context context = contextForSource(sourceName);
+
+        // Resolved once so the per-sample check is a single atomic operation
+        auto throttle = m_logManager->getThrottle(sourceName);
 
         // Main reading loop
+        bool haveData = true;
         while (m_running && !g_shutdownRequested) {
             std::string rawData;
             
-            if (source->readSource(rawData)) {
-                try {
-                    // Parse the value (for /proc/stat, we just use a simple percentage)
-                    float value = 0.0f;
-                    
-                    // Simple parsing - just extract first number
-                    size_t pos = rawData.find_first_of("0123456789");
-                    if (pos != std::string::npos) {
-                        value = std::stof(rawData.substr(pos));
-                    }
-                    
-                    // Clamp to 0-100
-                    value = std::min(100.0f, std::max(0.0f, value));
-                    uint8_t payload = static_cast<uint8_t>(value);
-
-                    // Create and log message
-                    logging::LogMessage msg(sourceName, context, payload);
-                    
-                    if (!m_logManager->log(std::move(msg))) {
-                        std::cerr << "[" << sourceName << "] Failed to log message" << std::endl;
-                    }
-                } catch (const std::exception& e) {
-                    std::cerr << "[" << sourceName << "] Parse error: " << e.what() << std::endl;
+            if (haveData && source->readSource(rawData)) {
+                publishSample(sourceName, context, throttle.get(), rawData);
+            }
+
+            // Wake on the next write; short waits keep shutdown responsive
+            haveData = watchedSource->waitForData(100);
+        }
+
+        std::cout << "[" << sourceName << "] Worker thread stopped" << std::endl;
+    }
+    void TelemetryApp::createReactor()
+    {
+        m_reactor = std::make_unique<SmartDataHub::TelemetryReactor>(m_config.reactorThreads);
+        m_reactor->setBatchedReads(m_config.ioUring);
+
+        const async_logging::ThreadConfig threadConfig = m_config.sourceThreads;
+        m_reactor->setThreadStartHook([threadConfig](std::size_t index) {
+            async_logging::applyThreadConfig(threadConfig, "-r" + std::to_string(index));
+        });
+
+        for (const auto& [name, srcConfig] : m_config.sources) {
+            if (!srcConfig.enabled) {
+                std::cout << "[TelemetryApp] Source '" << name << "' is disabled, skipping" << std::endl;
+                continue;
+            }
+
+            if (!srcConfig.throttle.isUnlimited()) {
+                m_logManager->setThrottle(name, srcConfig.throttle);
+            }
+
+            // Not a line source: sampled on the wheel, run on reactor threads
+            if (srcConfig.type == SourceType::PERCORE || srcConfig.type == SourceType::MEMINFO ||
+                srcConfig.type == SourceType::PROCESSES) {
+                if (auto sampler = makeSampler(name, srcConfig)) {
+                    addSampler(name, srcConfig.parseRateMs, std::move(sampler));
+                }
+                continue;
+            }
+            if (isCollectorType(srcConfig.type)) {
+                continue;
+            }
+
+            // The ring and the replay trace have no fd to poll: on the
+            // reactor's timer they would yield one record per tick, so they
+            // keep their own workers, which drain everything due per wakeup
+            if (srcConfig.type == SourceType::SHM || srcConfig.type == SourceType::REPLAY) {
+                std::cout << "[TelemetryApp] Starting source thread: " << name << std::endl;
+                std::size_t streams = srcConfig.type == SourceType::REPLAY ? std::max<std::size_t>(srcConfig.streams, 1) : 1;
+                for (std::size_t i = 0; i < streams; ++i) {
+                    m_sourceThreads.emplace_back(&TelemetryApp::sourceWorker, this, name, srcConfig);
                 }
+                continue;
             }
 
-            // Sleep for configured rate
-            for (int i = 0; i < config.parseRateMs / 100 && m_running && !g_shutdownRequested; ++i) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            logging::Context context = contextForSource(name);
+            auto throttle = m_logManager->getThrottle(name);
+            if (auto source = createSource(name, srcConfig)) {
+                m_reactor->addSource(name, std::move(source), srcConfig.parseRateMs,
+                    [this, context, throttle](const std::string& sourceName, const std::string& data) {
+                        publishSample(sourceName, context, throttle.get(), data);
+                    });
             }
         }
 
-        std::cout << "[" << sourceName << "] Worker thread stopped" << std::endl;
+        std::cout << "[TelemetryApp] Reactor driving " << m_reactor->getSourceCount() << " sources on "
+                  << m_reactor->getThreadCount() << " thread(s)" << std::endl;
+        m_reactor->start();
+    }
+
+    void TelemetryApp::createIngestServer()
+    {
+        m_ingestServer = std::make_unique<SmartDataHub::TelemetryIngestServer>(
+            m_config.ingest.path,
+            [this](const std::vector<SmartDataHub::IngestSample>& batch) { publishIngestBatch(batch); },
+            m_config.ingest.framing,
+            m_config.ingest.limits);
+
+        const async_logging::ThreadConfig threadConfig = m_config.sourceThreads;
+        m_ingestServer->setThreadStartHook([threadConfig]() {
+            async_logging::applyThreadConfig(threadConfig, "-ingest");
+        });
+
+        if (!m_ingestServer->start()) {
+            std::cerr << "[TelemetryApp] Ingest endpoint not started" << std::endl;
+            m_ingestServer.reset();
+            return;
+        }
+        std::cout << "[TelemetryApp] Ingest listening on " << m_config.ingest.path << std::endl;
+    }
+
+    void TelemetryApp::publishIngestBatch(const std::vector<SmartDataHub::IngestSample>& batch)
+    {
+        // Every sample of the round in one parse
+        m_ingestValues.clear();
+        for (const auto& sample : batch) {
+            m_ingestValues.add(sample.data);
+        }
+        m_ingestValues.parse();
+
+        std::vector<logging::LogMessage> messages;
+        messages.reserve(batch.size());
+
+        // Rounds usually carry runs from the same connection
+        std::string sourceName;
+        std::shared_ptr<async_logging::LogThrottle> throttle;
+        logging::Context context = logging::Context::CPU;
+
+        for (size_t i = 0; i < batch.size(); ++i) {
+            const auto& sample = batch[i];
+            if (sample.source != sourceName) {
+                sourceName.assign(sample.source);
+                throttle = m_logManager->getThrottle(sourceName);
+                context = contextForSource(sourceName);
+            }
+            float value = m_ingestValues.value(i);
+            SmartDataHub::NumberStatus status = sampleValue(sample.data, m_ingestValues.status(i), value);
+            if (auto msg = buildSample(sourceName, context, throttle.get(), value, status)) {
+                messages.push_back(std::move(*msg));
+            }
+        }
+
+        if (!messages.empty() && m_logManager->logBatch(messages) < messages.size()) {
+            std::cerr << "[TelemetryApp] Failed to log ingest batch" << std::endl;
+        }
     }
 
     void TelemetryApp::stop()
@@ -188,16 +981,52 @@ namespace facade
         m_running = false;
 
         // Wait for all source threads to finish
+        std::vector<std::pair<std::string, SmartDataHub::TimerStats>> samplerStats;
+        std::unique_lock<std::mutex> samplersLock(m_samplersMutex); // source threads may still be in addSampler()
+        if (m_timerWheel) {
+            m_timerWheel->stop();
+            for (const auto& [name, id] : m_sampleTimers) {
+                samplerStats.emplace_back(name, m_timerWheel->getStats(id));
+            }
+            m_sampleTimers.clear();
+            m_samplerPool.reset(); // runs what was already handed out
+        }
+        samplersLock.unlock();
+        if (m_ingestServer) {
+            auto stats = m_ingestServer->getStats();
+            m_ingestServer->stop();
+            m_ingestServer.reset();
+            std::cout << "[TelemetryApp] Ingest accepted " << stats.accepted << " connections ("
+                      << stats.rejected << " rejected), " << stats.samples << " samples" << std::endl;
+        }
+        if (m_reactor) {
+            m_reactor->stop();
+            m_reactor.reset();
+        }
         for (auto& thread : m_sourceThreads) {
             if (thread.joinable()) {
                 thread.join();
             }
         }
         m_sourceThreads.clear();
+        m_timerWheel.reset();
+        m_replayTraces.clear();
 
         // Stop AsyncLogManager
         m_logManager->stop();
 
+        for (const auto& [name, counters] : m_logManager->getThrottleCounters()) {
+            std::cout << "[TelemetryApp] Source '" << name << "' admitted " << counters.admitted
+                      << ", rate-limited " << counters.rateLimited
+                      << ", sampled out " << counters.sampledOut << std::endl;
+        }
+        for (const auto& [name, stats] : samplerStats) {
+            std::cout << "[TelemetryApp] Source '" << name << "' sampled " << stats.fires
+                      << " times, lateness mean " << static_cast<uint64_t>(stats.meanLatenessUs)
+                      << "us p99 " << stats.p99LatenessUs << "us max " << stats.maxLatenessUs
+                      << "us, missed " << stats.missed << ", overruns " << stats.overruns << std::endl;
+        }
+
         std::cout << "[TelemetryApp] Stopped" << std::endl;
     }
 
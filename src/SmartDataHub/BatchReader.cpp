@@ -0,0 +1,162 @@
+#include "BatchReader.hpp"
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+namespace SmartDataHub
+{
+
+    BatchReader::BatchReader(bool useIoUring, unsigned queueDepth)
+    {
+        if (useIoUring && !m_ring.init(queueDepth))
+        {
+            std::cerr << "[BatchReader] io_uring unavailable, using plain reads" << std::endl;
+        }
+    }
+
+    void BatchReader::readAll(const std::vector<ITelemetrySource *> &sources, const SampleHandler &onSample)
+    {
+        m_fallback.clear();
+        for (std::size_t i = 0; i < sources.size(); ++i)
+        {
+            ReadRequest request;
+            if (!m_ring.isReady() || !sources[i]->prepareRead(request))
+            {
+                m_fallback.push_back(i);
+                continue;
+            }
+
+            unsigned length = static_cast<unsigned>(request.length);
+            bool queued = request.isSocket
+                              ? m_ring.prepareRecv(request.fd, request.buffer, length, i)
+                              : m_ring.prepareRead(request.fd, request.buffer, length, request.offset, i);
+            if (!queued)
+            {
+                // Queue full: complete what is there and start over
+                flush(sources, onSample);
+                queued = request.isSocket
+                             ? m_ring.prepareRecv(request.fd, request.buffer, length, i)
+                             : m_ring.prepareRead(request.fd, request.buffer, length, request.offset, i);
+            }
+            if (queued)
+            {
+                m_queued.push_back(i);
+            }
+            else
+            {
+                m_fallback.push_back(i);
+            }
+        }
+        flush(sources, onSample);
+
+        for (std::size_t index : m_fallback)
+        {
+            ++m_plainReads;
+            if (sources[index]->readSource(m_sample))
+            {
+                onSample(index, m_sample);
+            }
+        }
+    }
+
+    void BatchReader::flush(const std::vector<ITelemetrySource *> &sources, const SampleHandler &onSample)
+    {
+        if (m_queued.empty())
+        {
+            return;
+        }
+
+        // Local files and ready sockets complete inline, so this is
+        // normally a single io_uring_enter() for the whole batch
+        std::size_t reaped = 0;
+        bool submitted = false;
+        while (reaped < m_queued.size())
+        {
+            int result = m_ring.submitAndWait(static_cast<unsigned>(m_queued.size() - reaped));
+            ++m_submissions;
+            if (result < 0 && !submitted)
+            {
+                // Nothing reached the kernel: read these the plain way and
+                // stop using the ring, since its queue is now unusable
+                std::cerr << "[BatchReader] io_uring_enter failed (" << -result
+                          << "), using plain reads" << std::endl;
+                m_ring.close();
+                m_fallback.insert(m_fallback.end(), m_queued.begin(), m_queued.end());
+                m_queued.clear();
+                return;
+            }
+            submitted = true;
+
+            IoCompletion completion;
+            while (m_ring.popCompletion(completion))
+            {
+                ++reaped;
+                std::size_t index = static_cast<std::size_t>(completion.userData);
+                if (completion.result < 0 && completion.result != -EAGAIN)
+                {
+                    // The ring could not do this read (e.g. a kernel
+                    // without the opcode): readSource() takes it instead
+                    failedRead(-completion.result);
+                    m_fallback.push_back(index);
+                    continue;
+                }
+                ++m_batchedReads;
+                if (sources[index]->completeRead(completion.result, m_sample))
+                {
+                    onSample(index, m_sample);
+                }
+            }
+            if (result < 0)
+            {
+                // Waiting failed after submission: closing the ring cancels
+                // what is left, those sources just miss this round
+                std::cerr << "[BatchReader] io_uring_enter failed (" << -result
+                          << "), using plain reads" << std::endl;
+                m_ring.close();
+                break;
+            }
+        }
+        m_queued.clear();
+
+        if (m_opcodeUnsupported)
+        {
+            m_ring.close();
+        }
+    }
+
+    void BatchReader::failedRead(int error)
+    {
+        if (error == EINVAL || error == EOPNOTSUPP)
+        {
+            // Every later submission would fail the same way
+            m_opcodeUnsupported = true;
+        }
+        if (!m_readFailureLogged)
+        {
+            m_readFailureLogged = true;
+            std::cerr << "[BatchReader] io_uring read failed (" << std::strerror(error)
+                      << "), reading the plain way" << std::endl;
+        }
+    }
+
+    bool BatchReader::usesIoUring() const
+    {
+        return m_ring.isReady();
+    }
+
+    uint64_t BatchReader::getSubmissions() const
+    {
+        return m_submissions;
+    }
+
+    uint64_t BatchReader::getBatchedReads() const
+    {
+        return m_batchedReads;
+    }
+
+    uint64_t BatchReader::getPlainReads() const
+    {
+        return m_plainReads;
+    }
+
+} // namespace SmartDataHub
@@ -0,0 +1,379 @@
+#include "CgroupCollectors.hpp"
+#include "ProcScan.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace SmartDataHub
+{
+    namespace
+    {
+        // Reads "<key> <value>" lines into values[] by position of the key
+        // in `keys`; returns the bit mask of the keys found
+        template <size_t N>
+        unsigned scanKeyedLines(std::string_view content, const std::string_view (&keys)[N], uint64_t *values)
+        {
+            unsigned found = 0;
+            size_t from = 0;
+            std::string_view line;
+            while (nextLine(content, from, line))
+            {
+                size_t space = line.find(' ');
+                if (space == std::string_view::npos)
+                {
+                    continue;
+                }
+                std::string_view key = line.substr(0, space);
+                for (size_t i = 0; i < N; ++i)
+                {
+                    if (key == keys[i])
+                    {
+                        const char *pos = line.data() + space;
+                        if (scanUnsigned(pos, line.data() + line.size(), values[i]))
+                        {
+                            found |= 1u << i;
+                        }
+                        break;
+                    }
+                }
+            }
+            return found;
+        }
+
+        bool isOctalDigit(char c)
+        {
+            return c >= '0' && c <= '7';
+        }
+
+        // mountinfo escapes blanks and backslashes in paths as \ooo; any
+        // other backslash is copied through as it is
+        std::string unescapeMountPath(std::string_view text)
+        {
+            std::string path;
+            path.reserve(text.size());
+            for (size_t i = 0; i < text.size(); ++i)
+            {
+                if (text[i] == '\\' && i + 3 < text.size() && text[i + 1] >= '0' && text[i + 1] <= '3' &&
+                    isOctalDigit(text[i + 2]) && isOctalDigit(text[i + 3]))
+                {
+                    path.push_back(static_cast<char>(((text[i + 1] - '0') << 6) | ((text[i + 2] - '0') << 3) |
+                                                     (text[i + 3] - '0')));
+                    i += 3;
+                    continue;
+                }
+                path.push_back(text[i]);
+            }
+            return path;
+        }
+
+        std::string readWholeFile(const char *path)
+        {
+            std::ifstream file(path);
+            return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+    } // namespace
+
+    // ══════════════════════════════════════════════════════════════════════
+    // Cgroup Discovery
+    // ══════════════════════════════════════════════════════════════════════
+
+    bool resolveCgroupDir(std::string_view procCgroup, std::string_view mountInfo, std::string &dir)
+    {
+        // The unified hierarchy is the "0::/system.slice/app.service" line;
+        // v1 controllers have their own "<id>:<controllers>:<path>" lines
+        std::string_view cgroupPath;
+        size_t from = 0;
+        std::string_view line;
+        bool unified = false;
+        while (nextLine(procCgroup, from, line))
+        {
+            if (line.compare(0, 3, "0::") == 0)
+            {
+                cgroupPath = line.substr(3);
+                unified = true;
+                break;
+            }
+        }
+        if (!unified)
+        {
+            return false;
+        }
+
+        // "36 25 0:30 / /sys/fs/cgroup rw,nosuid - cgroup2 cgroup2 rw": root
+        // (4th) and mount point (5th), then the fstype after " - "
+        from = 0;
+        while (nextLine(mountInfo, from, line))
+        {
+            size_t separator = line.find(" - ");
+            if (separator == std::string_view::npos || line.compare(separator + 3, 8, "cgroup2 ") != 0)
+            {
+                continue;
+            }
+
+            std::string_view fields[5];
+            size_t count = 0;
+            size_t at = 0;
+            while (count < 5 && at < separator)
+            {
+                size_t next = std::min(line.find(' ', at), separator);
+                fields[count++] = line.substr(at, next - at);
+                at = next + 1;
+            }
+            if (count < 5)
+            {
+                continue;
+            }
+            std::string root = unescapeMountPath(fields[3]);
+            dir = unescapeMountPath(fields[4]);
+
+            // A mount of a sub-tree (no cgroup namespace) shows paths from
+            // the hierarchy root: strip the part above the mount
+            std::string_view relative = cgroupPath;
+            if (root != "/" && relative.compare(0, root.size(), root) == 0 &&
+                (relative.size() == root.size() || relative[root.size()] == '/'))
+            {
+                relative.remove_prefix(root.size());
+            }
+            else if (root != "/")
+            {
+                relative = {}; // outside the mount: the mount is the best we see
+            }
+            if (!relative.empty() && relative != "/")
+            {
+                if (!dir.empty() && dir.back() == '/')
+                {
+                    dir.pop_back();
+                }
+                dir.append(relative.data(), relative.size());
+            }
+            return true;
+        }
+        return false;
+    }
+
+    std::string discoverCgroupDir()
+    {
+        std::string dir;
+        if (!resolveCgroupDir(readWholeFile("/proc/self/cgroup"), readWholeFile("/proc/self/mountinfo"), dir))
+        {
+            return {};
+        }
+        return dir;
+    }
+
+    // ══════════════════════════════════════════════════════════════════════
+    // CgroupCpuStatCollector
+    // ══════════════════════════════════════════════════════════════════════
+
+    CgroupCpuStatCollector::CgroupCpuStatCollector(std::string path) : ProcCollector(std::move(path))
+    {
+    }
+
+    bool CgroupCpuStatCollector::parse(std::string_view content, double elapsedSec, std::vector<Metric> &metrics)
+    {
+        // "usage_usec 4384461974\nuser_usec 4011338775\n...nr_periods 120\n"
+        static constexpr std::string_view Keys[FieldCount] = {"usage_usec", "user_usec",    "system_usec",
+                                                              "nr_periods", "nr_throttled", "throttled_usec"};
+        uint64_t values[FieldCount] = {};
+        unsigned found = scanKeyedLines(content, Keys, values);
+        if ((found & (1u << UsageUsec)) == 0)
+        {
+            return false;
+        }
+
+        if (elapsedSec > 0.0)
+        {
+            const auto have = [&](Field field) { return (found & m_previousFound & (1u << field)) != 0; };
+            const auto cpuPercent = [&](Field field) {
+                return perSecond(values[field], m_previous[field], elapsedSec) / 1e4; // µs per s / 1e4
+            };
+
+            metrics.push_back({"usage", cpuPercent(UsageUsec), "%cpu"});
+            if (have(UserUsec))
+            {
+                metrics.push_back({"user", cpuPercent(UserUsec), "%cpu"});
+            }
+            if (have(SystemUsec))
+            {
+                metrics.push_back({"system", cpuPercent(SystemUsec), "%cpu"});
+            }
+            if (have(NrPeriods) && have(NrThrottled))
+            {
+                uint64_t periods = values[NrPeriods] >= m_previous[NrPeriods] ? values[NrPeriods] - m_previous[NrPeriods] : 0;
+                uint64_t throttled =
+                    values[NrThrottled] >= m_previous[NrThrottled] ? values[NrThrottled] - m_previous[NrThrottled] : 0;
+                double share = periods > 0 ? 100.0 * static_cast<double>(throttled) / static_cast<double>(periods) : 0.0;
+                metrics.push_back({"throttled", std::min(share, 100.0), {}});
+            }
+            if (have(ThrottledUsec))
+            {
+                metrics.push_back(
+                    {"throttled_ms", perSecond(values[ThrottledUsec], m_previous[ThrottledUsec], elapsedSec) / 1000.0,
+                     "ms/s"});
+            }
+        }
+
+        std::copy(values, values + FieldCount, m_previous);
+        m_previousFound = found;
+        return true;
+    }
+
+    // ══════════════════════════════════════════════════════════════════════
+    // CgroupMemoryCollector
+    // ══════════════════════════════════════════════════════════════════════
+
+    CgroupMemoryCollector::CgroupMemoryCollector(std::string path) : ProcCollector(std::move(path))
+    {
+    }
+
+    bool CgroupMemoryCollector::parse(std::string_view content, double /*elapsedSec*/, std::vector<Metric> &metrics)
+    {
+        // "1323491328\n" (bytes)
+        const char *pos = content.data();
+        uint64_t bytes = 0;
+        if (!scanUnsigned(pos, pos + content.size(), bytes))
+        {
+            return false;
+        }
+        metrics.push_back({"current", static_cast<double>(bytes) / 1024.0, "kB"});
+        return true;
+    }
+
+    // ══════════════════════════════════════════════════════════════════════
+    // CgroupMemoryStatCollector
+    // ══════════════════════════════════════════════════════════════════════
+
+    CgroupMemoryStatCollector::CgroupMemoryStatCollector(std::string path) : ProcCollector(std::move(path))
+    {
+    }
+
+    bool CgroupMemoryStatCollector::parse(std::string_view content, double elapsedSec, std::vector<Metric> &metrics)
+    {
+        // "anon 1048576\nfile 4096\n...pgfault 3310\npgmajfault 2\n..."
+        static constexpr std::string_view Keys[FieldCount] = {"anon",       "file",           "kernel",
+                                                              "shmem",      "file_dirty",     "file_writeback",
+                                                              "slab",       "pgfault",        "pgmajfault"};
+        uint64_t values[FieldCount] = {};
+        unsigned found = scanKeyedLines(content, Keys, values);
+        if (found == 0)
+        {
+            return false;
+        }
+
+        // Sizes are in bytes
+        for (int field = Anon; field <= Slab; ++field)
+        {
+            if (found & (1u << field))
+            {
+                metrics.push_back({Keys[field], static_cast<double>(values[field]) / 1024.0, "kB"});
+            }
+        }
+        if (elapsedSec > 0.0)
+        {
+            for (int field = PgFault; field <= PgMajFault; ++field)
+            {
+                if (found & m_previousFound & (1u << field))
+                {
+                    metrics.push_back({Keys[field], perSecond(values[field], m_previous[field], elapsedSec), "/s"});
+                }
+            }
+        }
+
+        std::copy(values, values + FieldCount, m_previous);
+        m_previousFound = found;
+        return true;
+    }
+
+    // ══════════════════════════════════════════════════════════════════════
+    // CgroupIoStatCollector
+    // ══════════════════════════════════════════════════════════════════════
+
+    namespace
+    {
+        enum IoCounter
+        {
+            IoReadBytes,  // rbytes=
+            IoWriteBytes, // wbytes=
+            IoReads,      // rios=
+            IoWrites,     // wios=
+            IoCounterCount
+        };
+    } // namespace
+
+    CgroupIoStatCollector::CgroupIoStatCollector(std::string path)
+        : ProcCollector(std::move(path)),
+          m_devices(IoCounterCount, {"read_kBps", "write_kBps", "read_iops", "write_iops"})
+    {
+    }
+
+    bool CgroupIoStatCollector::parse(std::string_view content, double elapsedSec, std::vector<Metric> &metrics)
+    {
+        // "8:0 rbytes=1459200 wbytes=314773504 rios=192 wios=353 dbytes=0 dios=0"
+        // A device the cgroup never touched has no line
+        m_devices.begin();
+        size_t from = 0;
+        std::string_view line;
+        while (nextLine(content, from, line))
+        {
+            size_t space = line.find(' ');
+            std::string_view name = line.substr(0, space);
+            if (space == std::string_view::npos || name.find(':') == std::string_view::npos || !accepts(name))
+            {
+                continue;
+            }
+
+            uint64_t values[IoCounterCount] = {};
+            const char *pos = line.data() + space + 1;
+            const char *end = line.data() + line.size();
+            while (pos < end)
+            {
+                const char *equals = static_cast<const char *>(std::memchr(pos, '=', static_cast<size_t>(end - pos)));
+                if (equals == nullptr)
+                {
+                    break;
+                }
+                std::string_view key(pos, static_cast<size_t>(equals - pos));
+                pos = equals + 1;
+                int slot = key == "rbytes" ? IoReadBytes
+                           : key == "wbytes" ? IoWriteBytes
+                           : key == "rios"   ? IoReads
+                           : key == "wios"   ? IoWrites
+                                             : -1;
+                uint64_t value = 0;
+                if (!scanUnsigned(pos, end, value))
+                {
+                    break;
+                }
+                if (slot >= 0)
+                {
+                    values[slot] = value;
+                }
+                while (pos < end && *pos == ' ')
+                {
+                    ++pos;
+                }
+            }
+            std::copy(values, values + IoCounterCount, m_devices.add(name));
+        }
+
+        if (!m_devices.end() || elapsedSec <= 0.0)
+        {
+            return true; // baseline only
+        }
+        for (size_t i = 0; i < m_devices.size(); ++i)
+        {
+            const uint64_t *now = m_devices.current(i);
+            const uint64_t *before = m_devices.previous(i);
+            metrics.push_back({m_devices.metricName(i, 0),
+                               perSecond(now[IoReadBytes], before[IoReadBytes], elapsedSec) / 1024.0, "kB/s"});
+            metrics.push_back({m_devices.metricName(i, 1),
+                               perSecond(now[IoWriteBytes], before[IoWriteBytes], elapsedSec) / 1024.0, "kB/s"});
+            metrics.push_back({m_devices.metricName(i, 2), perSecond(now[IoReads], before[IoReads], elapsedSec), "IOPS"});
+            metrics.push_back(
+                {m_devices.metricName(i, 3), perSecond(now[IoWrites], before[IoWrites], elapsedSec), "IOPS"});
+        }
+        return true;
+    }
+
+} // namespace SmartDataHub
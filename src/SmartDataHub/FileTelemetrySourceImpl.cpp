@@ -1,4 +1,9 @@
 #include "FileTelemetrySourceImpl.hpp"
+#include <linux/magic.h> // PROC_SUPER_MAGIC, SYSFS_MAGIC
+#include <sys/vfs.h>     // fstatfs()
+#include <chrono>
+#include <cstring>
+#include <thread>
 
 namespace SmartDataHub
 {
@@ -9,20 +14,225 @@ namespace SmartDataHub
 
     bool FileTelemetrySourceImpl::openSource()
     {
-        return m_file.openFile(m_filepath.c_str(), O_RDONLY);
+        m_lastSize = -1;
+        m_pseudoFile = false;
+        if (!m_file.openFile(m_filepath.c_str(), O_RDONLY))
+        {
+            return false;
+        }
+
+        struct statfs fs;
+        if (fstatfs(m_file.getFd(), &fs) == 0)
+        {
+            m_pseudoFile = fs.f_type == PROC_SUPER_MAGIC || fs.f_type == SYSFS_MAGIC;
+        }
+        return true;
+    }
+
+    bool FileTelemetrySourceImpl::isNewerThanLastRead(const struct stat &info) const
+    {
+        return m_lastSize < 0 ||
+               info.st_size != m_lastSize ||
+               info.st_mtim.tv_sec != m_lastModified.tv_sec ||
+               info.st_mtim.tv_nsec != m_lastModified.tv_nsec;
+    }
+
+    bool FileTelemetrySourceImpl::hasUnreadChange() const
+    {
+        struct stat info;
+        return fstat(m_file.getFd(), &info) != 0 || isNewerThanLastRead(info);
+    }
+
+    void FileTelemetrySourceImpl::rewindIfRewritten()
+    {
+        struct stat info;
+        if (fstat(m_file.getFd(), &info) != 0)
+        {
+            return;
+        }
+
+        // procfs/sysfs report size 0 and never change mtime: every read is
+        // a fresh sample, so always start from the first line
+        if (info.st_size == 0 || (m_lastSize >= 0 && isNewerThanLastRead(info)))
+        {
+            m_file.seekToBeginning();
+        }
+        m_lastModified = info.st_mtim;
+        m_lastSize = info.st_size;
     }
 
     bool FileTelemetrySourceImpl::readSource(std::string &out)
+    {
+        std::string_view line;
+        if (!readSource(line))
+        {
+            return false;
+        }
+        out.assign(line.data(), line.size());
+        return true;
+    }
+
+    bool FileTelemetrySourceImpl::readSource(std::string_view &out)
     {
         if (!m_file.isOpen())
         {
             return false;
         }
 
-        // Reset file position to beginning before reading
+        rewindIfRewritten();
+        if (m_file.readline(out))
+        {
+            return true;
+        }
+
+        // Past the last record: start over from the top so a file that is
+        // rewritten in place keeps producing its latest contents
         m_file.seekToBeginning();
+        return m_file.readline(out);
+    }
 
+    bool FileTelemetrySourceImpl::readLine(std::string_view &out)
+    {
+        if (!m_file.isOpen())
+        {
+            return false;
+        }
         return m_file.readline(out);
     }
 
-}
\ No newline at end of file
+    void FileTelemetrySourceImpl::rewind()
+    {
+        m_file.seekToBeginning();
+    }
+
+    bool FileTelemetrySourceImpl::readSnapshot(std::string_view &content)
+    {
+        if (!m_file.isOpen())
+        {
+            return false;
+        }
+        return m_file.readSnapshot(content);
+    }
+
+    bool FileTelemetrySourceImpl::isOpen() const
+    {
+        return m_file.isOpen();
+    }
+
+    bool FileTelemetrySourceImpl::enableWatch()
+    {
+        return m_watch.watch(m_filepath);
+    }
+
+    bool FileTelemetrySourceImpl::isWatching() const
+    {
+        return m_watch.isWatching();
+    }
+
+    bool FileTelemetrySourceImpl::waitForData(int timeoutMs)
+    {
+        if (!m_watch.isWatching())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs < 0 ? 0 : timeoutMs));
+            return true;
+        }
+
+        using Clock = std::chrono::steady_clock;
+        const auto deadline = Clock::now() + std::chrono::milliseconds(timeoutMs);
+
+        while (true)
+        {
+            int remainingMs = -1;
+            if (timeoutMs >= 0)
+            {
+                auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now());
+                remainingMs = left.count() > 0 ? static_cast<int>(left.count()) : 0;
+            }
+
+            switch (m_watch.wait(remainingMs))
+            {
+            case FileWatch::Event::Modified:
+                // A single write raises IN_MODIFY and then IN_CLOSE_WRITE;
+                // only report content the last read has not seen yet
+                if (hasUnreadChange())
+                {
+                    return true;
+                }
+                break;
+            case FileWatch::Event::Replaced:
+                // The fd still points at the old inode
+                return openSource();
+            case FileWatch::Event::None:
+            default:
+                return false;
+            }
+
+            if (remainingMs == 0)
+            {
+                return false;
+            }
+        }
+    }
+
+    int FileTelemetrySourceImpl::getPollFd() const
+    {
+        return m_watch.getFd();
+    }
+
+    bool FileTelemetrySourceImpl::acknowledgeReady()
+    {
+        // Drains the pending events without blocking
+        return waitForData(0);
+    }
+
+    bool FileTelemetrySourceImpl::prepareRead(ReadRequest &request)
+    {
+        // Regular files keep their line-by-line position: not batchable
+        if (!m_pseudoFile || !m_file.isOpen() || m_watch.isWatching())
+        {
+            return false;
+        }
+        if (m_sampleBuf.empty())
+        {
+            m_sampleBuf.resize(4096);
+        }
+        request.fd = m_file.getFd();
+        request.buffer = m_sampleBuf.data();
+        request.length = m_sampleBuf.size();
+        request.offset = 0;
+        request.isSocket = false;
+        return true;
+    }
+
+    bool FileTelemetrySourceImpl::completeRead(int result, std::string &out)
+    {
+        if (result < 0)
+        {
+            // The batched read failed: the plain read still gets the sample
+            return readSource(out);
+        }
+        if (result == 0)
+        {
+            return false;
+        }
+
+        size_t bytes = static_cast<size_t>(result);
+        const char *newline = static_cast<const char *>(std::memchr(m_sampleBuf.data(), '\n', bytes));
+        if (newline != nullptr)
+        {
+            out.assign(m_sampleBuf.data(), static_cast<size_t>(newline - m_sampleBuf.data()));
+            return true;
+        }
+        if (bytes < m_sampleBuf.size())
+        {
+            out.assign(m_sampleBuf.data(), bytes); // no trailing newline
+            return true;
+        }
+
+        // First line longer than the buffer: read this one the plain way
+        // and offer a bigger buffer next time
+        m_sampleBuf.resize(m_sampleBuf.size() * 2);
+        return readSource(out);
+    }
+
+}
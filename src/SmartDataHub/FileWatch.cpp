@@ -0,0 +1,192 @@
+#include "FileWatch.hpp"
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <thread>
+#include <iostream>
+
+namespace SmartDataHub
+{
+    // IN_ATTRIB catches unlink/rename-over while someone (e.g. our reader)
+    // still holds the old inode open, which delays IN_DELETE_SELF
+    constexpr uint32_t WatchMask = IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF;
+
+    // Rule of 5
+    FileWatch::FileWatch(FileWatch &&other) noexcept
+        : inotifyFd{other.inotifyFd}, watchFd{other.watchFd}, watchedPath{std::move(other.watchedPath)},
+          watchedInode{other.watchedInode}, watchedDevice{other.watchedDevice}
+    {
+        other.inotifyFd = -1;
+        other.watchFd = -1;
+    }
+    FileWatch &FileWatch::operator=(FileWatch &&other) noexcept
+    {
+        if (this != &other)
+        {
+            closeWatch();
+            this->inotifyFd = other.inotifyFd;
+            this->watchFd = other.watchFd;
+            this->watchedPath = std::move(other.watchedPath);
+            this->watchedInode = other.watchedInode;
+            this->watchedDevice = other.watchedDevice;
+            other.inotifyFd = -1;
+            other.watchFd = -1;
+        }
+        return *this;
+    }
+    FileWatch::~FileWatch()
+    {
+        closeWatch();
+    }
+
+    // Operations
+    bool FileWatch::watch(const std::string &path)
+    {
+        closeWatch();
+
+        inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (inotifyFd < 0)
+        {
+            std::cerr << "ERROR: Cannot create inotify instance\n";
+            return false;
+        }
+        watchedPath = path;
+        if (!addWatch())
+        {
+            std::cerr << "ERROR: Cannot watch " << path << "\n";
+            closeWatch();
+            return false;
+        }
+        return true;
+    }
+
+    bool FileWatch::addWatch()
+    {
+        watchFd = inotify_add_watch(inotifyFd, watchedPath.c_str(), WatchMask);
+        if (watchFd < 0)
+        {
+            return false;
+        }
+
+        struct stat info;
+        if (stat(watchedPath.c_str(), &info) == 0)
+        {
+            watchedInode = info.st_ino;
+            watchedDevice = info.st_dev;
+        }
+        return true;
+    }
+
+    bool FileWatch::pathStillWatched() const
+    {
+        struct stat info;
+        return stat(watchedPath.c_str(), &info) == 0 &&
+               info.st_ino == watchedInode && info.st_dev == watchedDevice;
+    }
+
+    FileWatch::Event FileWatch::drainEvents()
+    {
+        // Aligned as the kernel expects; holds many small events per read
+        alignas(struct inotify_event) char buffer[4096];
+        Event result = Event::None;
+
+        while (true)
+        {
+            ssize_t NoOfBytes = read(inotifyFd, buffer, sizeof(buffer));
+            if (NoOfBytes <= 0)
+            {
+                break; // EAGAIN: queue drained
+            }
+
+            for (char *ptr = buffer; ptr < buffer + NoOfBytes;)
+            {
+                const auto *event = reinterpret_cast<const struct inotify_event *>(ptr);
+                ptr += sizeof(struct inotify_event) + event->len;
+                if (event->wd != watchFd)
+                {
+                    continue; // leftovers of a watch we already dropped
+                }
+
+                if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED))
+                {
+                    result = Event::Replaced;
+                }
+                else if ((event->mask & IN_ATTRIB) && !pathStillWatched())
+                {
+                    result = Event::Replaced;
+                }
+                else if (result == Event::None && (event->mask & (IN_MODIFY | IN_CLOSE_WRITE)))
+                {
+                    result = Event::Modified;
+                }
+            }
+        }
+
+        if (result == Event::Replaced)
+        {
+            // Old inode is gone; follow the path if it already exists again
+            if (watchFd >= 0)
+            {
+                inotify_rm_watch(inotifyFd, watchFd);
+            }
+            watchFd = -1;
+            addWatch();
+        }
+        return result;
+    }
+
+    FileWatch::Event FileWatch::wait(int timeoutMs)
+    {
+        if (inotifyFd < 0)
+        {
+            return Event::None;
+        }
+
+        // Path vanished earlier: keep trying to re-arm
+        if (watchFd < 0)
+        {
+            if (addWatch())
+            {
+                return Event::Replaced;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs < 0 ? 100 : timeoutMs));
+            return addWatch() ? Event::Replaced : Event::None;
+        }
+
+        pollfd pfd{inotifyFd, POLLIN, 0};
+        int ready;
+        do
+        {
+            ready = poll(&pfd, 1, timeoutMs);
+        } while (ready < 0 && errno == EINTR);
+
+        if (ready <= 0)
+        {
+            return Event::None;
+        }
+        return drainEvents();
+    }
+
+    void FileWatch::closeWatch()
+    {
+        if (inotifyFd >= 0)
+        {
+            close(inotifyFd); // also drops the watch
+            inotifyFd = -1;
+        }
+        watchFd = -1;
+    }
+
+    // Utilities
+    bool FileWatch::isWatching() const
+    {
+        return inotifyFd >= 0;
+    }
+
+    int FileWatch::getFd() const
+    {
+        return inotifyFd;
+    }
+
+} // namespace SmartDataHub
@@ -0,0 +1,208 @@
+#include "FrameParser.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace SmartDataHub
+{
+    constexpr size_t MinimumBufferSize = 4096;
+
+    FrameParser::FrameParser(FramingMode framing, size_t maxFrame)
+        : mode{framing}, maxFrameSize{std::max<size_t>(maxFrame, 1)}
+    {
+    }
+
+    char *FrameParser::prepareWrite(size_t minSpace)
+    {
+        if (buffer.size() - writePos < minSpace)
+        {
+            // Move the unparsed tail to the front before growing
+            if (readPos > 0)
+            {
+                std::memmove(buffer.data(), buffer.data() + readPos, writePos - readPos);
+                writePos -= readPos;
+                scanPos -= readPos;
+                readPos = 0;
+            }
+            if (buffer.size() - writePos < minSpace)
+            {
+                buffer.resize(std::max(writePos + minSpace, std::max(buffer.size() * 2, MinimumBufferSize)));
+            }
+        }
+        return buffer.data() + writePos;
+    }
+
+    size_t FrameParser::writableSize() const
+    {
+        return buffer.size() - writePos;
+    }
+
+    void FrameParser::commit(size_t bytes)
+    {
+        writePos = std::min(writePos + bytes, buffer.size());
+    }
+
+    bool FrameParser::nextFrame(std::string_view &frame)
+    {
+        if (corrupt)
+        {
+            return false;
+        }
+
+        switch (mode)
+        {
+        case FramingMode::Raw:
+        {
+            if (readPos == writePos)
+            {
+                return false;
+            }
+            frame = std::string_view(buffer.data() + readPos, writePos - readPos);
+            readPos = scanPos = writePos;
+            return true;
+        }
+
+        case FramingMode::Newline:
+        {
+            while (true)
+            {
+                scanPos = std::max(scanPos, readPos);
+                const void *newline = nullptr;
+                if (scanPos < writePos)
+                {
+                    newline = std::memchr(buffer.data() + scanPos, '\n', writePos - scanPos);
+                }
+                if (newline != nullptr)
+                {
+                    size_t end = static_cast<const char *>(newline) - buffer.data();
+                    if (skipping || end - readPos > maxFrameSize)
+                    {
+                        // (Tail of an) oversized line: drop it and go on
+                        droppedBytes += end + 1 - readPos;
+                        readPos = scanPos = end + 1;
+                        skipping = false;
+                        continue;
+                    }
+                    frame = std::string_view(buffer.data() + readPos, end - readPos);
+                    readPos = scanPos = end + 1;
+                    return true;
+                }
+
+                scanPos = writePos;
+                if (skipping || writePos - readPos > maxFrameSize)
+                {
+                    // No delimiter in sight: discard what we hold and keep
+                    // discarding until the next '\n'
+                    droppedBytes += writePos - readPos;
+                    readPos = writePos;
+                    skipping = true;
+                }
+                return false;
+            }
+        }
+
+        case FramingMode::LengthPrefixed:
+        {
+            if (writePos - readPos < LengthPrefixSize)
+            {
+                return false;
+            }
+            const auto *prefix = reinterpret_cast<const unsigned char *>(buffer.data() + readPos);
+            uint32_t length = (uint32_t(prefix[0]) << 24) | (uint32_t(prefix[1]) << 16) |
+                              (uint32_t(prefix[2]) << 8) | uint32_t(prefix[3]);
+            if (length > maxFrameSize)
+            {
+                corrupt = true;
+                return false;
+            }
+            if (writePos - readPos - LengthPrefixSize < length)
+            {
+                return false;
+            }
+            frame = std::string_view(buffer.data() + readPos + LengthPrefixSize, length);
+            readPos += LengthPrefixSize + length;
+            scanPos = readPos;
+            return true;
+        }
+        }
+        return false;
+    }
+
+    bool FrameParser::hasCompleteFrame() const
+    {
+        if (corrupt || readPos == writePos)
+        {
+            return false;
+        }
+        switch (mode)
+        {
+        case FramingMode::Raw:
+            return true;
+        case FramingMode::Newline:
+        {
+            size_t from = std::max(scanPos, readPos);
+            return from < writePos && std::memchr(buffer.data() + from, '\n', writePos - from) != nullptr;
+        }
+        case FramingMode::LengthPrefixed:
+        {
+            if (writePos - readPos < LengthPrefixSize)
+            {
+                return false;
+            }
+            const auto *prefix = reinterpret_cast<const unsigned char *>(buffer.data() + readPos);
+            uint32_t length = (uint32_t(prefix[0]) << 24) | (uint32_t(prefix[1]) << 16) |
+                              (uint32_t(prefix[2]) << 8) | uint32_t(prefix[3]);
+            // An oversized prefix counts: nextFrame() then flags corruption
+            return length > maxFrameSize || writePos - readPos - LengthPrefixSize >= length;
+        }
+        }
+        return false;
+    }
+
+    void FrameParser::reset()
+    {
+        readPos = writePos = scanPos = 0;
+        corrupt = false;
+        skipping = false;
+    }
+
+    void FrameParser::shrinkIfIdle(size_t keepBytes)
+    {
+        if (readPos == writePos && !skipping && buffer.size() > keepBytes)
+        {
+            std::vector<char>().swap(buffer);
+            readPos = writePos = scanPos = 0;
+        }
+    }
+
+    // Utilities
+    FramingMode FrameParser::getMode() const
+    {
+        return mode;
+    }
+
+    size_t FrameParser::bufferedBytes() const
+    {
+        return writePos - readPos;
+    }
+
+    bool FrameParser::isCorrupt() const
+    {
+        return corrupt;
+    }
+
+    uint64_t FrameParser::getDroppedBytes() const
+    {
+        return droppedBytes;
+    }
+
+    void FrameParser::appendLengthPrefixed(std::vector<char> &out, std::string_view payload)
+    {
+        uint32_t length = static_cast<uint32_t>(payload.size());
+        out.push_back(static_cast<char>((length >> 24) & 0xFF));
+        out.push_back(static_cast<char>((length >> 16) & 0xFF));
+        out.push_back(static_cast<char>((length >> 8) & 0xFF));
+        out.push_back(static_cast<char>(length & 0xFF));
+        out.insert(out.end(), payload.begin(), payload.end());
+    }
+
+} // namespace SmartDataHub
@@ -0,0 +1,234 @@
+#include "IoUring.hpp"
+#include <sys/mman.h>
+#include <sys/socket.h>  // MSG_DONTWAIT
+#include <sys/syscall.h> // __NR_io_uring_setup, __NR_io_uring_enter
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace SmartDataHub
+{
+    namespace
+    {
+        unsigned *ringField(void *ring, uint32_t offset)
+        {
+            return reinterpret_cast<unsigned *>(static_cast<char *>(ring) + offset);
+        }
+    } // namespace
+
+    IoUring::~IoUring()
+    {
+        close();
+    }
+
+    bool IoUring::init(unsigned entries)
+    {
+        close();
+
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        int fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        if (fd < 0)
+        {
+            return false;
+        }
+        m_ringFd = fd;
+
+        m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+        {
+            m_sqRingSize = m_cqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+        }
+
+        m_sqRing = mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        m_ringFd, IORING_OFF_SQ_RING);
+        if (m_sqRing == MAP_FAILED)
+        {
+            m_sqRing = nullptr;
+            close();
+            return false;
+        }
+
+        if (singleMap)
+        {
+            m_cqRing = m_sqRing;
+        }
+        else
+        {
+            m_cqRing = mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                            m_ringFd, IORING_OFF_CQ_RING);
+            if (m_cqRing == MAP_FAILED)
+            {
+                m_cqRing = nullptr;
+                close();
+                return false;
+            }
+        }
+
+        m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void *sqes = mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                          m_ringFd, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED)
+        {
+            close();
+            return false;
+        }
+        m_sqes = static_cast<io_uring_sqe *>(sqes);
+
+        m_sqHead = ringField(m_sqRing, params.sq_off.head);
+        m_sqTail = ringField(m_sqRing, params.sq_off.tail);
+        m_sqMask = ringField(m_sqRing, params.sq_off.ring_mask);
+        m_sqArray = ringField(m_sqRing, params.sq_off.array);
+        m_cqHead = ringField(m_cqRing, params.cq_off.head);
+        m_cqTail = ringField(m_cqRing, params.cq_off.tail);
+        m_cqMask = ringField(m_cqRing, params.cq_off.ring_mask);
+        m_cqes = reinterpret_cast<io_uring_cqe *>(static_cast<char *>(m_cqRing) + params.cq_off.cqes);
+
+        m_entries = params.sq_entries;
+        m_queued = 0;
+        return true;
+    }
+
+    void IoUring::close()
+    {
+        if (m_sqes != nullptr)
+        {
+            munmap(m_sqes, m_sqesSize);
+            m_sqes = nullptr;
+        }
+        if (m_cqRing != nullptr && m_cqRing != m_sqRing)
+        {
+            munmap(m_cqRing, m_cqRingSize);
+        }
+        m_cqRing = nullptr;
+        if (m_sqRing != nullptr)
+        {
+            munmap(m_sqRing, m_sqRingSize);
+            m_sqRing = nullptr;
+        }
+        if (m_ringFd >= 0)
+        {
+            ::close(m_ringFd);
+            m_ringFd = -1;
+        }
+        m_entries = 0;
+        m_queued = 0;
+    }
+
+    bool IoUring::isReady() const
+    {
+        return m_ringFd >= 0;
+    }
+
+    unsigned IoUring::getEntries() const
+    {
+        return m_entries;
+    }
+
+    unsigned IoUring::getQueued() const
+    {
+        return m_queued;
+    }
+
+    io_uring_sqe *IoUring::nextSqe()
+    {
+        if (m_ringFd < 0)
+        {
+            return nullptr;
+        }
+        // Only this thread moves the tail; the kernel moves the head
+        unsigned tail = *m_sqTail;
+        unsigned head = __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE);
+        if (tail - head >= m_entries)
+        {
+            return nullptr;
+        }
+        unsigned index = tail & *m_sqMask;
+        io_uring_sqe *sqe = &m_sqes[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+        m_sqArray[index] = index;
+        return sqe;
+    }
+
+    bool IoUring::prepareRead(int fd, void *buffer, unsigned length, int64_t offset, uint64_t userData)
+    {
+        io_uring_sqe *sqe = nextSqe();
+        if (sqe == nullptr)
+        {
+            return false;
+        }
+        sqe->opcode = IORING_OP_READ;
+        sqe->fd = fd;
+        sqe->addr = reinterpret_cast<uint64_t>(buffer);
+        sqe->len = length;
+        sqe->off = static_cast<uint64_t>(offset);
+        sqe->user_data = userData;
+
+        __atomic_store_n(m_sqTail, *m_sqTail + 1, __ATOMIC_RELEASE);
+        ++m_queued;
+        return true;
+    }
+
+    bool IoUring::prepareRecv(int fd, void *buffer, unsigned length, uint64_t userData)
+    {
+        io_uring_sqe *sqe = nextSqe();
+        if (sqe == nullptr)
+        {
+            return false;
+        }
+        sqe->opcode = IORING_OP_RECV;
+        sqe->fd = fd;
+        sqe->addr = reinterpret_cast<uint64_t>(buffer);
+        sqe->len = length;
+        sqe->msg_flags = MSG_DONTWAIT;
+        sqe->user_data = userData;
+
+        __atomic_store_n(m_sqTail, *m_sqTail + 1, __ATOMIC_RELEASE);
+        ++m_queued;
+        return true;
+    }
+
+    int IoUring::submitAndWait(unsigned waitFor)
+    {
+        if (m_ringFd < 0)
+        {
+            return -EBADF;
+        }
+
+        unsigned flags = waitFor > 0 ? IORING_ENTER_GETEVENTS : 0;
+        long submitted;
+        do
+        {
+            submitted = syscall(__NR_io_uring_enter, m_ringFd, m_queued, waitFor, flags, nullptr, 0);
+        } while (submitted < 0 && errno == EINTR);
+
+        if (submitted < 0)
+        {
+            return -errno;
+        }
+        m_queued -= std::min<unsigned>(m_queued, static_cast<unsigned>(submitted));
+        return static_cast<int>(submitted);
+    }
+
+    bool IoUring::popCompletion(IoCompletion &completion)
+    {
+        if (m_ringFd < 0)
+        {
+            return false;
+        }
+        unsigned head = *m_cqHead;
+        if (head == __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE))
+        {
+            return false;
+        }
+        const io_uring_cqe &cqe = m_cqes[head & *m_cqMask];
+        completion.userData = cqe.user_data;
+        completion.result = cqe.res;
+        __atomic_store_n(m_cqHead, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+} // namespace SmartDataHub
@@ -0,0 +1,119 @@
+#include "MessageBatch.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace SmartDataHub
+{
+    MessageBatch::MessageBatch(size_t capacity, size_t maxMessageSize)
+        : slotSize{std::max<size_t>(maxMessageSize, 1)},
+          storage(std::max<size_t>(capacity, 1) * slotSize),
+          iovecs(std::max<size_t>(capacity, 1)),
+          headers(std::max<size_t>(capacity, 1))
+    {
+        linkSlots();
+    }
+
+    // Headers point into this object's own storage, so copies and moves relink
+    MessageBatch::MessageBatch(const MessageBatch &other)
+        : slotSize{other.slotSize}, storage{other.storage}, iovecs(other.iovecs.size()),
+          headers(other.headers.size()), count{other.count}
+    {
+        linkSlots();
+        for (size_t i = 0; i < count; ++i)
+        {
+            headers[i].msg_len = other.headers[i].msg_len;
+            headers[i].msg_hdr.msg_flags = other.headers[i].msg_hdr.msg_flags;
+        }
+    }
+
+    MessageBatch &MessageBatch::operator=(const MessageBatch &other)
+    {
+        if (this != &other)
+        {
+            MessageBatch copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    // Moving a vector keeps its heap block, so the links stay valid
+    MessageBatch::MessageBatch(MessageBatch &&other) noexcept
+        : slotSize{other.slotSize}, storage{std::move(other.storage)}, iovecs{std::move(other.iovecs)},
+          headers{std::move(other.headers)}, count{other.count}
+    {
+        other.count = 0;
+    }
+
+    MessageBatch &MessageBatch::operator=(MessageBatch &&other) noexcept
+    {
+        if (this != &other)
+        {
+            slotSize = other.slotSize;
+            storage = std::move(other.storage);
+            iovecs = std::move(other.iovecs);
+            headers = std::move(other.headers);
+            count = other.count;
+            other.count = 0;
+        }
+        return *this;
+    }
+
+    void MessageBatch::linkSlots()
+    {
+        for (size_t i = 0; i < headers.size(); ++i)
+        {
+            iovecs[i].iov_base = storage.data() + i * slotSize;
+            iovecs[i].iov_len = slotSize;
+            std::memset(&headers[i], 0, sizeof(mmsghdr));
+            headers[i].msg_hdr.msg_iov = &iovecs[i];
+            headers[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+
+    mmsghdr *MessageBatch::data()
+    {
+        return headers.data();
+    }
+
+    unsigned int MessageBatch::capacity() const
+    {
+        return static_cast<unsigned int>(headers.size());
+    }
+
+    void MessageBatch::setReceived(size_t received)
+    {
+        count = std::min(received, headers.size());
+    }
+
+    size_t MessageBatch::size() const
+    {
+        return count;
+    }
+
+    bool MessageBatch::empty() const
+    {
+        return count == 0;
+    }
+
+    size_t MessageBatch::getSlotSize() const
+    {
+        return slotSize;
+    }
+
+    std::string_view MessageBatch::operator[](size_t index) const
+    {
+        size_t length = std::min<size_t>(headers[index].msg_len, slotSize);
+        return std::string_view(storage.data() + index * slotSize, length);
+    }
+
+    bool MessageBatch::truncated(size_t index) const
+    {
+        return (headers[index].msg_hdr.msg_flags & MSG_TRUNC) != 0;
+    }
+
+    void MessageBatch::clear()
+    {
+        count = 0;
+    }
+
+} // namespace SmartDataHub
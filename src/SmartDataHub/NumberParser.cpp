@@ -0,0 +1,424 @@
+#include "NumberParser.hpp"
+#include "ProcScan.hpp" // detail::swarParseDigits
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace SmartDataHub
+{
+    namespace
+    {
+        constexpr size_t BlockSize = 16;
+
+        // Bit i describes byte i of a 16-byte block. Bytes past the end of
+        // the text count as delimiters, so every run ends inside the masks.
+        struct BlockMasks
+        {
+            uint32_t digits;
+            uint32_t delimiters;
+        };
+
+        inline bool isDelimiter(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == ',' || c == ';';
+        }
+
+        BlockMasks classify(const char *pos, const char *end)
+        {
+#if defined(__SSE2__)
+            if (end - pos >= static_cast<std::ptrdiff_t>(BlockSize))
+            {
+                __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+                // '0'..'9' is an unsigned range check; SSE2 only compares
+                // signed, so move the range to the bottom of it first
+                __m128i offset =
+                    _mm_xor_si128(_mm_sub_epi8(bytes, _mm_set1_epi8('0')), _mm_set1_epi8(static_cast<char>(0x80)));
+                __m128i digits = _mm_cmplt_epi8(offset, _mm_set1_epi8(static_cast<char>(0x80 + 10)));
+                __m128i blank = _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(' ')),
+                                             _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\t')));
+                __m128i lines = _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n')),
+                                             _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\r')));
+                __m128i lists = _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(',')),
+                                             _mm_cmpeq_epi8(bytes, _mm_set1_epi8(';')));
+                __m128i delimiters = _mm_or_si128(blank, _mm_or_si128(lines, lists));
+                return {static_cast<uint32_t>(_mm_movemask_epi8(digits)),
+                        static_cast<uint32_t>(_mm_movemask_epi8(delimiters))};
+            }
+#endif
+            // Short records (a socket frame, one sample) stop at their end
+            size_t available = std::min(static_cast<size_t>(end - pos), BlockSize);
+            BlockMasks masks{0, 0xFFFFu & ~((1u << available) - 1)};
+            for (size_t i = 0; i < available; ++i)
+            {
+                if (isDelimiter(pos[i]))
+                {
+                    masks.delimiters |= 1u << i;
+                }
+                else if (static_cast<unsigned char>(pos[i] - '0') <= 9)
+                {
+                    masks.digits |= 1u << i;
+                }
+            }
+            return masks;
+        }
+
+        // Four blocks classified at once, for parseFloats()
+        constexpr size_t WindowSize = 64;
+
+        struct WindowMasks
+        {
+            uint64_t digits;
+            uint64_t delimiters;
+        };
+
+        WindowMasks classifyWindow(const char *pos, const char *end)
+        {
+            WindowMasks masks{0, ~uint64_t{0}};
+            size_t available = static_cast<size_t>(end - pos);
+            for (size_t i = 0; i < WindowSize && i < available; i += BlockSize)
+            {
+                BlockMasks block = classify(pos + i, end);
+                masks.digits |= static_cast<uint64_t>(block.digits) << i;
+                masks.delimiters &= ~(uint64_t{0xFFFF} << i);
+                masks.delimiters |= static_cast<uint64_t>(block.delimiters) << i;
+            }
+            return masks;
+        }
+
+        // Length of the run of set bits starting at bit `from`
+        inline unsigned runLength(uint32_t mask, unsigned from)
+        {
+            // The bits above the block are clear, so the run ends by bit 16
+            return static_cast<unsigned>(__builtin_ctz(~(mask >> from)));
+        }
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        // Value of the `count` (1..8) digits at `pos`
+        inline uint64_t digitsValue(const char *pos, const char *end, unsigned count)
+        {
+            // Short runs (most percentages and gauges) are cheaper as a
+            // predictable loop than as the multiply chain of the reduction
+            if (count <= 4)
+            {
+                uint64_t value = 0;
+                for (unsigned i = 0; i < count; ++i)
+                {
+                    value = value * 10 + static_cast<unsigned char>(pos[i] - '0');
+                }
+                return value;
+            }
+            // A fixed-size load where the buffer allows: the bytes after
+            // the digits are shifted out by swarParseDigits
+            uint64_t chunk = 0;
+            std::memcpy(&chunk, pos, end - pos >= 8 ? 8 : count);
+            return detail::swarParseDigits(chunk, count);
+        }
+
+        // "[-]d{1,8}[.d{1,8}]" entirely inside the block; false for anything
+        // from_chars has to decide (exponent, long mantissa, "1.", inf/nan)
+        bool scanPlainDecimal(const char *&pos, const char *end, const BlockMasks &masks, float &value)
+        {
+            static constexpr uint64_t Pow10[] = {1,      10,      100,      1000,     10000,
+                                                 100000, 1000000, 10000000, 100000000};
+
+            unsigned at = *pos == '-' ? 1 : 0;
+            unsigned whole = runLength(masks.digits, at);
+            if (whole == 0 || whole > 8)
+            {
+                return false;
+            }
+            uint64_t mantissa = digitsValue(pos + at, end, whole);
+            at += whole;
+
+            unsigned fraction = 0;
+            if (pos + at < end && pos[at] == '.')
+            {
+                fraction = runLength(masks.digits, at + 1);
+                if (fraction == 0 || fraction > 8 || at + 1 + fraction >= BlockSize)
+                {
+                    return false;
+                }
+                mantissa = mantissa * Pow10[fraction] + digitsValue(pos + at + 1, end, fraction);
+                at += 1 + fraction;
+            }
+            if (pos + at < end && (pos[at] == 'e' || pos[at] == 'E'))
+            {
+                return false;
+            }
+
+            // Both operands exact in float: one correctly rounded division,
+            // the same result as from_chars. Longer mantissas (below 2^53)
+            // round once in double and again to float.
+            float result;
+            if (mantissa < (uint64_t{1} << 24))
+            {
+                result = static_cast<float>(mantissa) / static_cast<float>(Pow10[fraction]);
+            }
+            else
+            {
+                result = static_cast<float>(static_cast<double>(mantissa) / static_cast<double>(Pow10[fraction]));
+            }
+            value = *pos == '-' ? -result : result;
+            pos += at;
+            return true;
+        }
+#endif
+
+        NumberStatus scanFloatWithMasks(const char *&pos, const char *end, const BlockMasks &masks, float &value)
+        {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            if (scanPlainDecimal(pos, end, masks, value))
+            {
+                return NumberStatus::Ok;
+            }
+#else
+            (void)masks;
+#endif
+            float parsed = 0.0f;
+            auto converted = std::from_chars(pos, end, parsed);
+            if (converted.ec == std::errc::result_out_of_range)
+            {
+                return NumberStatus::OutOfRange;
+            }
+            if (converted.ec != std::errc())
+            {
+                return NumberStatus::Invalid;
+            }
+            value = parsed;
+            pos = converted.ptr;
+            return NumberStatus::Ok;
+        }
+    } // namespace
+
+    std::string_view toString(NumberStatus status) noexcept
+    {
+        switch (status)
+        {
+        case NumberStatus::Ok:
+            return "ok";
+        case NumberStatus::Invalid:
+            return "not a number";
+        case NumberStatus::OutOfRange:
+            return "number out of range";
+        }
+        return "unknown";
+    }
+
+    NumberStatus scanFloat(const char *&pos, const char *end, float &value) noexcept
+    {
+        if (pos >= end)
+        {
+            return NumberStatus::Invalid;
+        }
+        return scanFloatWithMasks(pos, end, classify(pos, end), value);
+    }
+
+    NumberBatch parseFloats(std::string_view text, float *values, NumberStatus *status, size_t capacity,
+                            size_t *offsets) noexcept
+    {
+        NumberBatch batch;
+        const char *pos = text.data();
+        const char *end = pos + text.size();
+        while (pos < end && batch.count < capacity)
+        {
+            // Every token start and end of the window at once: the tokens
+            // are then parsed independently of each other, not as a chain
+            // of "find the end, then the next start"
+            WindowMasks masks = classifyWindow(pos, end);
+            uint64_t inToken = ~masks.delimiters;
+            uint64_t starts = inToken & ~(inToken << 1);
+            uint64_t lasts = inToken & ~(inToken >> 1); // last byte of each token
+            bool windowHasEnd = end - pos <= static_cast<std::ptrdiff_t>(WindowSize);
+            const char *next = pos + WindowSize;
+
+            while (starts != 0)
+            {
+                unsigned first = static_cast<unsigned>(__builtin_ctzll(starts));
+                unsigned last = static_cast<unsigned>(__builtin_ctzll(lasts >> first)) + first;
+                const char *token = pos + first;
+                const char *tokenEnd = token + (last - first) + 1;
+                if (batch.count == capacity)
+                {
+                    next = token;
+                    break;
+                }
+                if (last == WindowSize - 1 && !windowHasEnd)
+                {
+                    if (first > 0)
+                    {
+                        next = token; // may go on: parse it from the next window
+                        break;
+                    }
+                    // A token longer than the window
+                    while (tokenEnd < end && !isDelimiter(*tokenEnd))
+                    {
+                        ++tokenEnd;
+                    }
+                    next = tokenEnd;
+                }
+
+                // Bits past the window shift in as non-digits, where the
+                // token has ended anyway
+                BlockMasks block{static_cast<uint32_t>(masks.digits >> first) & 0xFFFF,
+                                 static_cast<uint32_t>(masks.delimiters >> first) & 0xFFFF};
+                float value = 0.0f;
+                const char *cursor = token;
+                NumberStatus result = scanFloatWithMasks(cursor, end, block, value);
+                if (result == NumberStatus::Ok && cursor != tokenEnd)
+                {
+                    result = NumberStatus::Invalid; // "12abc"
+                }
+                values[batch.count] = result == NumberStatus::Ok ? value : 0.0f;
+                status[batch.count] = result;
+                if (offsets != nullptr)
+                {
+                    offsets[batch.count] = static_cast<size_t>(token - text.data());
+                }
+                batch.errors += result != NumberStatus::Ok ? 1 : 0;
+                ++batch.count;
+                starts &= starts - 1;
+            }
+            pos = std::min(next, end);
+        }
+        batch.consumed = static_cast<size_t>(pos - text.data());
+        return batch;
+    }
+
+    void RecordValues::clear()
+    {
+        m_text.clear();
+        m_span = {};
+        m_borrowed = false;
+        m_starts.clear();
+    }
+
+    void RecordValues::add(std::string_view record)
+    {
+        if (m_starts.empty() && record.data() != nullptr)
+        {
+            m_span = record;
+            m_borrowed = true;
+            m_starts.push_back(0);
+            return;
+        }
+        if (m_borrowed)
+        {
+            // Next in the same buffer past one delimiter: no copy. That
+            // byte lies between two readable bytes, so it is mapped.
+            const char *spanEnd = m_span.data() + m_span.size();
+            if (record.data() == spanEnd + 1 && isDelimiter(*spanEnd))
+            {
+                m_starts.push_back(m_span.size() + 1);
+                m_span = std::string_view(m_span.data(), m_span.size() + 1 + record.size());
+                return;
+            }
+            m_text.assign(m_span);
+            m_text.push_back('\n');
+            m_borrowed = false;
+        }
+        m_starts.push_back(m_text.size());
+        m_text.append(record);
+        m_text.push_back('\n'); // ends the record's last token
+    }
+
+    void RecordValues::parse()
+    {
+        size_t records = m_starts.size();
+        size_t capacity = std::max<size_t>(records, 1);
+        m_values.resize(capacity);
+        m_status.resize(capacity);
+        m_tokenOffsets.resize(capacity);
+        std::string_view text = m_borrowed ? m_span : std::string_view(m_text);
+
+        // Usual case, one token per record: straight into the results
+        NumberBatch batch = parseFloats(text, m_values.data(), m_status.data(), capacity, m_tokenOffsets.data());
+        m_values.resize(records);
+        m_status.resize(records);
+        bool aligned = batch.count == records;
+        for (size_t i = 0; aligned && i < records; ++i)
+        {
+            aligned = m_tokenOffsets[i] >= m_starts[i] && (i + 1 == records || m_tokenOffsets[i] < m_starts[i + 1]);
+        }
+        if (aligned)
+        {
+            return; // later tokens of the last record do not count
+        }
+
+        // Otherwise walk the records alongside the tokens, which come in
+        // text order
+        m_values.assign(records, 0.0f);
+        m_status.assign(records, NumberStatus::Ok);
+        m_tokenValues.resize(capacity);
+        m_tokenStatus.resize(capacity);
+        size_t record = 0;
+        size_t taken = records; // record that has its value; none yet
+        size_t base = 0;
+        std::string_view rest = text;
+        while (!rest.empty())
+        {
+            batch = parseFloats(rest, m_tokenValues.data(), m_tokenStatus.data(), capacity, m_tokenOffsets.data());
+            for (size_t i = 0; i < batch.count; ++i)
+            {
+                size_t offset = base + m_tokenOffsets[i];
+                while (record + 1 < records && m_starts[record + 1] <= offset)
+                {
+                    ++record;
+                }
+                if (taken != record)
+                {
+                    taken = record;
+                    m_values[record] = m_tokenValues[i];
+                    m_status[record] = m_tokenStatus[i];
+                }
+            }
+            rest.remove_prefix(batch.consumed);
+            base += batch.consumed;
+            if (batch.count < capacity)
+            {
+                break;
+            }
+        }
+    }
+
+    size_t RecordValues::size() const
+    {
+        return m_values.size();
+    }
+
+    float RecordValues::value(size_t record) const
+    {
+        return m_values[record];
+    }
+
+    NumberStatus RecordValues::status(size_t record) const
+    {
+        return m_status[record];
+    }
+
+    NumberStatus RecordValues::parseOne(std::string_view record, float &value) noexcept
+    {
+        const char *pos = record.data();
+        const char *end = pos + record.size();
+        while (pos < end && isDelimiter(*pos))
+        {
+            ++pos;
+        }
+        if (pos == end)
+        {
+            value = 0.0f;
+            return NumberStatus::Ok;
+        }
+        float parsed = 0.0f;
+        NumberStatus status = scanFloat(pos, end, parsed);
+        if (status == NumberStatus::Ok && pos < end && !isDelimiter(*pos))
+        {
+            status = NumberStatus::Invalid; // "12abc"
+        }
+        value = status == NumberStatus::Ok ? parsed : 0.0f;
+        return status;
+    }
+
+} // namespace SmartDataHub
@@ -0,0 +1,103 @@
+#include "ProcCollector.hpp"
+#include <algorithm>
+
+namespace SmartDataHub
+{
+    constexpr size_t InitialSampleBuffer = 4096;
+
+    ProcCollector::ProcCollector(std::string path) : m_path{std::move(path)}
+    {
+    }
+
+    bool ProcCollector::open()
+    {
+        m_sampled = false;
+        return m_file.openFile(m_path.c_str(), O_RDONLY | O_CLOEXEC);
+    }
+
+    bool ProcCollector::isOpen() const
+    {
+        return m_file.isOpen();
+    }
+
+    const std::string &ProcCollector::getPath() const
+    {
+        return m_path;
+    }
+
+    void ProcCollector::setFilter(std::vector<std::string> names)
+    {
+        m_filter = std::move(names);
+    }
+
+    bool ProcCollector::accepts(std::string_view name) const
+    {
+        return m_filter.empty() || std::find(m_filter.begin(), m_filter.end(), name) != m_filter.end();
+    }
+
+    bool ProcCollector::hasFilter() const
+    {
+        return !m_filter.empty();
+    }
+
+    bool ProcCollector::parseSample(std::string_view content, std::vector<Metric> &metrics)
+    {
+        Clock::time_point now = Clock::now();
+        double elapsedSec = m_sampled ? std::chrono::duration<double>(now - m_lastSample).count() : 0.0;
+        if (!parse(content, elapsedSec, metrics))
+        {
+            return false;
+        }
+        m_lastSample = now;
+        m_sampled = true;
+        return true;
+    }
+
+    bool ProcCollector::collect(std::vector<Metric> &metrics)
+    {
+        std::string_view content;
+        if (!m_file.isOpen() || !m_file.readSnapshot(content))
+        {
+            return false;
+        }
+        return parseSample(content, metrics);
+    }
+
+    bool ProcCollector::prepareRead(ReadRequest &request)
+    {
+        if (!m_file.isOpen())
+        {
+            return false;
+        }
+        if (m_buffer.empty())
+        {
+            m_buffer.resize(InitialSampleBuffer);
+        }
+        request.fd = m_file.getFd();
+        request.buffer = m_buffer.data();
+        request.length = m_buffer.size();
+        request.offset = 0;
+        request.isSocket = false;
+        return true;
+    }
+
+    bool ProcCollector::completeRead(int result, std::vector<Metric> &metrics)
+    {
+        if (result < 0)
+        {
+            // The batched read failed: the plain read still gets the sample
+            return collect(metrics);
+        }
+        size_t bytes = static_cast<size_t>(result);
+        if (bytes < m_buffer.size())
+        {
+            return parseSample(std::string_view(m_buffer.data(), bytes), metrics);
+        }
+
+        // Possibly cut short: take this sample the plain way and offer a
+        // bigger buffer next time
+        m_buffer.resize(m_buffer.size() * 2);
+        return collect(metrics);
+    }
+
+} // namespace SmartDataHub
@@ -0,0 +1,360 @@
+#include "ProcCollectors.hpp"
+#include "ProcScan.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace SmartDataHub
+{
+    namespace
+    {
+        std::string_view trimSpaces(std::string_view text)
+        {
+            size_t first = text.find_first_not_of(' ');
+            if (first == std::string_view::npos)
+            {
+                return {};
+            }
+            return text.substr(first, text.find_last_not_of(' ') - first + 1);
+        }
+    } // namespace
+
+    // ══════════════════════════════════════════════════════════════════════
+    // DeviceCounters
+    // ══════════════════════════════════════════════════════════════════════
+
+    DeviceCounters::DeviceCounters(size_t countersPerDevice, std::initializer_list<std::string_view> metricSuffixes)
+        : m_countersPerDevice{countersPerDevice}, m_suffixes(metricSuffixes)
+    {
+    }
+
+    void DeviceCounters::begin()
+    {
+        // The last sample becomes the baseline
+        std::swap(m_current, m_previous);
+        m_count = 0;
+        m_changed = false;
+    }
+
+    uint64_t *DeviceCounters::add(std::string_view device)
+    {
+        if (m_count < m_devices.size())
+        {
+            if (m_devices[m_count] != device)
+            {
+                m_devices[m_count].assign(device.data(), device.size());
+                m_changed = true;
+            }
+        }
+        else
+        {
+            m_devices.emplace_back(device);
+            m_changed = true;
+        }
+
+        size_t needed = (m_count + 1) * m_countersPerDevice;
+        if (m_current.size() < needed)
+        {
+            m_current.resize(needed);
+        }
+        return &m_current[m_count++ * m_countersPerDevice];
+    }
+
+    bool DeviceCounters::end()
+    {
+        if (m_count != m_devices.size())
+        {
+            m_devices.resize(m_count);
+            m_changed = true;
+        }
+        if (m_changed)
+        {
+            m_metricNames.clear();
+            for (const std::string &device : m_devices)
+            {
+                for (std::string_view suffix : m_suffixes)
+                {
+                    m_metricNames.push_back(device + "." + std::string(suffix));
+                }
+            }
+        }
+        return !m_changed;
+    }
+
+    size_t DeviceCounters::size() const
+    {
+        return m_count;
+    }
+
+    const uint64_t *DeviceCounters::current(size_t device) const
+    {
+        return &m_current[device * m_countersPerDevice];
+    }
+
+    const uint64_t *DeviceCounters::previous(size_t device) const
+    {
+        return &m_previous[device * m_countersPerDevice];
+    }
+
+    std::string_view DeviceCounters::metricName(size_t device, size_t metric) const
+    {
+        return m_metricNames[device * m_suffixes.size() + metric];
+    }
+
+    // ══════════════════════════════════════════════════════════════════════
+    // DiskStatsCollector
+    // ══════════════════════════════════════════════════════════════════════
+
+    namespace
+    {
+        // Slots kept per device, out of the 11+ diskstats columns
+        enum DiskCounter
+        {
+            DiskReads,          // column 1: reads completed
+            DiskSectorsRead,    // column 3
+            DiskWrites,         // column 5: writes completed
+            DiskSectorsWritten, // column 7
+            DiskBusyMs,         // column 10: ms with I/O in flight
+            DiskCounterCount
+        };
+    } // namespace
+
+    DiskStatsCollector::DiskStatsCollector(std::string path)
+        : ProcCollector(std::move(path)),
+          m_devices(DiskCounterCount, {"read_iops", "write_iops", "read_kBps", "write_kBps", "util"})
+    {
+    }
+
+    bool DiskStatsCollector::parse(std::string_view content, double elapsedSec, std::vector<Metric> &metrics)
+    {
+        // "   8       0 sda 4205 1 343954 1462 ..."
+        m_devices.begin();
+        size_t from = 0;
+        std::string_view line;
+        while (nextLine(content, from, line))
+        {
+            const char *pos = line.data();
+            const char *end = pos + line.size();
+            uint64_t major = 0;
+            uint64_t minor = 0;
+            if (!scanUnsigned(pos, end, major) || !scanUnsigned(pos, end, minor))
+            {
+                continue;
+            }
+
+            std::string_view rest = trimSpaces(std::string_view(pos, static_cast<size_t>(end - pos)));
+            std::string_view name = rest.substr(0, rest.find(' '));
+            bool pseudo = name.compare(0, 4, "loop") == 0 || name.compare(0, 3, "ram") == 0;
+            if (!accepts(name) || (pseudo && !hasFilter()))
+            {
+                continue;
+            }
+
+            uint64_t fields[10];
+            rest.remove_prefix(name.size());
+            if (scanFields(rest, fields, 10) != 10)
+            {
+                continue;
+            }
+            uint64_t *counters = m_devices.add(name);
+            counters[DiskReads] = fields[0];
+            counters[DiskSectorsRead] = fields[2];
+            counters[DiskWrites] = fields[4];
+            counters[DiskSectorsWritten] = fields[6];
+            counters[DiskBusyMs] = fields[9];
+        }
+
+        if (!m_devices.end() || elapsedSec <= 0.0)
+        {
+            return true; // baseline only
+        }
+        for (size_t i = 0; i < m_devices.size(); ++i)
+        {
+            const uint64_t *now = m_devices.current(i);
+            const uint64_t *before = m_devices.previous(i);
+            // Sectors are 512 bytes; busy ms per second / 10 is percent
+            metrics.push_back({m_devices.metricName(i, 0), perSecond(now[DiskReads], before[DiskReads], elapsedSec), "IOPS"});
+            metrics.push_back({m_devices.metricName(i, 1), perSecond(now[DiskWrites], before[DiskWrites], elapsedSec), "IOPS"});
+            metrics.push_back({m_devices.metricName(i, 2),
+                               perSecond(now[DiskSectorsRead], before[DiskSectorsRead], elapsedSec) / 2.0, "kB/s"});
+            metrics.push_back({m_devices.metricName(i, 3),
+                               perSecond(now[DiskSectorsWritten], before[DiskSectorsWritten], elapsedSec) / 2.0, "kB/s"});
+            metrics.push_back({m_devices.metricName(i, 4),
+                               std::min(perSecond(now[DiskBusyMs], before[DiskBusyMs], elapsedSec) / 10.0, 100.0), {}});
+        }
+        return true;
+    }
+
+    // ══════════════════════════════════════════════════════════════════════
+    // NetDevCollector
+    // ══════════════════════════════════════════════════════════════════════
+
+    namespace
+    {
+        enum NetCounter
+        {
+            NetRxBytes,   // receive column 1
+            NetRxPackets, // receive column 2
+            NetTxBytes,   // transmit column 1 (9th overall)
+            NetTxPackets, // transmit column 2
+            NetCounterCount
+        };
+    } // namespace
+
+    NetDevCollector::NetDevCollector(std::string path)
+        : ProcCollector(std::move(path)),
+          m_interfaces(NetCounterCount, {"rx_kBps", "tx_kBps", "rx_pps", "tx_pps"})
+    {
+    }
+
+    bool NetDevCollector::parse(std::string_view content, double elapsedSec, std::vector<Metric> &metrics)
+    {
+        // Two header lines, then "  eth0: 930 13 0 0 0 0 0 0 1030 13 ..."
+        m_interfaces.begin();
+        size_t from = 0;
+        std::string_view line;
+        while (nextLine(content, from, line))
+        {
+            size_t colon = line.find(':');
+            if (colon == std::string_view::npos)
+            {
+                continue;
+            }
+            std::string_view name = trimSpaces(line.substr(0, colon));
+            if (name.empty() || !accepts(name))
+            {
+                continue;
+            }
+
+            uint64_t fields[10];
+            if (scanFields(line.substr(colon + 1), fields, 10) != 10)
+            {
+                continue;
+            }
+            uint64_t *counters = m_interfaces.add(name);
+            counters[NetRxBytes] = fields[0];
+            counters[NetRxPackets] = fields[1];
+            counters[NetTxBytes] = fields[8];
+            counters[NetTxPackets] = fields[9];
+        }
+
+        if (!m_interfaces.end() || elapsedSec <= 0.0)
+        {
+            return true; // baseline only
+        }
+        for (size_t i = 0; i < m_interfaces.size(); ++i)
+        {
+            const uint64_t *now = m_interfaces.current(i);
+            const uint64_t *before = m_interfaces.previous(i);
+            metrics.push_back({m_interfaces.metricName(i, 0),
+                               perSecond(now[NetRxBytes], before[NetRxBytes], elapsedSec) / 1024.0, "kB/s"});
+            metrics.push_back({m_interfaces.metricName(i, 1),
+                               perSecond(now[NetTxBytes], before[NetTxBytes], elapsedSec) / 1024.0, "kB/s"});
+            metrics.push_back({m_interfaces.metricName(i, 2),
+                               perSecond(now[NetRxPackets], before[NetRxPackets], elapsedSec), "pkt/s"});
+            metrics.push_back({m_interfaces.metricName(i, 3),
+                               perSecond(now[NetTxPackets], before[NetTxPackets], elapsedSec), "pkt/s"});
+        }
+        return true;
+    }
+
+    // ══════════════════════════════════════════════════════════════════════
+    // LoadAvgCollector
+    // ══════════════════════════════════════════════════════════════════════
+
+    LoadAvgCollector::LoadAvgCollector(std::string path) : ProcCollector(std::move(path))
+    {
+    }
+
+    bool LoadAvgCollector::parse(std::string_view content, double /*elapsedSec*/, std::vector<Metric> &metrics)
+    {
+        // "1.02 2.23 2.40 2/72 19912"
+        const char *pos = content.data();
+        const char *end = pos + content.size();
+        double load[3];
+        uint64_t running = 0;
+        uint64_t total = 0;
+        if (!scanDecimal(pos, end, load[0]) || !scanDecimal(pos, end, load[1]) || !scanDecimal(pos, end, load[2]) ||
+            !scanUnsigned(pos, end, running) || pos == end || *pos++ != '/' || !scanUnsigned(pos, end, total))
+        {
+            return false;
+        }
+        metrics.push_back({"load1", load[0], "tasks"});
+        metrics.push_back({"load5", load[1], "tasks"});
+        metrics.push_back({"load15", load[2], "tasks"});
+        metrics.push_back({"running", static_cast<double>(running), "tasks"});
+        metrics.push_back({"total_tasks", static_cast<double>(total), "tasks"});
+        return true;
+    }
+
+    // ══════════════════════════════════════════════════════════════════════
+    // PressureCollector
+    // ══════════════════════════════════════════════════════════════════════
+
+    PressureCollector::PressureCollector(std::string path) : ProcCollector(std::move(path))
+    {
+    }
+
+    bool PressureCollector::parse(std::string_view content, double elapsedSec, std::vector<Metric> &metrics)
+    {
+        // "some avg10=0.89 avg60=13.52 avg300=29.87 total=2150192892"
+        // "full avg10=0.00 avg60=0.00 avg300=0.00 total=0"
+        static constexpr std::string_view Names[2][4] = {
+            {"some.avg10", "some.avg60", "some.avg300", "some.stall"},
+            {"full.avg10", "full.avg60", "full.avg300", "full.stall"}};
+
+        bool parsedAny = false;
+        size_t from = 0;
+        std::string_view line;
+        while (nextLine(content, from, line))
+        {
+            int kind = line.compare(0, 5, "some ") == 0 ? 0 : line.compare(0, 5, "full ") == 0 ? 1 : -1;
+            if (kind < 0)
+            {
+                continue;
+            }
+
+            double averages[3];
+            uint64_t total = 0;
+            const char *pos = line.data() + 5;
+            const char *end = line.data() + line.size();
+            int found = 0;
+            while (pos < end)
+            {
+                const char *equals = static_cast<const char *>(std::memchr(pos, '=', static_cast<size_t>(end - pos)));
+                if (equals == nullptr)
+                {
+                    break;
+                }
+                std::string_view key = trimSpaces(std::string_view(pos, static_cast<size_t>(equals - pos)));
+                pos = equals + 1;
+                int slot = key == "avg10" ? 0 : key == "avg60" ? 1 : key == "avg300" ? 2 : key == "total" ? 3 : -1;
+                bool ok = slot == 3 ? scanUnsigned(pos, end, total) : slot >= 0 && scanDecimal(pos, end, averages[slot]);
+                if (!ok)
+                {
+                    break;
+                }
+                found |= 1 << slot;
+            }
+            if (found != 0xF)
+            {
+                continue;
+            }
+
+            for (int i = 0; i < 3; ++i)
+            {
+                metrics.push_back({Names[kind][i], averages[i], {}});
+            }
+            // total= is cumulative stall time in microseconds
+            if (m_haveTotal[kind] && elapsedSec > 0.0)
+            {
+                double stalled = perSecond(total, m_previousTotal[kind], elapsedSec) / 1e4;
+                metrics.push_back({Names[kind][3], std::min(stalled, 100.0), {}});
+            }
+            m_previousTotal[kind] = total;
+            m_haveTotal[kind] = true;
+            parsedAny = true;
+        }
+        return parsedAny;
+    }
+
+} // namespace SmartDataHub
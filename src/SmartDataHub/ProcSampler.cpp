@@ -0,0 +1,177 @@
+#include "ProcSampler.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+namespace SmartDataHub
+{
+
+    ProcSampler::ProcSampler(bool useIoUring) : m_useIoUring{useIoUring}
+    {
+    }
+
+    std::size_t ProcSampler::add(std::unique_ptr<ProcCollector> collector, int intervalMs)
+    {
+        Entry entry;
+        entry.collector = std::move(collector);
+        entry.interval = std::chrono::milliseconds(std::max(intervalMs, 1));
+        entry.due = Clock::now();
+        m_entries.push_back(std::move(entry));
+        return m_entries.size() - 1;
+    }
+
+    std::size_t ProcSampler::size() const
+    {
+        return m_entries.size();
+    }
+
+    ProcSampler::Clock::time_point ProcSampler::sampleDue(const MetricsHandler &onMetrics)
+    {
+        // Ring sized once the collectors are known, on the sampling thread
+        if (m_useIoUring && !m_ring.isReady())
+        {
+            m_useIoUring = false;
+            if (!m_ring.init(static_cast<unsigned>(std::max<std::size_t>(m_entries.size(), 1))))
+            {
+                std::cerr << "[ProcSampler] io_uring unavailable, using plain reads" << std::endl;
+            }
+        }
+
+        Clock::time_point now = Clock::now();
+        m_fallback.clear();
+        for (std::size_t i = 0; i < m_entries.size(); ++i)
+        {
+            Entry &entry = m_entries[i];
+            if (entry.due > now)
+            {
+                continue;
+            }
+            // Fixed cadence; missed ticks collapse into this one
+            entry.due += entry.interval;
+            if (entry.due <= now)
+            {
+                entry.due = now + entry.interval;
+            }
+
+            ReadRequest request;
+            if (m_ring.isReady() && entry.collector->prepareRead(request) &&
+                m_ring.prepareRead(request.fd, request.buffer, static_cast<unsigned>(request.length), 0, i))
+            {
+                m_queued.push_back(i);
+            }
+            else
+            {
+                m_fallback.push_back(i);
+            }
+        }
+        flush(onMetrics);
+
+        for (std::size_t index : m_fallback)
+        {
+            m_metrics.clear();
+            deliver(index, m_entries[index].collector->collect(m_metrics), onMetrics);
+        }
+
+        Clock::time_point next = Clock::time_point::max();
+        for (const Entry &entry : m_entries)
+        {
+            next = std::min(next, entry.due);
+        }
+        return next;
+    }
+
+    void ProcSampler::flush(const MetricsHandler &onMetrics)
+    {
+        if (m_queued.empty())
+        {
+            return;
+        }
+
+        // procfs reads complete inline, so this is normally a single
+        // io_uring_enter() per pass; keep reaping until all are back
+        std::size_t reaped = 0;
+        bool submitted = false;
+        while (reaped < m_queued.size())
+        {
+            int result = m_ring.submitAndWait(static_cast<unsigned>(m_queued.size() - reaped));
+            ++m_submissions;
+            if (result < 0 && !submitted)
+            {
+                // Nothing reached the kernel: read these the plain way and
+                // stop using the ring, since its queue is now unusable
+                std::cerr << "[ProcSampler] io_uring_enter failed (" << -result << "), using plain reads" << std::endl;
+                m_ring.close();
+                m_fallback.insert(m_fallback.end(), m_queued.begin(), m_queued.end());
+                m_queued.clear();
+                return;
+            }
+            submitted = true;
+
+            IoCompletion completion;
+            while (m_ring.popCompletion(completion))
+            {
+                ++reaped;
+                std::size_t index = static_cast<std::size_t>(completion.userData);
+                if (completion.result < 0)
+                {
+                    // The ring could not do this read (e.g. a kernel
+                    // without the opcode): collect() takes it instead
+                    failedRead(-completion.result);
+                    m_fallback.push_back(index);
+                    continue;
+                }
+                m_metrics.clear();
+                deliver(index, m_entries[index].collector->completeRead(completion.result, m_metrics), onMetrics);
+            }
+            if (result < 0)
+            {
+                // Waiting failed after submission: closing the ring cancels
+                // what is left, those collectors just miss this tick
+                std::cerr << "[ProcSampler] io_uring_enter failed (" << -result << "), using plain reads" << std::endl;
+                m_ring.close();
+                break;
+            }
+        }
+        m_queued.clear();
+
+        if (m_opcodeUnsupported)
+        {
+            m_ring.close();
+        }
+    }
+
+    void ProcSampler::failedRead(int error)
+    {
+        if (error == EINVAL || error == EOPNOTSUPP)
+        {
+            // Every later submission would fail the same way
+            m_opcodeUnsupported = true;
+        }
+        if (!m_readFailureLogged)
+        {
+            m_readFailureLogged = true;
+            std::cerr << "[ProcSampler] io_uring read failed (" << std::strerror(error) << "), using plain reads"
+                      << std::endl;
+        }
+    }
+
+    void ProcSampler::deliver(std::size_t index, bool ok, const MetricsHandler &onMetrics)
+    {
+        if (ok && !m_metrics.empty())
+        {
+            onMetrics(index, m_metrics);
+        }
+    }
+
+    bool ProcSampler::usesIoUring() const
+    {
+        return m_ring.isReady();
+    }
+
+    uint64_t ProcSampler::getSubmissions() const
+    {
+        return m_submissions;
+    }
+
+} // namespace SmartDataHub
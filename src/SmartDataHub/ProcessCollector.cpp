@@ -0,0 +1,448 @@
+#include "ProcessCollector.hpp"
+#include "ProcScan.hpp"
+#include "inc/AsyncLogging/ThreadPool.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <cerrno>
+#include <ctime>
+#include <fcntl.h>
+#include <future>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace SmartDataHub
+{
+    namespace
+    {
+        // A stat line is ~350 bytes; comm is at most 64
+        constexpr std::size_t StatSlotSize = 1024;
+        constexpr std::size_t DirentBufferSize = 64 * 1024;
+        // Smaller shards cost more in hand-off than they save
+        constexpr std::size_t MinShardSize = 512;
+
+        // struct linux_dirent64: d_ino, d_off, d_reclen, d_type, d_name
+        constexpr std::size_t DirentReclenOffset = 16;
+        constexpr std::size_t DirentNameOffset = 19;
+
+        // Skips `count` blank-separated tokens (which may be negative)
+        bool skipTokens(const char *&pos, const char *end, int count) noexcept
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                while (pos < end && *pos == ' ')
+                {
+                    ++pos;
+                }
+                const char *blank = static_cast<const char *>(std::memchr(pos, ' ', static_cast<std::size_t>(end - pos)));
+                if (blank == nullptr)
+                {
+                    return false;
+                }
+                pos = blank;
+            }
+            return true;
+        }
+
+        // Kept stat fds may use a quarter of the fd limit: the rest is for
+        // the sockets, log files and sources of the rest of the process
+        std::size_t capOpenFds(std::size_t configured)
+        {
+            rlimit limit{};
+            if (getrlimit(RLIMIT_NOFILE, &limit) != 0 || limit.rlim_cur == RLIM_INFINITY)
+            {
+                return configured;
+            }
+            return std::min(configured, static_cast<std::size_t>(limit.rlim_cur / 4));
+        }
+
+        // Heap order that keeps the least busy candidate on top
+        template <typename Candidate>
+        bool lessBusy(const Candidate &a, const Candidate &b)
+        {
+            return a.delta > b.delta;
+        }
+    } // namespace
+
+    ProcessCollector::ProcessCollector(std::string procRoot, std::size_t maxOpenFds)
+        : m_procRoot{std::move(procRoot)},
+          m_maxOpenFds{capOpenFds(maxOpenFds)},
+          m_ticksPerSecond{sysconf(_SC_CLK_TCK)},
+          m_pageKb{sysconf(_SC_PAGESIZE) / 1024}
+    {
+    }
+
+    ProcessCollector::~ProcessCollector()
+    {
+        for (Process &process : m_processes)
+        {
+            closeProcess(process);
+        }
+        if (m_rootFd >= 0)
+        {
+            ::close(m_rootFd);
+        }
+    }
+
+    bool ProcessCollector::open()
+    {
+        if (m_rootFd < 0)
+        {
+            m_rootFd = ::open(m_procRoot.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        }
+        return m_rootFd >= 0;
+    }
+
+    bool ProcessCollector::isOpen() const
+    {
+        return m_rootFd >= 0;
+    }
+
+    void ProcessCollector::setThreadPool(async_logging::ThreadPool *pool)
+    {
+        m_pool = pool;
+    }
+
+    std::size_t ProcessCollector::getProcessCount() const
+    {
+        return m_processes.size();
+    }
+
+    std::size_t ProcessCollector::getOpenFdCount() const
+    {
+        return m_openFds.load(std::memory_order_relaxed);
+    }
+
+    std::size_t ProcessCollector::getMaxOpenFds() const
+    {
+        return m_maxOpenFds;
+    }
+
+    bool ProcessCollector::parseStat(std::string_view content, StatFields &fields) noexcept
+    {
+        // "1234 (comm) S ppid pgrp session tty tpgid flags minflt cminflt
+        //  majflt cmajflt utime stime cutime cstime priority nice threads
+        //  itrealvalue starttime vsize rss ..."; comm may hold ") "
+        const char *open = static_cast<const char *>(std::memchr(content.data(), '(', content.size()));
+        std::size_t close = content.rfind(')');
+        if (open == nullptr || close == std::string_view::npos || content.data() + close < open)
+        {
+            return false;
+        }
+        fields.comm = std::string_view(open + 1, static_cast<std::size_t>(content.data() + close - open - 1));
+
+        const char *pos = content.data() + close + 1;
+        const char *end = content.data() + content.size();
+        uint64_t utime = 0;
+        uint64_t stime = 0;
+        if (!skipTokens(pos, end, 11) || !scanUnsigned(pos, end, utime) || !scanUnsigned(pos, end, stime) ||
+            !skipTokens(pos, end, 6) || !scanUnsigned(pos, end, fields.startTime) || !skipTokens(pos, end, 1) ||
+            !scanUnsigned(pos, end, fields.rssPages))
+        {
+            return false;
+        }
+        fields.ticks = utime + stime;
+        return true;
+    }
+
+    uint64_t ProcessCollector::bootTicks() const
+    {
+        timespec now{};
+        clock_gettime(CLOCK_BOOTTIME, &now);
+        return static_cast<uint64_t>(now.tv_sec) * static_cast<uint64_t>(m_ticksPerSecond) +
+               static_cast<uint64_t>(now.tv_nsec) * static_cast<uint64_t>(m_ticksPerSecond) / 1000000000u;
+    }
+
+    bool ProcessCollector::listPids()
+    {
+        // Read straight from the kept fd: no opendir()/DIR allocation per tick
+        if (lseek(m_rootFd, 0, SEEK_SET) < 0)
+        {
+            return false;
+        }
+        m_dirents.resize(DirentBufferSize);
+        m_pids.clear();
+        for (;;)
+        {
+            long bytes = syscall(SYS_getdents64, m_rootFd, m_dirents.data(), m_dirents.size());
+            if (bytes < 0)
+            {
+                return false;
+            }
+            if (bytes == 0)
+            {
+                break;
+            }
+            for (long offset = 0; offset < bytes;)
+            {
+                const char *entry = m_dirents.data() + offset;
+                unsigned short reclen = 0;
+                std::memcpy(&reclen, entry + DirentReclenOffset, sizeof(reclen));
+                const char *name = entry + DirentNameOffset;
+                const char *nameEnd = name + std::strlen(name);
+                int pid = 0;
+                auto [ptr, ec] = std::from_chars(name, nameEnd, pid);
+                if (ec == std::errc() && ptr == nameEnd && pid > 0)
+                {
+                    m_pids.push_back(pid);
+                }
+                offset += reclen;
+            }
+        }
+        // /proc lists pids in order already; other roots may not
+        if (!std::is_sorted(m_pids.begin(), m_pids.end()))
+        {
+            std::sort(m_pids.begin(), m_pids.end());
+        }
+        return true;
+    }
+
+    void ProcessCollector::mergePids()
+    {
+        // Both lists are sorted: a surviving pid keeps its state and fd
+        m_merged.clear();
+        std::size_t old = 0;
+        for (int pid : m_pids)
+        {
+            while (old < m_processes.size() && m_processes[old].pid < pid)
+            {
+                closeProcess(m_processes[old++]);
+            }
+            if (old < m_processes.size() && m_processes[old].pid == pid)
+            {
+                m_merged.push_back(m_processes[old++]);
+                continue;
+            }
+            Process process;
+            process.pid = pid;
+            m_merged.push_back(process);
+        }
+        while (old < m_processes.size())
+        {
+            closeProcess(m_processes[old++]);
+        }
+        std::swap(m_processes, m_merged);
+    }
+
+    void ProcessCollector::closeProcess(Process &process)
+    {
+        if (process.fd >= 0)
+        {
+            ::close(process.fd);
+            process.fd = -1;
+            m_openFds.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    bool ProcessCollector::releaseFd(Shard &shard, const Process &keep)
+    {
+        // Only this shard's processes: the other shards run concurrently
+        for (; shard.evict < shard.end; ++shard.evict)
+        {
+            Process &process = m_processes[shard.evict];
+            if (process.fd >= 0 && &process != &keep)
+            {
+                closeProcess(process);
+                ++shard.evict;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool ProcessCollector::readStat(Process &process, Shard &shard)
+    {
+        char *slot = shard.slot;
+        int fd = process.fd;
+        if (fd < 0)
+        {
+            char path[32];
+            char *end = std::to_chars(path, path + 16, process.pid).ptr;
+            std::memcpy(end, "/stat", 6);
+            fd = openat(m_rootFd, path, O_RDONLY | O_CLOEXEC);
+            while (fd < 0 && (errno == EMFILE || errno == ENFILE) && releaseFd(shard, process))
+            {
+                // Out of fds despite the budget: trade a kept fd for this
+                // read, and keep no new ones for the rest of the tick
+                shard.exhausted = true;
+                fd = openat(m_rootFd, path, O_RDONLY | O_CLOEXEC);
+            }
+            if (fd < 0)
+            {
+                return false;
+            }
+            if (!shard.exhausted)
+            {
+                if (m_openFds.fetch_add(1, std::memory_order_relaxed) < m_maxOpenFds)
+                {
+                    process.fd = fd;
+                }
+                else
+                {
+                    m_openFds.fetch_sub(1, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        ssize_t bytes = pread(fd, slot, StatSlotSize, 0);
+        if (process.fd < 0)
+        {
+            ::close(fd);
+        }
+        if (bytes <= 0)
+        {
+            // Exited; a kept fd also fails once the pid is reused
+            closeProcess(process);
+            process.known = false;
+            return false;
+        }
+
+        StatFields fields;
+        if (!parseStat(std::string_view(slot, static_cast<std::size_t>(bytes)), fields))
+        {
+            return false;
+        }
+
+        if (process.known && fields.startTime == process.startTime)
+        {
+            process.delta = fields.ticks >= process.ticks ? fields.ticks - process.ticks : 0;
+            process.ranked = true;
+        }
+        else
+        {
+            // New process (or a reused pid): all its time is in the
+            // interval only if it started after the previous sample
+            process.delta = fields.ticks;
+            process.ranked = m_sampled && fields.startTime >= m_lastSampleTicks;
+        }
+        // comm changes on exec and PR_SET_NAME, not only with the pid
+        std::size_t commLength = std::min(fields.comm.size(), CommCapacity);
+        if (commLength != process.commLength || std::memcmp(process.comm, fields.comm.data(), commLength) != 0)
+        {
+            process.commLength = static_cast<uint8_t>(commLength);
+            std::memcpy(process.comm, fields.comm.data(), commLength);
+        }
+        process.ticks = fields.ticks;
+        process.startTime = fields.startTime;
+        process.rssPages = fields.rssPages;
+        process.known = true;
+        return true;
+    }
+
+    void ProcessCollector::scanShard(Shard &shard, std::size_t topN)
+    {
+        shard.heap.clear();
+        shard.evict = shard.begin;
+        shard.exhausted = false;
+        for (std::size_t i = shard.begin; i < shard.end; ++i)
+        {
+            Process &process = m_processes[i];
+            process.ranked = false;
+            if (!readStat(process, shard) || !process.ranked || topN == 0)
+            {
+                continue;
+            }
+
+            if (shard.heap.size() < topN)
+            {
+                shard.heap.push_back({process.delta, i});
+                std::push_heap(shard.heap.begin(), shard.heap.end(), lessBusy<Candidate>);
+            }
+            else if (process.delta > shard.heap.front().delta)
+            {
+                std::pop_heap(shard.heap.begin(), shard.heap.end(), lessBusy<Candidate>);
+                shard.heap.back() = {process.delta, i};
+                std::push_heap(shard.heap.begin(), shard.heap.end(), lessBusy<Candidate>);
+            }
+        }
+    }
+
+    bool ProcessCollector::sample(std::size_t topN, std::vector<ProcessUsage> &top)
+    {
+        top.clear();
+        if (m_rootFd < 0)
+        {
+            return false;
+        }
+
+        Clock::time_point now = Clock::now();
+        uint64_t nowTicks = bootTicks();
+        if (!listPids())
+        {
+            return false;
+        }
+        mergePids();
+
+        std::size_t count = m_processes.size();
+        std::size_t shardCount = 1;
+        if (m_pool != nullptr)
+        {
+            shardCount = std::min(m_pool->getThreadCount() + 1, std::max<std::size_t>(1, count / MinShardSize));
+        }
+        m_arena.resize(shardCount * StatSlotSize);
+        m_shards.resize(shardCount);
+        for (std::size_t s = 0; s < shardCount; ++s)
+        {
+            m_shards[s].begin = count * s / shardCount;
+            m_shards[s].end = count * (s + 1) / shardCount;
+            m_shards[s].slot = m_arena.data() + s * StatSlotSize;
+        }
+
+        // The calling thread takes the first shard itself
+        std::vector<std::future<void>> pending;
+        for (std::size_t s = 1; s < shardCount; ++s)
+        {
+            Shard &shard = m_shards[s];
+            pending.push_back(m_pool->enqueue([this, &shard, topN]() { scanShard(shard, topN); }));
+        }
+        scanShard(m_shards[0], topN);
+        for (auto &done : pending)
+        {
+            done.get();
+        }
+
+        // Merge the shard heaps into one of topN
+        m_top.clear();
+        for (const Shard &shard : m_shards)
+        {
+            for (const Candidate &candidate : shard.heap)
+            {
+                if (m_top.size() < topN)
+                {
+                    m_top.push_back(candidate);
+                    std::push_heap(m_top.begin(), m_top.end(), lessBusy<Candidate>);
+                }
+                else if (candidate.delta > m_top.front().delta)
+                {
+                    std::pop_heap(m_top.begin(), m_top.end(), lessBusy<Candidate>);
+                    m_top.back() = candidate;
+                    std::push_heap(m_top.begin(), m_top.end(), lessBusy<Candidate>);
+                }
+            }
+        }
+        std::sort_heap(m_top.begin(), m_top.end(), lessBusy<Candidate>); // busiest first
+
+        double elapsedSec = std::chrono::duration<double>(now - m_lastSample).count();
+        if (m_sampled && elapsedSec > 0.0)
+        {
+            double ticksInInterval = elapsedSec * static_cast<double>(m_ticksPerSecond);
+            for (const Candidate &candidate : m_top)
+            {
+                const Process &process = m_processes[candidate.index];
+                ProcessUsage usage;
+                usage.pid = process.pid;
+                usage.name = std::string_view(process.comm, process.commLength);
+                usage.cpuPercent = static_cast<double>(process.delta) * 100.0 / ticksInInterval;
+                usage.rssKb = process.rssPages * static_cast<uint64_t>(m_pageKb);
+                top.push_back(usage);
+            }
+        }
+
+        m_lastSample = now;
+        m_lastSampleTicks = nowTicks;
+        m_sampled = true;
+        return true;
+    }
+
+} // namespace SmartDataHub
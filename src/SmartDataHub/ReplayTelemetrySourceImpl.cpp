@@ -0,0 +1,256 @@
+#include "ReplayTelemetrySourceImpl.hpp"
+#include <poll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#include <algorithm>
+
+namespace SmartDataHub
+{
+
+    namespace
+    {
+        // Gap before the first sample of a looped trace when the trace has
+        // no interval of its own (one sample, or all at one timestamp)
+        constexpr uint64_t DefaultLoopGapUs = 1000;
+    } // namespace
+
+    ReplayTelemetrySourceImpl::ReplayTelemetrySourceImpl(const std::string &path, double speed, bool loop)
+        : m_path{path}, m_speed{std::max(speed, 0.0)}, m_loop{loop}
+    {
+    }
+
+    ReplayTelemetrySourceImpl::ReplayTelemetrySourceImpl(std::shared_ptr<const ReplayTrace> trace, double speed,
+                                                         bool loop)
+        : m_trace{std::move(trace)}, m_speed{std::max(speed, 0.0)}, m_loop{loop}
+    {
+        if (m_trace)
+        {
+            m_path = m_trace->getPath();
+        }
+    }
+
+    ReplayTelemetrySourceImpl::~ReplayTelemetrySourceImpl()
+    {
+        if (m_timerFd >= 0)
+        {
+            close(m_timerFd);
+        }
+    }
+
+    bool ReplayTelemetrySourceImpl::openSource()
+    {
+        if (!m_trace)
+        {
+            m_trace = ReplayTrace::open(m_path);
+            if (!m_trace)
+            {
+                return false;
+            }
+        }
+        if (m_timerFd < 0)
+        {
+            m_timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+            if (m_timerFd < 0)
+            {
+                return false;
+            }
+        }
+
+        m_start = Clock::now();
+        m_offset = m_trace->begin();
+        m_loopShiftUs = 0;
+        m_passRecords = 0;
+        m_burst = MaxBurst;
+        m_replayed = 0;
+        m_maxLagUs = 0;
+        loadNext();
+        arm();
+        return true;
+    }
+
+    bool ReplayTelemetrySourceImpl::loadNext()
+    {
+        uint64_t timeUs = 0;
+        std::string_view sample;
+        if (!m_trace->next(m_offset, timeUs, sample))
+        {
+            if (!m_loop || m_passRecords == 0)
+            {
+                m_haveNext = false;
+                return false;
+            }
+
+            // The next pass starts one average interval after this one
+            uint64_t span = m_lastUs - m_firstUs;
+            uint64_t gap = m_passRecords > 1 && span > 0 ? span / (m_passRecords - 1) : DefaultLoopGapUs;
+            m_loopShiftUs += span + gap;
+            m_offset = m_trace->begin();
+            m_passRecords = 0;
+            if (!m_trace->next(m_offset, timeUs, sample))
+            {
+                m_haveNext = false;
+                return false;
+            }
+        }
+
+        if (m_passRecords == 0)
+        {
+            if (m_loopShiftUs == 0)
+            {
+                m_firstUs = timeUs;
+            }
+            m_lastUs = m_firstUs;
+        }
+        // Out-of-order timestamps are played at once, not before the start
+        m_lastUs = std::max(timeUs, m_lastUs);
+        ++m_passRecords;
+
+        m_next = sample;
+        m_nextDue = m_start;
+        if (m_speed > 0.0)
+        {
+            double offsetNs = static_cast<double>(m_loopShiftUs + m_lastUs - m_firstUs) * 1000.0 / m_speed;
+            m_nextDue += std::chrono::duration_cast<Clock::duration>(
+                std::chrono::nanoseconds(static_cast<int64_t>(offsetNs)));
+        }
+        m_haveNext = true;
+        return true;
+    }
+
+    void ReplayTelemetrySourceImpl::arm()
+    {
+        itimerspec spec{};
+        if (m_haveNext)
+        {
+            if (m_nextDue <= Clock::now())
+            {
+                // Burst used up with samples still due: fire at once, so the
+                // reader yields to others and comes back
+                spec.it_value.tv_nsec = 1;
+            }
+            else
+            {
+                auto deadline = std::chrono::duration_cast<std::chrono::nanoseconds>(m_nextDue.time_since_epoch());
+                spec.it_value.tv_sec = static_cast<time_t>(deadline.count() / 1000000000);
+                spec.it_value.tv_nsec = static_cast<long>(deadline.count() % 1000000000);
+            }
+        }
+        // steady_clock is CLOCK_MONOTONIC; a zero it_value disarms
+        timerfd_settime(m_timerFd, TFD_TIMER_ABSTIME, &spec, nullptr);
+    }
+
+    bool ReplayTelemetrySourceImpl::readRecord(std::string_view &record)
+    {
+        if (!m_haveNext)
+        {
+            return false;
+        }
+        Clock::time_point now = Clock::now();
+        if (now < m_nextDue)
+        {
+            return false;
+        }
+
+        record = m_next;
+        ++m_replayed;
+        auto lagUs = std::chrono::duration_cast<std::chrono::microseconds>(now - m_nextDue).count();
+        m_maxLagUs = std::max(m_maxLagUs, static_cast<uint64_t>(lagUs));
+        if (m_burst > 0)
+        {
+            --m_burst;
+        }
+
+        loadNext();
+        if (!hasPendingData())
+        {
+            arm();
+        }
+        return true;
+    }
+
+    bool ReplayTelemetrySourceImpl::readSource(std::string &out)
+    {
+        std::string_view record;
+        if (!readRecord(record))
+        {
+            return false;
+        }
+        out.assign(record.data(), record.size());
+        return true;
+    }
+
+    size_t ReplayTelemetrySourceImpl::readRecords(std::vector<std::string_view> &records)
+    {
+        size_t added = 0;
+        std::string_view record;
+        while (hasPendingData() && readRecord(record))
+        {
+            records.push_back(record);
+            ++added;
+        }
+        return added;
+    }
+
+    int ReplayTelemetrySourceImpl::getPollFd() const
+    {
+        return m_timerFd;
+    }
+
+    bool ReplayTelemetrySourceImpl::acknowledgeReady()
+    {
+        uint64_t expirations = 0;
+        ssize_t bytes = read(m_timerFd, &expirations, sizeof(expirations));
+        (void)bytes; // EAGAIN when a read already consumed the expiry
+
+        m_burst = MaxBurst;
+        if (hasPendingData())
+        {
+            return true;
+        }
+        arm();
+        return false;
+    }
+
+    bool ReplayTelemetrySourceImpl::hasPendingData() const
+    {
+        return m_haveNext && m_burst > 0 && Clock::now() >= m_nextDue;
+    }
+
+    bool ReplayTelemetrySourceImpl::waitForData(int timeoutMs)
+    {
+        if (!m_haveNext)
+        {
+            return false;
+        }
+        if (Clock::now() < m_nextDue || m_burst == 0)
+        {
+            pollfd pfd{m_timerFd, POLLIN, 0};
+            if (poll(&pfd, 1, timeoutMs) <= 0)
+            {
+                return false;
+            }
+        }
+        return acknowledgeReady();
+    }
+
+    bool ReplayTelemetrySourceImpl::isFinished() const
+    {
+        return m_trace && !m_haveNext;
+    }
+
+    uint64_t ReplayTelemetrySourceImpl::getReplayedCount() const
+    {
+        return m_replayed;
+    }
+
+    uint64_t ReplayTelemetrySourceImpl::getMaxLagUs() const
+    {
+        return m_maxLagUs;
+    }
+
+    const std::shared_ptr<const ReplayTrace> &ReplayTelemetrySourceImpl::getTrace() const
+    {
+        return m_trace;
+    }
+
+} // namespace SmartDataHub
@@ -0,0 +1,158 @@
+#include "ReplayTrace.hpp"
+#include "ProcScan.hpp"
+#include <fcntl.h>    // open()
+#include <sys/mman.h> // mmap(), madvise()
+#include <sys/stat.h> // fstat()
+#include <unistd.h>   // close()
+#include <cstring>
+#include <iostream>
+
+namespace SmartDataHub
+{
+
+    std::shared_ptr<const ReplayTrace> ReplayTrace::open(const std::string &path)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            std::cerr << "[ReplayTrace] Cannot open " << path << std::endl;
+            return nullptr;
+        }
+
+        struct stat info{};
+        if (fstat(fd, &info) != 0)
+        {
+            close(fd);
+            return nullptr;
+        }
+
+        // An empty trace has nothing to map, and plays nothing
+        const char *data = nullptr;
+        size_t size = static_cast<size_t>(info.st_size);
+        if (size > 0)
+        {
+            void *map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map == MAP_FAILED)
+            {
+                close(fd);
+                std::cerr << "[ReplayTrace] Cannot map " << path << std::endl;
+                return nullptr;
+            }
+            madvise(map, size, MADV_SEQUENTIAL);
+            data = static_cast<const char *>(map);
+        }
+        close(fd); // the mapping keeps the file
+
+        return std::shared_ptr<const ReplayTrace>(new ReplayTrace(path, data, size));
+    }
+
+    ReplayTrace::ReplayTrace(std::string path, const char *data, size_t size)
+        : m_path{std::move(path)}, m_data{data}, m_size{size}, m_format{ReplayFormat::Text}
+    {
+        if (m_size >= sizeof(ReplayBinaryMagic) &&
+            std::memcmp(m_data, ReplayBinaryMagic, sizeof(ReplayBinaryMagic)) == 0)
+        {
+            m_format = ReplayFormat::Binary;
+        }
+    }
+
+    ReplayTrace::~ReplayTrace()
+    {
+        if (m_data != nullptr)
+        {
+            munmap(const_cast<char *>(m_data), m_size);
+        }
+    }
+
+    size_t ReplayTrace::begin() const
+    {
+        return m_format == ReplayFormat::Binary ? sizeof(ReplayBinaryMagic) : 0;
+    }
+
+    bool ReplayTrace::next(size_t &offset, uint64_t &timeUs, std::string_view &sample) const
+    {
+        if (m_format == ReplayFormat::Binary)
+        {
+            return nextBinary(offset, timeUs, sample);
+        }
+        return nextText(offset, timeUs, sample);
+    }
+
+    bool ReplayTrace::nextText(size_t &offset, uint64_t &timeUs, std::string_view &sample) const
+    {
+        while (offset < m_size)
+        {
+            const char *line = m_data + offset;
+            const char *end = m_data + m_size;
+            const char *newline = static_cast<const char *>(std::memchr(line, '\n', static_cast<size_t>(end - line)));
+            const char *lineEnd = newline != nullptr ? newline : end;
+            offset = static_cast<size_t>(lineEnd - m_data) + (newline != nullptr ? 1 : 0);
+
+            if (lineEnd > line && lineEnd[-1] == '\r')
+            {
+                --lineEnd;
+            }
+            if (line == lineEnd || *line == '#')
+            {
+                continue;
+            }
+
+            const char *pos = line;
+            if (!scanUnsigned(pos, lineEnd, timeUs) || pos == lineEnd || (*pos != ' ' && *pos != '\t'))
+            {
+                continue; // no timestamp or no sample
+            }
+            while (pos < lineEnd && (*pos == ' ' || *pos == '\t'))
+            {
+                ++pos;
+            }
+            sample = std::string_view(pos, static_cast<size_t>(lineEnd - pos));
+            return true;
+        }
+        return false;
+    }
+
+    bool ReplayTrace::nextBinary(size_t &offset, uint64_t &timeUs, std::string_view &sample) const
+    {
+        if (offset + ReplayRecordHeaderSize > m_size)
+        {
+            return false;
+        }
+        uint32_t length;
+        std::memcpy(&timeUs, m_data + offset, sizeof(timeUs));
+        std::memcpy(&length, m_data + offset + sizeof(timeUs), sizeof(length));
+        if (length > m_size - offset - ReplayRecordHeaderSize)
+        {
+            return false; // truncated while recording
+        }
+        sample = std::string_view(m_data + offset + ReplayRecordHeaderSize, length);
+        offset += ReplayRecordHeaderSize + length;
+        return true;
+    }
+
+    ReplayFormat ReplayTrace::getFormat() const
+    {
+        return m_format;
+    }
+
+    const std::string &ReplayTrace::getPath() const
+    {
+        return m_path;
+    }
+
+    size_t ReplayTrace::getSize() const
+    {
+        return m_size;
+    }
+
+    void ReplayTrace::appendBinaryRecord(std::string &out, uint64_t timeUs, std::string_view sample)
+    {
+        uint32_t length = static_cast<uint32_t>(sample.size());
+        char header[ReplayRecordHeaderSize];
+        std::memcpy(header, &timeUs, sizeof(timeUs));
+        std::memcpy(header + sizeof(timeUs), &length, sizeof(length));
+        out.append(header, sizeof(header));
+        out.append(sample);
+    }
+
+} // namespace SmartDataHub
@@ -1,6 +1,10 @@
 #include "SafeFile.hpp"
 #include <iostream>
 #include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <climits> // IOV_MAX
+#include <cstring>
 
 constexpr int openFlag = O_RDWR;
 SmartDataHub::SafeFile::SafeFile(const std::string &_path)
@@ -8,9 +12,12 @@ SmartDataHub::SafeFile::SafeFile(const std::string &_path)
     SmartDataHub::SafeFile::openFile(_path.c_str(), openFlag);
 }
 
-SmartDataHub::SafeFile::SafeFile(SafeFile &&other) noexcept : _fd{other._fd} 
+SmartDataHub::SafeFile::SafeFile(SafeFile &&other) noexcept
+    : _fd{other._fd}, _readBuf{std::move(other._readBuf)}, _readPos{other._readPos}, _readEnd{other._readEnd},
+      _snapshotBuf{std::move(other._snapshotBuf)}
 {
     other._fd = -1;
+    other.resetReadBuffer();
 }
 SmartDataHub::SafeFile &SmartDataHub::SafeFile::operator=(SafeFile &&other) noexcept
 {
@@ -19,7 +26,12 @@ SmartDataHub::SafeFile &SmartDataHub::SafeFile::operator=(SafeFile &&other) noex
     {
         closeFile();
         this->_fd = other._fd;
+        this->_readBuf = std::move(other._readBuf);
+        this->_readPos = other._readPos;
+        this->_readEnd = other._readEnd;
+        this->_snapshotBuf = std::move(other._snapshotBuf);
         other._fd = -1;
+        other.resetReadBuffer();
     }
 
     return *this;
@@ -32,7 +44,7 @@ bool SmartDataHub::SafeFile::openFile(const char *_path, const int &flags)
     {
         closeFile();
     }
-    _fd = open(_path, flags);
+    _fd = open(_path, flags, 0644);
     if (_fd < 0)
     {
         std::cerr << "Can open the file with fd= " << _fd << std::endl;
@@ -44,63 +56,283 @@ bool SmartDataHub::SafeFile::openFile(const char *_path, const int &flags)
     }
 }
 
-constexpr uint8_t NoOfChar = 1;
-constexpr uint8_t InitValueForNoOFBytes = 1;
+constexpr size_t ReadChunkSize = 4096;
+// writev() calls with up to this many buffers need no heap allocation
+constexpr size_t MaxInlineBuffers = 8;
 
-bool SmartDataHub::SafeFile::readline(std::string &line)
+void SmartDataHub::SafeFile::resetReadBuffer()
+{
+    _readPos = 0;
+    _readEnd = 0;
+}
+
+// Appends one read() worth of data, compacting or growing the buffer
+// so there is always room. NoOfBytes is the read() result.
+bool SmartDataHub::SafeFile::fillReadBuffer(ssize_t &NoOfBytes)
+{
+    if (_readPos > 0)
+    {
+        std::memmove(_readBuf.data(), _readBuf.data() + _readPos, _readEnd - _readPos);
+        _readEnd -= _readPos;
+        _readPos = 0;
+    }
+    if (_readBuf.size() - _readEnd < ReadChunkSize)
+    {
+        _readBuf.resize(_readBuf.size() + ReadChunkSize);
+    }
+
+    do
+    {
+        NoOfBytes = read(_fd, _readBuf.data() + _readEnd, _readBuf.size() - _readEnd);
+    } while (NoOfBytes == -1 && errno == EINTR);
+
+    if (NoOfBytes > 0)
+    {
+        _readEnd += static_cast<size_t>(NoOfBytes);
+    }
+    return NoOfBytes >= 0;
+}
+
+bool SmartDataHub::SafeFile::readline(std::string_view &line)
 {
+    if (!SmartDataHub::SafeFile::isOpen())
+    {
+        std::cerr << "ERROR: The File did not open\n";
+        return false;
+    }
 
-    if (SmartDataHub::SafeFile::isOpen())
+    size_t scanFrom = _readPos;
+    while (true)
     {
+        const char *begin = _readBuf.data() + _readPos;
+        const void *newline = nullptr;
+        if (scanFrom < _readEnd)
+        {
+            newline = std::memchr(_readBuf.data() + scanFrom, '\n', _readEnd - scanFrom);
+        }
+        if (newline != nullptr)
+        {
+            size_t length = static_cast<const char *>(newline) - begin;
+            line = std::string_view(begin, length);
+            _readPos += length + 1;
+            return true;
+        }
 
-        std::string result = "";
-        char ch;
+        // Only the new bytes need scanning after a refill
+        size_t scanned = _readEnd - _readPos;
         ssize_t NoOfBytes;
-        while ((NoOfBytes = read(_fd, &ch, 1)) > 0)
+        if (!fillReadBuffer(NoOfBytes))
+        {
+            std::cerr << "ERROR: failed to capture data from file\n";
+            return false;
+        }
+        scanFrom = _readPos + scanned;
+
+        if (NoOfBytes == 0)
         {
-            if (ch == '\n')
-                break; // Stop at newline
-            result += ch;
+            // End of file: hand out a final unterminated line, if any
+            if (_readEnd == _readPos)
+            {
+                line = std::string_view();
+                return false;
+            }
+            line = std::string_view(_readBuf.data() + _readPos, _readEnd - _readPos);
+            _readPos = _readEnd;
+            return true;
         }
+    }
+}
+
+bool SmartDataHub::SafeFile::readSnapshot(std::string_view &content)
+{
+    if (!SmartDataHub::SafeFile::isOpen())
+    {
+        std::cerr << "ERROR: The File did not open\n";
+        return false;
+    }
+    if (_snapshotBuf.empty())
+    {
+        _snapshotBuf.resize(ReadChunkSize);
+    }
+
+    while (true)
+    {
+        // procfs generates the content per read, so a partial snapshot is
+        // discarded and the whole file is fetched again with more room
+        size_t total = 0;
+        ssize_t NoOfBytes;
+        do
+        {
+            NoOfBytes = pread(_fd, _snapshotBuf.data() + total, _snapshotBuf.size() - total,
+                              static_cast<off_t>(total));
+            if (NoOfBytes > 0)
+            {
+                total += static_cast<size_t>(NoOfBytes);
+            }
+        } while ((NoOfBytes > 0 && total < _snapshotBuf.size()) || (NoOfBytes == -1 && errno == EINTR));
+
         if (NoOfBytes == -1)
         {
             std::cerr << "ERROR: failed to capture data from file\n";
             return false;
         }
-        else
+        if (total < _snapshotBuf.size())
         {
-            line = result;
+            content = std::string_view(_snapshotBuf.data(), total);
             return true;
         }
+        _snapshotBuf.resize(_snapshotBuf.size() * 2);
     }
-    else
+}
+
+bool SmartDataHub::SafeFile::readline(std::string &line)
+{
+    std::string_view view;
+    if (!readline(view))
     {
-        std::cerr << "ERROR: The File did not open\n";
         return false;
     }
+    line.assign(view.data(), view.size());
+    return true;
+}
+
+bool SmartDataHub::SafeFile::writeline(const std::string &line)
+{
+    return writeAll(line);
 }
 
-bool SmartDataHub::SafeFile::writeline(std::string &line)
+bool SmartDataHub::SafeFile::writeAll(std::string_view data)
 {
-    int NoOfBytes;
-    if (SmartDataHub::SafeFile::isOpen())
+    struct iovec buffer;
+    buffer.iov_base = const_cast<char *>(data.data());
+    buffer.iov_len = data.size();
+    return writev(&buffer, 1);
+}
+
+bool SmartDataHub::SafeFile::writev(const struct iovec *buffers, int count)
+{
+    if (!SmartDataHub::SafeFile::isOpen())
+    {
+        std::cerr << "ERROR: The File did not open\n";
+        return false;
+    }
+    if (count < 0 || count > IOV_MAX)
+    {
+        std::cerr << "ERROR: Too many buffers for one write\n";
+        return false;
+    }
+
+    // Private copy so a short write can advance through the buffers
+    struct iovec pending[MaxInlineBuffers];
+    std::vector<struct iovec> heapPending;
+    struct iovec *iov = pending;
+    if (count > static_cast<int>(MaxInlineBuffers))
+    {
+        heapPending.assign(buffers, buffers + count);
+        iov = heapPending.data();
+    }
+    else
+    {
+        std::copy(buffers, buffers + count, pending);
+    }
+
+    while (count > 0)
     {
-        for (char c : line)
+        // Skip buffers that are already done (or were empty)
+        if (iov->iov_len == 0)
+        {
+            ++iov;
+            --count;
+            continue;
+        }
+
+        ssize_t NoOfBytes = ::writev(_fd, iov, count);
+        if (NoOfBytes < 0)
         {
-            NoOfBytes = write(_fd, &c, NoOfChar);
-            if (NoOfBytes < 0)
+            if (errno == EINTR)
             {
-                std::cerr << "ERROR: Cannot write to the file\n";
-                return false;
+                continue;
             }
+            std::cerr << "ERROR: Cannot write to the file\n";
+            return false;
+        }
+
+        size_t written = static_cast<size_t>(NoOfBytes);
+        while (count > 0 && written >= iov->iov_len)
+        {
+            written -= iov->iov_len;
+            ++iov;
+            --count;
+        }
+        if (count > 0)
+        {
+            iov->iov_base = static_cast<char *>(iov->iov_base) + written;
+            iov->iov_len -= written;
         }
-        return true;
     }
-    else
+    return true;
+}
+
+bool SmartDataHub::SafeFile::writev(std::initializer_list<std::string_view> buffers)
+{
+    if (buffers.size() > MaxInlineBuffers)
+    {
+        std::vector<struct iovec> iov;
+        iov.reserve(buffers.size());
+        for (std::string_view buffer : buffers)
+        {
+            iov.push_back({const_cast<char *>(buffer.data()), buffer.size()});
+        }
+        return writev(iov.data(), static_cast<int>(iov.size()));
+    }
+
+    struct iovec iov[MaxInlineBuffers];
+    int count = 0;
+    for (std::string_view buffer : buffers)
+    {
+        iov[count].iov_base = const_cast<char *>(buffer.data());
+        iov[count].iov_len = buffer.size();
+        ++count;
+    }
+    return writev(iov, count);
+}
+
+bool SmartDataHub::SafeFile::appendLine(std::string_view line)
+{
+    return writev({line, std::string_view("\n", 1)});
+}
+
+bool SmartDataHub::SafeFile::setAtomicAppend(bool enable)
+{
+    if (!SmartDataHub::SafeFile::isOpen())
     {
         std::cerr << "ERROR: The File did not open\n";
         return false;
     }
+
+    int flags = fcntl(_fd, F_GETFL);
+    if (flags == -1)
+    {
+        std::cerr << "ERROR: Cannot query file flags\n";
+        return false;
+    }
+    flags = enable ? (flags | O_APPEND) : (flags & ~O_APPEND);
+    if (fcntl(_fd, F_SETFL, flags) == -1)
+    {
+        std::cerr << "ERROR: Cannot change append mode\n";
+        return false;
+    }
+    return true;
+}
+
+bool SmartDataHub::SafeFile::isAtomicAppend() const
+{
+    if (!SmartDataHub::SafeFile::isOpen())
+    {
+        return false;
+    }
+    int flags = fcntl(_fd, F_GETFL);
+    return flags != -1 && (flags & O_APPEND) != 0;
 }
 
 bool SmartDataHub::SafeFile::isOpen() const
@@ -114,11 +346,12 @@ int SmartDataHub::SafeFile::getFd() const
 }
 void SmartDataHub::SafeFile::closeFile()
 {
-    if (_fd > 0)
+    if (_fd >= 0)
     {
         close(_fd);
         _fd = -1;
     }
+    resetReadBuffer();
 }
 
 void SmartDataHub::SafeFile::seekToBeginning()
@@ -126,6 +359,7 @@ void SmartDataHub::SafeFile::seekToBeginning()
     if (_fd >= 0)
     {
         lseek(_fd, 0, SEEK_SET);
+        resetReadBuffer();
     }
 }
 SmartDataHub::SafeFile::~SafeFile()
@@ -1,19 +1,76 @@
 #include <SafeSocket.hpp>
+#include <sys/stat.h> // lstat()
+#include <cerrno>
 
 namespace SmartDataHub
 {
+    namespace
+    {
+        // False (ENAMETOOLONG) if `path` does not fit sun_path with its
+        // terminator; strncpy would silently cut it to another path
+        bool makeAddress(const std::string &path, sockaddr_un &addr)
+        {
+            memset(&addr, 0, sizeof(addr));
+            addr.sun_family = AF_UNIX;
+            if (path.size() >= sizeof(addr.sun_path))
+            {
+                errno = ENAMETOOLONG;
+                return false;
+            }
+            memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+            return true;
+        }
+
+        // Removes a socket file nobody is bound to any more (left by a run
+        // that did not exit cleanly). Anything else at the path - a regular
+        // file, or the live socket of another instance - is left alone and
+        // reported as EADDRINUSE.
+        bool removeStaleSocket(const sockaddr_un &addr, int sockType)
+        {
+            struct stat info;
+            if (lstat(addr.sun_path, &info) != 0)
+            {
+                return errno == ENOENT;
+            }
+            if (!S_ISSOCK(info.st_mode))
+            {
+                errno = EADDRINUSE;
+                return false;
+            }
+
+            int probe = socket(AF_UNIX, sockType | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+            if (probe < 0)
+            {
+                return false;
+            }
+            int result = connect(probe, reinterpret_cast<const sockaddr *>(&addr), sizeof(addr));
+            int error = errno;
+            close(probe);
+            if (result == 0 || error != ECONNREFUSED)
+            {
+                errno = EADDRINUSE;
+                return false;
+            }
+            return unlink(addr.sun_path) == 0 || errno == ENOENT;
+        }
+    } // namespace
 
     // Rule of 5
-    SafeSocket::SafeSocket(SafeSocket &&other) noexcept : sockfd{other.sockfd}
+    SafeSocket::SafeSocket(SafeSocket &&other) noexcept
+        : sockfd{other.sockfd}, kind{other.kind}, boundPath{std::move(other.boundPath)}
     {
         other.sockfd = -1;   
+        other.boundPath.clear();
     }
     SafeSocket& SafeSocket::operator=(SafeSocket &&other) noexcept 
     {
         if(this != &other){
             closeSocket();
             this->sockfd = other.sockfd;
+            this->kind = other.kind;
+            this->boundPath = std::move(other.boundPath);
             other.sockfd = -1;
+            other.boundPath.clear();
         }
         return *this;
     }
@@ -23,9 +80,20 @@ namespace SmartDataHub
     }
 
     // Operations
-    bool SafeSocket::createSocket()
+    bool SafeSocket::createSocket(SocketKind type)
     {
-        sockfd = socket(AF_UNIX, SOCK_NONBLOCK | SOCK_STREAM, 0);
+        closeSocket();
+        kind = type;
+        int sockType = SOCK_STREAM;
+        if (type == SocketKind::SeqPacket)
+        {
+            sockType = SOCK_SEQPACKET;
+        }
+        else if (type == SocketKind::Datagram)
+        {
+            sockType = SOCK_DGRAM;
+        }
+        sockfd = socket(AF_UNIX, SOCK_NONBLOCK | SOCK_CLOEXEC | sockType, 0);
         return sockfd >= 0;
     }
 
@@ -33,14 +101,61 @@ namespace SmartDataHub
     {
         // setup address
         sockaddr_un addr;
-        // remove garbage ==> clean up the structure
-        memset(&addr, 0, sizeof(addr));
-        addr.sun_family = AF_UNIX;
-        strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+        if (!makeAddress(path, addr))
+        {
+            return false;
+        }
         int result = connect(sockfd, (sockaddr *)&addr, sizeof(addr));
         return result == 0;
     } // Connects to server
 
+    bool SafeSocket::bindSocket(const std::string &path)
+    {
+        sockaddr_un addr;
+        if (!makeAddress(path, addr))
+        {
+            return false;
+        }
+
+        // A stale socket file from an earlier run would make bind() fail
+        int sockType = 0;
+        socklen_t length = sizeof(sockType);
+        if (getsockopt(sockfd, SOL_SOCKET, SO_TYPE, &sockType, &length) != 0 ||
+            !removeStaleSocket(addr, sockType))
+        {
+            return false;
+        }
+        if (bind(sockfd, (sockaddr *)&addr, sizeof(addr)) != 0)
+        {
+            return false;
+        }
+        boundPath = path;
+        return true;
+    } // Binds a receiving address
+
+    bool SafeSocket::listenSocket(const std::string &path, int backlog)
+    {
+        return bindSocket(path) && listen(sockfd, backlog) == 0;
+    } // Binds and listens for connections
+
+    bool SafeSocket::acceptConnection(SafeSocket &client)
+    {
+        int fd;
+        do
+        {
+            fd = accept4(sockfd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        } while (fd < 0 && errno == EINTR);
+
+        if (fd < 0)
+        {
+            return false;
+        }
+        client.closeSocket();
+        client.sockfd = fd;
+        client.kind = kind;
+        return true;
+    } // Accepts one pending connection
+
     ssize_t SafeSocket::sendData(const std::string &data)
     {
         return send(sockfd, data.c_str(), data.size(), 0);
@@ -51,18 +166,48 @@ namespace SmartDataHub
         ssize_t NoOfBytes = recv(sockfd, buffer, sizeof(buffer)-1, 0);
         if (NoOfBytes > 0)
         {
-            buffer[NoOfBytes] = '\0';
-            data = buffer;
+            data.assign(buffer, static_cast<size_t>(NoOfBytes));
         }
         return NoOfBytes;
 
     } // Receives data
+
+    ssize_t SafeSocket::receiveInto(char *buffer, size_t length)
+    {
+        ssize_t NoOfBytes;
+        do
+        {
+            NoOfBytes = recv(sockfd, buffer, length, 0);
+        } while (NoOfBytes < 0 && errno == EINTR);
+        return NoOfBytes;
+    } // Receives data without an intermediate copy
+
+    int SafeSocket::receiveBatch(MessageBatch &batch)
+    {
+        batch.clear();
+        int received;
+        do
+        {
+            received = recvmmsg(sockfd, batch.data(), batch.capacity(), MSG_DONTWAIT, nullptr);
+        } while (received < 0 && errno == EINTR);
+
+        if (received > 0)
+        {
+            batch.setReceived(static_cast<size_t>(received));
+        }
+        return received;
+    } // Receives up to batch.capacity() messages
     void SafeSocket::closeSocket()
     {
         if(sockfd >= 0){
             close(sockfd);
             sockfd = -1;
         }
+        if (!boundPath.empty())
+        {
+            unlink(boundPath.c_str());
+            boundPath.clear();
+        }
         
     } // Closes socket
 
@@ -72,5 +217,17 @@ namespace SmartDataHub
     int SafeSocket::getFd() const{
         return sockfd;
     }
+    SocketKind SafeSocket::getKind() const{
+        return kind;
+    }
+    int SafeSocket::getPeerPid() const{
+        ucred credentials{};
+        socklen_t length = sizeof(credentials);
+        if (getsockopt(sockfd, SOL_SOCKET, SO_PEERCRED, &credentials, &length) != 0)
+        {
+            return -1;
+        }
+        return credentials.pid;
+    }
 
 }
\ No newline at end of file
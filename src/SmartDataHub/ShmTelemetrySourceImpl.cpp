@@ -0,0 +1,265 @@
+#include "ShmTelemetrySourceImpl.hpp"
+#include <fcntl.h>    // O_CREAT
+#include <sys/mman.h> // shm_open(), mmap()
+#include <unistd.h>   // ftruncate(), close()
+#include <cstring>
+#include <iostream>
+#include <new>
+
+namespace SmartDataHub
+{
+
+    namespace
+    {
+        constexpr size_t MinCapacity = 4096;
+
+        size_t roundUpToPowerOfTwo(size_t value)
+        {
+            size_t capacity = MinCapacity;
+            while (capacity < value)
+            {
+                capacity <<= 1;
+            }
+            return capacity;
+        }
+    } // namespace
+
+    ShmTelemetrySourceImpl::ShmTelemetrySourceImpl(const std::string &name, size_t capacity)
+        : m_name{name}, m_capacity{roundUpToPowerOfTwo(capacity)}
+    {
+    }
+
+    ShmTelemetrySourceImpl::~ShmTelemetrySourceImpl()
+    {
+        closeRing();
+    }
+
+    void ShmTelemetrySourceImpl::closeRing()
+    {
+        if (m_map != nullptr)
+        {
+            munmap(m_map, m_mapSize);
+            m_map = nullptr;
+            shm_unlink(m_name.c_str());
+        }
+        if (m_fd >= 0)
+        {
+            close(m_fd);
+            m_fd = -1;
+        }
+        m_header = nullptr;
+        m_data = nullptr;
+    }
+
+    bool ShmTelemetrySourceImpl::openSource()
+    {
+        closeRing();
+
+        // A ring left behind by a previous run has a stale writer position
+        shm_unlink(m_name.c_str());
+        m_fd = shm_open(m_name.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0600);
+        if (m_fd < 0)
+        {
+            return false;
+        }
+
+        m_mapSize = ShmRingDataOffset + m_capacity;
+        if (ftruncate(m_fd, static_cast<off_t>(m_mapSize)) != 0)
+        {
+            close(m_fd);
+            m_fd = -1;
+            shm_unlink(m_name.c_str());
+            return false;
+        }
+
+        m_map = mmap(nullptr, m_mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+        if (m_map == MAP_FAILED)
+        {
+            m_map = nullptr;
+            close(m_fd);
+            m_fd = -1;
+            shm_unlink(m_name.c_str());
+            return false;
+        }
+
+        // ftruncate zero-fills, so the atomics start at 0; magic goes last
+        m_header = new (m_map) ShmRingHeader;
+        m_header->head.store(0, std::memory_order_relaxed);
+        m_header->tail.store(0, std::memory_order_relaxed);
+        m_header->readerWaiting.store(0, std::memory_order_relaxed);
+        m_header->wakeSequence.store(0, std::memory_order_relaxed);
+        m_header->version = ShmRingVersion;
+        m_header->capacity = m_capacity;
+        std::atomic_thread_fence(std::memory_order_release);
+        m_header->magic = ShmRingMagic;
+
+        m_data = static_cast<const char *>(m_map) + ShmRingDataOffset;
+        m_corrupt = false;
+        m_readPos = 0;
+        m_cachedHead = 0;
+        return true;
+    }
+
+    bool ShmTelemetrySourceImpl::nextRecord(std::string_view &record)
+    {
+        for (;;)
+        {
+            if (m_readPos == m_cachedHead)
+            {
+                m_cachedHead = m_header->head.load(std::memory_order_acquire);
+                if (m_readPos == m_cachedHead)
+                {
+                    return false;
+                }
+            }
+
+            // The writer is another process: nothing it stores may take a
+            // view outside the data area
+            uint64_t offset = m_readPos & (m_capacity - 1);
+            if (m_cachedHead - m_readPos > m_capacity || m_capacity - offset < ShmRingLengthSize)
+            {
+                markCorrupt("head out of range");
+                return false;
+            }
+            uint32_t length;
+            std::memcpy(&length, m_data + offset, sizeof(length));
+            if (length == ShmRingWrapMarker)
+            {
+                m_readPos += m_capacity - offset;
+                continue;
+            }
+            if (length > m_capacity - offset - ShmRingLengthSize)
+            {
+                markCorrupt("record length out of range");
+                return false;
+            }
+
+            record = std::string_view(m_data + offset + ShmRingLengthSize, length);
+            m_readPos += shmRingRecordSize(length);
+            return true;
+        }
+    }
+
+    void ShmTelemetrySourceImpl::markCorrupt(const char *reason)
+    {
+        // Views handed out before this one are still in use: the ring is
+        // closed on the next read or wait, which releases them
+        if (!m_corrupt)
+        {
+            std::cerr << "[ShmTelemetrySourceImpl] " << m_name << ": ring corrupt (" << reason << " at position "
+                      << m_readPos << "), closing it" << std::endl;
+        }
+        m_corrupt = true;
+    }
+
+    bool ShmTelemetrySourceImpl::closeIfCorrupt()
+    {
+        if (m_corrupt && m_header != nullptr)
+        {
+            closeRing();
+        }
+        return m_header == nullptr;
+    }
+
+    void ShmTelemetrySourceImpl::releaseRecords()
+    {
+        if (m_header != nullptr)
+        {
+            m_header->tail.store(m_readPos, std::memory_order_release);
+        }
+    }
+
+    bool ShmTelemetrySourceImpl::readRecord(std::string_view &record)
+    {
+        if (closeIfCorrupt())
+        {
+            return false;
+        }
+        releaseRecords();
+        return nextRecord(record);
+    }
+
+    size_t ShmTelemetrySourceImpl::readRecords(std::vector<std::string_view> &records)
+    {
+        if (closeIfCorrupt())
+        {
+            return 0;
+        }
+        releaseRecords();
+
+        size_t added = 0;
+        std::string_view record;
+        while (nextRecord(record))
+        {
+            records.push_back(record);
+            ++added;
+        }
+        return added;
+    }
+
+    bool ShmTelemetrySourceImpl::readSource(std::string &out)
+    {
+        std::string_view record;
+        if (!readRecord(record))
+        {
+            return false;
+        }
+        out.assign(record.data(), record.size());
+        releaseRecords();
+        return true;
+    }
+
+    bool ShmTelemetrySourceImpl::hasPendingData() const
+    {
+        return m_header != nullptr && !m_corrupt && m_header->head.load(std::memory_order_acquire) != m_readPos;
+    }
+
+    bool ShmTelemetrySourceImpl::waitForData(int timeoutMs)
+    {
+        if (closeIfCorrupt())
+        {
+            return false;
+        }
+        if (hasPendingData())
+        {
+            return true;
+        }
+
+        // The writer only wakes a reader whose published tail equals the
+        // head it overwrote, so everything consumed must be published first
+        releaseRecords();
+        uint32_t sequence = m_header->wakeSequence.load(std::memory_order_seq_cst);
+        m_header->readerWaiting.store(1, std::memory_order_seq_cst);
+        if (m_header->head.load(std::memory_order_seq_cst) == m_readPos)
+        {
+            timespec timeout;
+            timeout.tv_sec = timeoutMs / 1000;
+            timeout.tv_nsec = static_cast<long>(timeoutMs % 1000) * 1000000L;
+            shmRingFutexWait(m_header->wakeSequence, sequence, &timeout);
+        }
+        m_header->readerWaiting.store(0, std::memory_order_relaxed);
+        return hasPendingData();
+    }
+
+    // Utilities
+    bool ShmTelemetrySourceImpl::isOpen() const
+    {
+        return m_header != nullptr;
+    }
+
+    bool ShmTelemetrySourceImpl::isCorrupt() const
+    {
+        return m_corrupt;
+    }
+
+    const std::string &ShmTelemetrySourceImpl::getName() const
+    {
+        return m_name;
+    }
+
+    size_t ShmTelemetrySourceImpl::getCapacity() const
+    {
+        return m_capacity;
+    }
+
+} // namespace SmartDataHub
@@ -1,24 +1,227 @@
 #include "SocketTelemetrySourceImpl.hpp"
+#include <cerrno>
 
 namespace SmartDataHub
 {
-    SocketTelemetrySourceImpl::SocketTelemetrySourceImpl(const std::string &path) : m_socketpath{path}
+    // recv() size when the buffer has no bigger hole to offer
+    constexpr size_t ReceiveChunkSize = 16 * 1024;
+
+    SocketTelemetrySourceImpl::SocketTelemetrySourceImpl(const std::string &path, FramingMode framing,
+                                                         size_t maxFrameSize)
+        : m_socketpath{path}, m_frames{framing, maxFrameSize}
+    {
+    }
+    SocketTelemetrySourceImpl::SocketTelemetrySourceImpl(const std::string &path, SocketKind kind,
+                                                         size_t batchSize, size_t maxMessageSize)
+        : m_socketpath{path}, m_frames{FramingMode::Raw}, m_kind{kind}
     {
+        if (kind != SocketKind::Stream)
+        {
+            m_batch.emplace(batchSize, maxMessageSize);
+        }
     }
     bool SocketTelemetrySourceImpl::openSource()
     {
-        if (!m_socket.createSocket())
+        m_frames.reset();
+        m_peerClosed = false;
+        m_batchPos = 0;
+        if (m_batch)
+        {
+            m_batch->clear();
+        }
+        if (!m_socket.createSocket(m_kind))
         {
             return false;
         }
+        if (m_kind == SocketKind::Datagram)
+        {
+            return m_socket.bindSocket(m_socketpath);
+        }
         return m_socket.connectSocket(m_socketpath);
     }
+
+    bool SocketTelemetrySourceImpl::receiveChunk()
+    {
+        if (m_frames.isCorrupt())
+        {
+            return false;
+        }
+        char *space = m_frames.prepareWrite(ReceiveChunkSize);
+        ssize_t bytes = m_socket.receiveInto(space, m_frames.writableSize());
+        if (bytes == 0)
+        {
+            m_peerClosed = true;
+        }
+        if (bytes <= 0)
+        {
+            return false;
+        }
+        m_frames.commit(static_cast<size_t>(bytes));
+        return true;
+    }
+
+    bool SocketTelemetrySourceImpl::receiveMessages()
+    {
+        m_batchPos = 0;
+        if (m_peerClosed || m_socket.receiveBatch(*m_batch) <= 0)
+        {
+            m_batch->clear();
+            return false;
+        }
+
+        if (m_kind == SocketKind::SeqPacket)
+        {
+            // End of stream shows up as zero-length messages
+            for (size_t i = 0; i < m_batch->size(); ++i)
+            {
+                if ((*m_batch)[i].empty())
+                {
+                    m_batch->setReceived(i);
+                    m_peerClosed = true;
+                    break;
+                }
+            }
+        }
+        return !m_batch->empty();
+    }
+
     bool SocketTelemetrySourceImpl::readSource(std::string &out)
     {
         if(!m_socket.isConnected()){
             return false;
         }
-        int bytes = m_socket.receiveData(out);
-        return bytes > 0 ;
+
+        if (m_batch)
+        {
+            if (m_batchPos >= m_batch->size() && !receiveMessages())
+            {
+                return false;
+            }
+            std::string_view message = (*m_batch)[m_batchPos++];
+            out.assign(message.data(), message.size());
+            return true;
+        }
+
+        std::string_view frame;
+        if (!m_frames.nextFrame(frame))
+        {
+            if (!receiveChunk() || !m_frames.nextFrame(frame))
+            {
+                return false;
+            }
+        }
+        out.assign(frame.data(), frame.size());
+        return true;
+    }
+
+    size_t SocketTelemetrySourceImpl::readFrames(std::vector<std::string_view> &frames)
+    {
+        if (!m_socket.isConnected())
+        {
+            return 0;
+        }
+
+        if (m_batch)
+        {
+            // Hand out what readSource() left over before receiving over it
+            if (m_batchPos >= m_batch->size())
+            {
+                receiveMessages();
+            }
+            size_t added = m_batch->size() - m_batchPos;
+            for (; m_batchPos < m_batch->size(); ++m_batchPos)
+            {
+                frames.push_back((*m_batch)[m_batchPos]);
+            }
+            return added;
+        }
+
+        // Receiving may move the buffer, so it happens before any view is taken
+        receiveChunk();
+
+        size_t added = 0;
+        std::string_view frame;
+        while (m_frames.nextFrame(frame))
+        {
+            frames.push_back(frame);
+            ++added;
+        }
+        return added;
+    }
+
+    bool SocketTelemetrySourceImpl::prepareRead(ReadRequest &request)
+    {
+        // A buffered frame needs no I/O; message kinds use recvmmsg()
+        if (m_batch || !m_socket.isConnected() || m_peerClosed || m_frames.isCorrupt() ||
+            m_frames.hasCompleteFrame())
+        {
+            return false;
+        }
+        request.fd = m_socket.getFd();
+        request.buffer = m_frames.prepareWrite(ReceiveChunkSize);
+        request.length = m_frames.writableSize();
+        request.offset = -1;
+        request.isSocket = true;
+        return true;
+    }
+
+    bool SocketTelemetrySourceImpl::completeRead(int result, std::string &out)
+    {
+        if (result == 0)
+        {
+            m_peerClosed = true;
+        }
+        if (result < 0 && result != -EAGAIN)
+        {
+            // The batched recv failed: the plain one reports why
+            return readSource(out);
+        }
+        if (result <= 0)
+        {
+            return false;
+        }
+        m_frames.commit(static_cast<size_t>(result));
+
+        std::string_view frame;
+        if (!m_frames.nextFrame(frame))
+        {
+            return false;
+        }
+        out.assign(frame.data(), frame.size());
+        return true;
+    }
+
+    int SocketTelemetrySourceImpl::getPollFd() const
+    {
+        return m_socket.getFd();
+    }
+
+    bool SocketTelemetrySourceImpl::hasPendingData() const
+    {
+        if (m_batch)
+        {
+            return m_batchPos < m_batch->size();
+        }
+        return m_frames.hasCompleteFrame();
+    }
+
+    bool SocketTelemetrySourceImpl::isClosed() const
+    {
+        return m_peerClosed || m_frames.isCorrupt();
+    }
+
+    bool SocketTelemetrySourceImpl::isPeerClosed() const
+    {
+        return m_peerClosed;
+    }
+
+    SocketKind SocketTelemetrySourceImpl::getKind() const
+    {
+        return m_kind;
+    }
+
+    bool SocketTelemetrySourceImpl::isCorrupt() const
+    {
+        return m_frames.isCorrupt();
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,371 @@
+#include "TelemetryIngestServer.hpp"
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/resource.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <iostream>
+
+namespace SmartDataHub
+{
+    constexpr int MaxEventsPerWait = 256;
+    // recv() size per wakeup; with FrameParser's 4 KiB minimum a steady
+    // connection keeps one 4 KiB buffer and only bursts grow it
+    constexpr size_t IngestReceiveSize = 2048;
+    constexpr size_t IngestSteadyBufferSize = 4096;
+    // How often a listener parked on EMFILE is tried again
+    constexpr std::chrono::milliseconds ListenerRetry{100};
+
+    TelemetryIngestServer::Connection::Connection(SafeSocket &&accepted, FramingMode framing,
+                                                  size_t maxFrameSize)
+        : socket{std::move(accepted)}, frames{framing, maxFrameSize}
+    {
+    }
+
+    TelemetryIngestServer::TelemetryIngestServer(const std::string &path, BatchHandler handler,
+                                                 FramingMode framing, IngestLimits limits)
+        : m_path{path}, m_framing{framing}, m_limits{limits}, m_handler{std::move(handler)}
+    {
+    }
+
+    TelemetryIngestServer::~TelemetryIngestServer()
+    {
+        stop();
+    }
+
+    void TelemetryIngestServer::setThreadStartHook(ThreadStartHook hook)
+    {
+        m_threadStartHook = std::move(hook);
+    }
+
+    bool TelemetryIngestServer::start()
+    {
+        if (m_running || !m_handler)
+        {
+            return false;
+        }
+
+        // Connections may take half the fds; sources, sinks and collectors
+        // need the rest
+        rlimit limit{};
+        if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY)
+        {
+            m_limits.maxConnections =
+                std::min(m_limits.maxConnections, std::max<size_t>(1, static_cast<size_t>(limit.rlim_cur / 2)));
+        }
+
+        if (!m_listener.createSocket(SocketKind::Stream) || !m_listener.listenSocket(m_path, m_limits.backlog))
+        {
+            std::cerr << "[TelemetryIngestServer] Cannot listen on " << m_path << std::endl;
+            m_listener.closeSocket();
+            return false;
+        }
+
+        m_epollFd = epoll_create1(EPOLL_CLOEXEC);
+        m_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+        m_listening = true;
+        bool registered = m_epollFd >= 0 && m_wakeFd >= 0 && openSpare();
+        for (int fd : {m_listener.getFd(), m_wakeFd})
+        {
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.fd = fd;
+            registered = registered && epoll_ctl(m_epollFd, EPOLL_CTL_ADD, fd, &event) == 0;
+        }
+        if (!registered)
+        {
+            std::cerr << "[TelemetryIngestServer] Cannot create epoll/eventfd" << std::endl;
+            m_running = true; // let stop() release what was created
+            stop();
+            return false;
+        }
+
+        m_running = true;
+        m_thread = std::thread(&TelemetryIngestServer::run, this);
+        return true;
+    }
+
+    void TelemetryIngestServer::stop()
+    {
+        if (!m_running.exchange(false))
+        {
+            return;
+        }
+
+        if (m_thread.joinable())
+        {
+            uint64_t one = 1;
+            ssize_t written = write(m_wakeFd, &one, sizeof(one));
+            (void)written; // counter overflow is impossible here
+            m_thread.join();
+        }
+
+        m_connections.clear();
+        m_batch.clear();
+        m_touched.clear();
+        m_active = 0;
+        m_listener.closeSocket();
+
+        if (m_wakeFd >= 0)
+        {
+            close(m_wakeFd);
+            m_wakeFd = -1;
+        }
+        if (m_spareFd >= 0)
+        {
+            close(m_spareFd);
+            m_spareFd = -1;
+        }
+        if (m_epollFd >= 0)
+        {
+            close(m_epollFd);
+            m_epollFd = -1;
+        }
+    }
+
+    void TelemetryIngestServer::acceptPending()
+    {
+        while (true)
+        {
+            SafeSocket client;
+            if (!m_listener.acceptConnection(client))
+            {
+                if (errno == EMFILE || errno == ENFILE)
+                {
+                    rejectPending();
+                }
+                return; // EAGAIN: backlog drained
+            }
+
+            // Accepting and closing keeps the backlog from filling up
+            if (m_connections.size() >= m_limits.maxConnections)
+            {
+                ++m_rejected;
+                continue;
+            }
+
+            int fd = client.getFd();
+            auto connection = std::make_unique<Connection>(std::move(client), m_framing, m_limits.maxFrameSize);
+            connection->identity = "pid:" + std::to_string(connection->socket.getPeerPid());
+
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.fd = fd;
+            if (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, fd, &event) != 0)
+            {
+                continue;
+            }
+
+            m_connections.emplace(fd, std::move(connection));
+            ++m_accepted;
+            ++m_active;
+        }
+    }
+
+    void TelemetryIngestServer::rejectPending()
+    {
+        // The spare fd makes room for one accept4() at a time
+        while (m_spareFd >= 0)
+        {
+            close(m_spareFd);
+            m_spareFd = -1;
+            SafeSocket client;
+            bool accepted = m_listener.acceptConnection(client);
+            int error = errno;
+            client.closeSocket();
+            openSpare();
+            if (!accepted)
+            {
+                if (error == EAGAIN || error == EWOULDBLOCK)
+                {
+                    return;
+                }
+                break;
+            }
+            ++m_rejected;
+        }
+        // Not even the spare is left: stop polling the listener for now
+        setListening(false);
+    }
+
+    bool TelemetryIngestServer::openSpare()
+    {
+        if (m_spareFd < 0)
+        {
+            m_spareFd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+        }
+        return m_spareFd >= 0;
+    }
+
+    void TelemetryIngestServer::setListening(bool listening)
+    {
+        if (listening == m_listening)
+        {
+            return;
+        }
+        epoll_event event{};
+        event.events = listening ? static_cast<uint32_t>(EPOLLIN) : 0u;
+        event.data.fd = m_listener.getFd();
+        if (epoll_ctl(m_epollFd, EPOLL_CTL_MOD, m_listener.getFd(), &event) == 0)
+        {
+            m_listening = listening;
+            m_parkedAt = std::chrono::steady_clock::now();
+        }
+    }
+
+    // HUP/ERR need no special case: recv() returns what is left, then 0 or the error
+    void TelemetryIngestServer::readConnection(Connection &connection)
+    {
+        char *space = connection.frames.prepareWrite(IngestReceiveSize);
+        ssize_t bytes = connection.socket.receiveInto(space, connection.frames.writableSize());
+        if (bytes > 0)
+        {
+            connection.frames.commit(static_cast<size_t>(bytes));
+        }
+        else if (bytes == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+        {
+            connection.closing = true;
+        }
+
+        uint64_t droppedBefore = connection.frames.getDroppedBytes();
+        std::string_view frame;
+        while (connection.frames.nextFrame(frame))
+        {
+            if (!connection.named)
+            {
+                connection.named = true;
+                if (!frame.empty() && frame.front() == IdentityPrefix)
+                {
+                    connection.identity.assign(frame.substr(1));
+                    continue;
+                }
+            }
+            m_batch.push_back({connection.identity, frame});
+        }
+        m_droppedBytes += connection.frames.getDroppedBytes() - droppedBefore;
+
+        if (connection.frames.isCorrupt())
+        {
+            ++m_corrupt;
+            connection.closing = true;
+        }
+        m_touched.push_back(&connection);
+    }
+
+    void TelemetryIngestServer::finishRound()
+    {
+        if (!m_batch.empty())
+        {
+            m_handler(m_batch);
+            m_samples += m_batch.size();
+            m_batch.clear();
+        }
+
+        // Only now are the views in the batch no longer needed
+        for (Connection *connection : m_touched)
+        {
+            if (connection->closing)
+            {
+                closeConnection(*connection);
+            }
+            else
+            {
+                connection->frames.shrinkIfIdle(IngestSteadyBufferSize);
+            }
+        }
+        m_touched.clear();
+    }
+
+    void TelemetryIngestServer::closeConnection(Connection &connection)
+    {
+        int fd = connection.socket.getFd();
+        epoll_ctl(m_epollFd, EPOLL_CTL_DEL, fd, nullptr);
+        m_connections.erase(fd); // SafeSocket closes the fd
+        --m_active;
+    }
+
+    void TelemetryIngestServer::run()
+    {
+        if (m_threadStartHook)
+        {
+            m_threadStartHook();
+        }
+
+        epoll_event events[MaxEventsPerWait];
+        while (m_running)
+        {
+            // A parked listener comes back once an fd (the spare) is free
+            if (!m_listening && std::chrono::steady_clock::now() - m_parkedAt >= ListenerRetry && openSpare())
+            {
+                setListening(true);
+            }
+            int ready = epoll_wait(m_epollFd, events, MaxEventsPerWait, m_listening ? -1 : static_cast<int>(ListenerRetry.count()));
+            if (ready < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                std::cerr << "[TelemetryIngestServer] epoll_wait failed" << std::endl;
+                break;
+            }
+
+            for (int i = 0; i < ready; ++i)
+            {
+                int fd = events[i].data.fd;
+                if (fd == m_wakeFd)
+                {
+                    uint64_t count = 0;
+                    ssize_t bytes = read(m_wakeFd, &count, sizeof(count));
+                    (void)bytes; // m_running is re-checked by the loop
+                }
+                else if (fd == m_listener.getFd())
+                {
+                    acceptPending();
+                }
+                else
+                {
+                    // Closing is deferred to finishRound(), so the entry exists
+                    auto found = m_connections.find(fd);
+                    if (found != m_connections.end())
+                    {
+                        readConnection(*found->second);
+                    }
+                }
+            }
+            finishRound();
+        }
+    }
+
+    bool TelemetryIngestServer::isRunning() const
+    {
+        return m_running;
+    }
+
+    IngestStats TelemetryIngestServer::getStats() const
+    {
+        IngestStats stats;
+        stats.accepted = m_accepted.load();
+        stats.rejected = m_rejected.load();
+        stats.active = m_active.load();
+        stats.samples = m_samples.load();
+        stats.corrupt = m_corrupt.load();
+        stats.droppedBytes = m_droppedBytes.load();
+        return stats;
+    }
+
+    const IngestLimits &TelemetryIngestServer::getLimits() const
+    {
+        return m_limits;
+    }
+
+    const std::string &TelemetryIngestServer::getPath() const
+    {
+        return m_path;
+    }
+
+} // namespace SmartDataHub
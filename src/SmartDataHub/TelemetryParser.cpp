@@ -1,7 +1,10 @@
 
 #include "TelemetryParser.hpp"
-#include <sstream>
-#include <iomanip>
+#include "ProcScan.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
 
 namespace SmartDataHub
 {
@@ -10,12 +13,12 @@ namespace SmartDataHub
 // CpuStats Helper Methods
 // ══════════════════════════════════════════════════════════════════════
 
-unsigned long long TelemetryParser::CpuStats::getTotal() const
+uint64_t TelemetryParser::CpuStats::getTotal() const
 {
     return user + nice + system + idle + iowait + irq + softirq + steal;
 }
 
-unsigned long long TelemetryParser::CpuStats::getIdle() const
+uint64_t TelemetryParser::CpuStats::getIdle() const
 {
     return idle + iowait;
 }
@@ -31,27 +34,155 @@ TelemetryParser::TelemetryParser()
     // Sources initialized with paths
 }
 
+TelemetryParser::TelemetryParser(std::string statPath, std::string memInfoPath)
+    : m_cpuSource(std::move(statPath)),
+      m_memSource(std::move(memInfoPath))
+{
+}
+
 // ══════════════════════════════════════════════════════════════════════
 // Private Helper Methods
 // ══════════════════════════════════════════════════════════════════════
 
-bool TelemetryParser::parseCpuLine(const std::string& line)
+bool TelemetryParser::ensureOpen(FileTelemetrySourceImpl& source)
 {
-    std::istringstream iss(line);
-    std::string cpuLabel;
+    return source.isOpen() || source.openSource();
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Scanners
+// ══════════════════════════════════════════════════════════════════════
 
+bool TelemetryParser::parseCpuLine(std::string_view line, CpuStats& stats) noexcept
+{
     // Parse: "cpu  user nice system idle iowait irq softirq steal"
-    iss >> cpuLabel
-        >> m_currCpu.user
-        >> m_currCpu.nice
-        >> m_currCpu.system
-        >> m_currCpu.idle
-        >> m_currCpu.iowait
-        >> m_currCpu.irq
-        >> m_currCpu.softirq
-        >> m_currCpu.steal;
+    std::size_t labelEnd = line.find(' ');
+    if (labelEnd == std::string_view::npos)
+    {
+        return false;
+    }
+    line.remove_prefix(labelEnd);
+
+    uint64_t fields[8];
+    if (scanFields(line, fields, 8) != 8)
+    {
+        return false;
+    }
+    stats.user = fields[0];
+    stats.nice = fields[1];
+    stats.system = fields[2];
+    stats.idle = fields[3];
+    stats.iowait = fields[4];
+    stats.irq = fields[5];
+    stats.softirq = fields[6];
+    stats.steal = fields[7];
+    return true;
+}
+
+bool TelemetryParser::parseMemInfo(std::string_view content, uint64_t& memTotal,
+                                   uint64_t& memAvailable) noexcept
+{
+    // Both are near the top and in this order
+    std::size_t from = 0;
+    return scanLabeledValue(content, from, "MemTotal:", memTotal) &&
+           scanLabeledValue(content, from, "MemAvailable:", memAvailable);
+}
+
+bool TelemetryParser::parseMemInfoFields(std::string_view content, MemFieldMask wanted, MemInfo& info) noexcept
+{
+    // One "Key:   value kB" per line
+    info.found = 0;
+    const char* pos = content.data();
+    const char* end = pos + content.size();
+    while (pos < end && info.found != wanted)
+    {
+        const char* lineEnd = static_cast<const char*>(std::memchr(pos, '\n', static_cast<std::size_t>(end - pos)));
+        if (lineEnd == nullptr)
+        {
+            lineEnd = end;
+        }
+
+        const char* colon = static_cast<const char*>(std::memchr(pos, ':', static_cast<std::size_t>(lineEnd - pos)));
+        MemField field = MemField::Count;
+        if (colon != nullptr &&
+            lookupMemField(std::string_view(pos, static_cast<std::size_t>(colon - pos)), field) &&
+            (wanted & memFieldBit(field)) != 0)
+        {
+            const char* valuePos = colon + 1;
+            uint64_t value = 0;
+            if (scanUnsigned(valuePos, lineEnd, value))
+            {
+                info.values[static_cast<std::size_t>(field)] = value;
+                info.found |= memFieldBit(field);
+            }
+        }
+        pos = lineEnd + 1;
+    }
+    return info.found == wanted;
+}
+
+std::size_t TelemetryParser::parsePerCore(std::string_view content, PerCoreCounters& counters)
+{
+    counters.core.clear();
+    counters.total.clear();
+    counters.idle.clear();
+
+    // The aggregate "cpu " line comes first, then one line per online core
+    std::size_t lineStart = content.find('\n');
+    while (lineStart != std::string_view::npos)
+    {
+        ++lineStart;
+        std::size_t lineEnd = content.find('\n', lineStart);
+        std::string_view line = content.substr(lineStart, lineEnd == std::string_view::npos
+                                                              ? std::string_view::npos
+                                                              : lineEnd - lineStart);
+        if (line.size() < 4 || line.compare(0, 3, "cpu") != 0)
+        {
+            break;
+        }
+
+        const char* pos = line.data() + 3;
+        uint64_t core = 0;
+        CpuStats stats;
+        if (!scanUnsigned(pos, line.data() + line.size(), core) || !parseCpuLine(line, stats))
+        {
+            break;
+        }
+        counters.core.push_back(static_cast<uint32_t>(core));
+        counters.total.push_back(stats.getTotal());
+        counters.idle.push_back(stats.getIdle());
+        lineStart = lineEnd;
+    }
+    return counters.size();
+}
+
+void TelemetryParser::computeUsage(const uint64_t* prevTotal, const uint64_t* prevIdle,
+                                   const uint64_t* currTotal, const uint64_t* currIdle,
+                                   float* usage, std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        // One interval's tick deltas fit in 32 bits, and int32 -> float
+        // converts in vector registers (uint64 needs AVX-512)
+        int32_t totalDelta = static_cast<int32_t>(currTotal[i] - prevTotal[i]);
+        int32_t idleDelta = static_cast<int32_t>(currIdle[i] - prevIdle[i]);
+        float busy = static_cast<float>(totalDelta - idleDelta);
+        float span = static_cast<float>(std::max(totalDelta, 1));
+
+        // iowait may run backwards, so clamp instead of branching
+        usage[i] = std::min(std::max(busy * 100.0f / span, 0.0f), 100.0f);
+    }
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Open
+// ══════════════════════════════════════════════════════════════════════
 
-    return !iss.fail();
+bool TelemetryParser::open()
+{
+    bool cpuOpen = ensureOpen(m_cpuSource);
+    bool memOpen = ensureOpen(m_memSource);
+    return cpuOpen && memOpen;
 }
 
 // ══════════════════════════════════════════════════════════════════════
@@ -60,24 +191,21 @@ bool TelemetryParser::parseCpuLine(const std::string& line)
 
 double TelemetryParser::getCpuUsage()
 {
-    // Open source fresh (values change constantly)
-    if (!m_cpuSource.openSource())
+    // Fd stays open; each sample is one pread of the whole file
+    std::string_view content;
+    if (!ensureOpen(m_cpuSource) || !m_cpuSource.readSnapshot(content))
     {
         return -1.0;  // Error
     }
 
-    // Read first line
-    std::string line;
-    if (!m_cpuSource.readSource(line))
-    {
-        return -1.0;  // Error
-    }
+    // Aggregate "cpu" line comes first
+    std::string_view line = content.substr(0, content.find('\n'));
 
     // Save previous stats
     m_prevCpu = m_currCpu;
 
     // Parse new stats
-    if (!parseCpuLine(line))
+    if (!parseCpuLine(line, m_currCpu))
     {
         return -1.0;  // Parse error
     }
@@ -90,8 +218,8 @@ double TelemetryParser::getCpuUsage()
     }
 
     // Calculate usage
-    unsigned long long totalDiff = m_currCpu.getTotal() - m_prevCpu.getTotal();
-    unsigned long long idleDiff = m_currCpu.getIdle() - m_prevCpu.getIdle();
+    uint64_t totalDiff = m_currCpu.getTotal() - m_prevCpu.getTotal();
+    uint64_t idleDiff = m_currCpu.getIdle() - m_prevCpu.getIdle();
 
     if (totalDiff == 0)
     {
@@ -107,47 +235,18 @@ double TelemetryParser::getCpuUsage()
 
 double TelemetryParser::getMemUsage()
 {
-    // Open source fresh
-    if (!m_memSource.openSource())
+    std::string_view content;
+    if (!ensureOpen(m_memSource) || !m_memSource.readSnapshot(content))
     {
         return -1.0;  // Error
     }
 
-    unsigned long long memTotal = 0;
-    unsigned long long memAvailable = 0;
-    bool foundTotal = false;
-    bool foundAvailable = false;
-
-    // Read lines until we find both values
-    std::string line;
-    while (m_memSource.readSource(line))
-    {
-        // Parse MemTotal
-        if (line.find("MemTotal:") == 0)
-        {
-            std::istringstream iss(line);
-            std::string label;
-            iss >> label >> memTotal;
-            foundTotal = true;
-        }
-        // Parse MemAvailable
-        else if (line.find("MemAvailable:") == 0)
-        {
-            std::istringstream iss(line);
-            std::string label;
-            iss >> label >> memAvailable;
-            foundAvailable = true;
-        }
-
-        // Stop if we found both
-        if (foundTotal && foundAvailable)
-        {
-            break;
-        }
-    }
+    uint64_t memTotal = 0;
+    uint64_t memAvailable = 0;
+    bool found = parseMemInfo(content, memTotal, memAvailable);
 
     // Check if we found both values
-    if (!foundTotal || !foundAvailable || memTotal == 0)
+    if (!found || memTotal == 0)
     {
         return -1.0;  // Error
     }
@@ -157,6 +256,81 @@ double TelemetryParser::getMemUsage()
     return (used / static_cast<double>(memTotal)) * 100.0;
 }
 
+bool TelemetryParser::getMemInfo(MemInfo& info, MemFieldMask wanted)
+{
+    std::string_view content;
+    if (!ensureOpen(m_memSource) || !m_memSource.readSnapshot(content))
+    {
+        return false;
+    }
+    parseMemInfoFields(content, wanted, info);
+    return true;
+}
+
+// ══════════════════════════════════════════════════════════════════════
+// Per-Core Usage
+// ══════════════════════════════════════════════════════════════════════
+
+bool TelemetryParser::samplePerCore()
+{
+    std::string_view content;
+    if (!ensureOpen(m_cpuSource) || !m_cpuSource.readSnapshot(content))
+    {
+        return false;
+    }
+
+    std::swap(m_prevCores, m_currCores);
+    std::size_t count = parsePerCore(content, m_currCores);
+    if (count == 0)
+    {
+        // m_currCores no longer matches the last usage: drop both
+        m_coreUsage.clear();
+        return false;
+    }
+
+    m_coreUsage.resize(count);
+    if (m_prevCores.core != m_currCores.core)
+    {
+        // First sample, or a core went on/offline: no matching baseline
+        std::fill(m_coreUsage.begin(), m_coreUsage.end(), 0.0f);
+        return true;
+    }
+
+    computeUsage(m_prevCores.total.data(), m_prevCores.idle.data(),
+                 m_currCores.total.data(), m_currCores.idle.data(),
+                 m_coreUsage.data(), count);
+    return true;
+}
+
+const std::vector<uint32_t>& TelemetryParser::getCores() const
+{
+    return m_currCores.core;
+}
+
+const std::vector<float>& TelemetryParser::getCoreUsage() const
+{
+    return m_coreUsage;
+}
+
+void TelemetryParser::getTopCores(std::size_t k, std::vector<CoreUsage>& out)
+{
+    std::size_t count = m_coreUsage.size();
+    k = (k == 0 || k > count) ? count : k;
+
+    m_rank.resize(count);
+    std::iota(m_rank.begin(), m_rank.end(), 0u);
+    std::partial_sort(m_rank.begin(), m_rank.begin() + static_cast<std::ptrdiff_t>(k), m_rank.end(),
+                      [this](uint32_t a, uint32_t b) {
+                          return m_coreUsage[a] > m_coreUsage[b] || (m_coreUsage[a] == m_coreUsage[b] && a < b);
+                      });
+
+    out.clear();
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        out.push_back({m_currCores.core[m_rank[i]], m_coreUsage[m_rank[i]]});
+    }
+}
+
 // ══════════════════════════════════════════════════════════════════════
 // Formatted Output Strings
 // ══════════════════════════════════════════════════════════════════════
@@ -170,9 +344,9 @@ std::string TelemetryParser::getCpuString()
         return "CPU: Error reading data";
     }
 
-    std::ostringstream oss;
-    oss << "CPU: " << std::fixed << std::setprecision(1) << usage << "%";
-    return oss.str();
+    char text[32];
+    std::snprintf(text, sizeof(text), "CPU: %.1f%%", usage);
+    return text;
 }
 
 std::string TelemetryParser::getMemString()
@@ -184,9 +358,9 @@ std::string TelemetryParser::getMemString()
         return "Memory: Error reading data";
     }
 
-    std::ostringstream oss;
-    oss << "Memory: " << std::fixed << std::setprecision(1) << usage << "%";
-    return oss.str();
+    char text[32];
+    std::snprintf(text, sizeof(text), "Memory: %.1f%%", usage);
+    return text;
 }
 
 }  // namespace SmartDataHub
\ No newline at end of file
@@ -0,0 +1,397 @@
+#include "TelemetryReactor.hpp"
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <iostream>
+
+namespace SmartDataHub
+{
+    constexpr int MaxEventsPerWait = 64;
+
+    TelemetryReactor::TelemetryReactor(std::size_t threadCount)
+    {
+        threadCount = std::max<std::size_t>(threadCount, 1);
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            auto shard = std::make_unique<Shard>();
+            shard->epollFd = epoll_create1(EPOLL_CLOEXEC);
+            shard->wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (shard->epollFd < 0 || shard->wakeFd < 0)
+            {
+                std::cerr << "[TelemetryReactor] Cannot create epoll/eventfd for shard " << i << std::endl;
+            }
+            else
+            {
+                shard->wakeTarget.kind = PollTarget::Kind::Wakeup;
+                epoll_event event{};
+                event.events = EPOLLIN;
+                event.data.ptr = &shard->wakeTarget;
+                epoll_ctl(shard->epollFd, EPOLL_CTL_ADD, shard->wakeFd, &event);
+            }
+            m_shards.push_back(std::move(shard));
+        }
+    }
+
+    TelemetryReactor::~TelemetryReactor()
+    {
+        stop();
+        for (auto &shard : m_shards)
+        {
+            for (auto &[interval, timer] : shard->timers)
+            {
+                close(timer->timerFd);
+            }
+            if (shard->wakeFd >= 0)
+            {
+                close(shard->wakeFd);
+            }
+            if (shard->epollFd >= 0)
+            {
+                close(shard->epollFd);
+            }
+        }
+    }
+
+    TelemetryReactor::Shard &TelemetryReactor::pickShard()
+    {
+        // Least loaded shard keeps the sources spread evenly
+        auto it = std::min_element(m_shards.begin(), m_shards.end(),
+                                   [](const auto &a, const auto &b) {
+                                       return a->registrations.size() < b->registrations.size();
+                                   });
+        return **it;
+    }
+
+    TelemetryReactor::TimerGroup *TelemetryReactor::timerFor(Shard &shard, int intervalMs)
+    {
+        auto found = shard.timers.find(intervalMs);
+        if (found != shard.timers.end())
+        {
+            return found->second.get();
+        }
+
+        auto timer = std::make_unique<TimerGroup>();
+        timer->timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (timer->timerFd < 0)
+        {
+            std::cerr << "[TelemetryReactor] Cannot create timerfd" << std::endl;
+            return nullptr;
+        }
+
+        // First read right away, then every intervalMs
+        itimerspec spec{};
+        spec.it_interval.tv_sec = intervalMs / 1000;
+        spec.it_interval.tv_nsec = static_cast<long>(intervalMs % 1000) * 1000000L;
+        spec.it_value.tv_nsec = 1;
+        timerfd_settime(timer->timerFd, 0, &spec, nullptr);
+
+        timer->target.kind = PollTarget::Kind::Timer;
+        timer->target.timer = timer.get();
+
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.ptr = &timer->target;
+        if (epoll_ctl(shard.epollFd, EPOLL_CTL_ADD, timer->timerFd, &event) != 0)
+        {
+            std::cerr << "[TelemetryReactor] Cannot register timerfd" << std::endl;
+            close(timer->timerFd);
+            return nullptr;
+        }
+
+        TimerGroup *result = timer.get();
+        shard.timers.emplace(intervalMs, std::move(timer));
+        return result;
+    }
+
+    bool TelemetryReactor::addSource(const std::string &name, std::unique_ptr<ITelemetrySource> source,
+                                     int intervalMs, SampleHandler handler)
+    {
+        if (m_running)
+        {
+            std::cerr << "[TelemetryReactor] Cannot add '" << name << "' while running" << std::endl;
+            return false;
+        }
+        if (!source || !handler)
+        {
+            return false;
+        }
+
+        Shard &shard = pickShard();
+        if (shard.epollFd < 0)
+        {
+            return false;
+        }
+
+        auto registration = std::make_unique<Registration>();
+        registration->name = name;
+        registration->source = std::move(source);
+        registration->handler = std::move(handler);
+        registration->target.kind = PollTarget::Kind::Source;
+        registration->target.registration = registration.get();
+
+        int pollFd = registration->source->getPollFd();
+        if (pollFd >= 0)
+        {
+            epoll_event event{};
+            event.events = EPOLLIN | EPOLLRDHUP;
+            event.data.ptr = &registration->target;
+            if (epoll_ctl(shard.epollFd, EPOLL_CTL_ADD, pollFd, &event) != 0)
+            {
+                std::cerr << "[TelemetryReactor] Cannot register '" << name << "'" << std::endl;
+                return false;
+            }
+            registration->pollable = true;
+        }
+        else
+        {
+            TimerGroup *timer = timerFor(shard, std::max(intervalMs, 1));
+            if (timer == nullptr)
+            {
+                return false;
+            }
+            timer->members.push_back(registration.get());
+        }
+
+        shard.registrations.push_back(std::move(registration));
+        ++m_sourceCount;
+        return true;
+    }
+
+    void TelemetryReactor::setThreadStartHook(ThreadStartHook hook)
+    {
+        m_threadStartHook = std::move(hook);
+    }
+
+    bool TelemetryReactor::post(std::size_t threadIndex, std::function<void()> task)
+    {
+        Shard &shard = *m_shards[threadIndex % m_shards.size()];
+        {
+            std::lock_guard<std::mutex> lock(shard.postedMutex);
+            if (m_stopped)
+            {
+                return false;
+            }
+            shard.posted.push_back(std::move(task));
+        }
+        uint64_t one = 1;
+        ssize_t written = write(shard.wakeFd, &one, sizeof(one));
+        (void)written; // counter overflow is impossible here
+        return true;
+    }
+
+    void TelemetryReactor::runPosted(Shard &shard)
+    {
+        {
+            std::lock_guard<std::mutex> lock(shard.postedMutex);
+            std::swap(shard.posted, shard.runningPosted);
+        }
+        for (auto &task : shard.runningPosted)
+        {
+            task();
+        }
+        shard.runningPosted.clear();
+    }
+
+    void TelemetryReactor::setBatchedReads(bool enable)
+    {
+        m_batchedReads = enable;
+    }
+
+    bool TelemetryReactor::start()
+    {
+        if (m_running.exchange(true))
+        {
+            return false;
+        }
+        for (auto &shard : m_shards)
+        {
+            shard->reader = std::make_unique<BatchReader>(m_batchedReads, MaxEventsPerWait);
+        }
+        for (std::size_t i = 0; i < m_shards.size(); ++i)
+        {
+            m_shards[i]->thread = std::thread(&TelemetryReactor::runShard, this, i);
+        }
+        return true;
+    }
+
+    void TelemetryReactor::stop()
+    {
+        if (!m_running.exchange(false))
+        {
+            return;
+        }
+        m_stopped = true;
+        for (auto &shard : m_shards)
+        {
+            uint64_t one = 1;
+            ssize_t written = write(shard->wakeFd, &one, sizeof(one));
+            (void)written; // counter overflow is impossible here
+        }
+        for (auto &shard : m_shards)
+        {
+            if (shard->thread.joinable())
+            {
+                shard->thread.join();
+            }
+        }
+    }
+
+    void TelemetryReactor::readOnce(Registration &registration)
+    {
+        std::string data;
+        if (registration.source->readSource(data))
+        {
+            registration.handler(registration.name, data);
+        }
+    }
+
+    void TelemetryReactor::readDue(Shard &shard)
+    {
+        if (shard.due.empty())
+        {
+            return;
+        }
+        shard.dueSources.clear();
+        for (Registration *registration : shard.due)
+        {
+            shard.dueSources.push_back(registration->source.get());
+        }
+
+        const std::vector<Registration *> &due = shard.due;
+        shard.reader->readAll(shard.dueSources, [&due](std::size_t index, const std::string &data) {
+            due[index]->handler(due[index]->name, data);
+        });
+    }
+
+    void TelemetryReactor::onSourcesReady(Shard &shard)
+    {
+        for (auto &[registration, events] : shard.readyEvents)
+        {
+            // Whatever the batched read left parsed but unreturned (epoll
+            // will not report it again)
+            while (registration->source->hasPendingData())
+            {
+                readOnce(*registration);
+            }
+
+            if ((events & (EPOLLHUP | EPOLLRDHUP | EPOLLERR)) || registration->source->isClosed())
+            {
+                // Peer is gone or the source stopped reading (corrupt stream):
+                // hand out whatever is still buffered, then stop polling the
+                // fd so it cannot spin the loop
+                std::string data;
+                while (registration->source->readSource(data))
+                {
+                    registration->handler(registration->name, data);
+                }
+                epoll_ctl(shard.epollFd, EPOLL_CTL_DEL, registration->source->getPollFd(), nullptr);
+                std::cerr << "[TelemetryReactor] Source '" << registration->name << "' closed" << std::endl;
+            }
+        }
+    }
+
+    void TelemetryReactor::collectTimer(Shard &shard, TimerGroup &timer)
+    {
+        // Missed ticks collapse into one sample
+        uint64_t expirations = 0;
+        ssize_t bytes = read(timer.timerFd, &expirations, sizeof(expirations));
+        if (bytes != static_cast<ssize_t>(sizeof(expirations)))
+        {
+            return;
+        }
+        shard.due.insert(shard.due.end(), timer.members.begin(), timer.members.end());
+    }
+
+    void TelemetryReactor::runShard(std::size_t index)
+    {
+        if (m_threadStartHook)
+        {
+            m_threadStartHook(index);
+        }
+
+        Shard &shard = *m_shards[index];
+        epoll_event events[MaxEventsPerWait];
+
+        // Pick up what readiness sources already hold (e.g. the current
+        // value of a watched file) before waiting for the next change
+        for (auto &registration : shard.registrations)
+        {
+            if (registration->pollable)
+            {
+                readOnce(*registration);
+            }
+        }
+        runPosted(shard);
+
+        while (m_running)
+        {
+            int ready = epoll_wait(shard.epollFd, events, MaxEventsPerWait, -1);
+            if (ready < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                std::cerr << "[TelemetryReactor] epoll_wait failed on shard " << index << std::endl;
+                break;
+            }
+
+            shard.readyEvents.clear();
+            shard.due.clear();
+            for (int i = 0; i < ready; ++i)
+            {
+                auto *target = static_cast<PollTarget *>(events[i].data.ptr);
+                switch (target->kind)
+                {
+                case PollTarget::Kind::Wakeup:
+                {
+                    // Reset so a later start() does not wake at once;
+                    // m_running is re-checked by the loop
+                    uint64_t count = 0;
+                    ssize_t bytes = read(shard.wakeFd, &count, sizeof(count));
+                    (void)bytes;
+                    break;
+                }
+                case PollTarget::Kind::Source:
+                    shard.readyEvents.emplace_back(target->registration, static_cast<uint32_t>(events[i].events));
+                    break;
+                case PollTarget::Kind::Timer:
+                    collectTimer(shard, *target->timer);
+                    break;
+                }
+            }
+
+            // One read per ready source (level-triggered epoll reports what
+            // is left) and per timer member, all in one batch
+            for (auto &[registration, events] : shard.readyEvents)
+            {
+                if (registration->source->acknowledgeReady())
+                {
+                    shard.due.push_back(registration);
+                }
+            }
+            readDue(shard);
+            onSourcesReady(shard);
+            runPosted(shard);
+        }
+    }
+
+    bool TelemetryReactor::isRunning() const
+    {
+        return m_running;
+    }
+
+    std::size_t TelemetryReactor::getSourceCount() const
+    {
+        return m_sourceCount;
+    }
+
+    std::size_t TelemetryReactor::getThreadCount() const
+    {
+        return m_shards.size();
+    }
+
+} // namespace SmartDataHub
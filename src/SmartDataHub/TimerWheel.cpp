@@ -0,0 +1,477 @@
+#include "TimerWheel.hpp"
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <iostream>
+
+namespace SmartDataHub
+{
+    namespace
+    {
+        constexpr uint64_t SlotMask = TimerWheel::SlotsPerLevel - 1;
+
+        // Ticks a timer may be ahead of the wheel before it is parked in
+        // the last level and re-cascaded
+        constexpr uint64_t WheelSpan = uint64_t{1} << (TimerWheel::LevelBits * TimerWheel::Levels);
+
+        uint64_t rotateRight(uint64_t value, unsigned shift)
+        {
+            shift &= 63;
+            return shift == 0 ? value : (value >> shift) | (value << (64 - shift));
+        }
+    } // namespace
+
+    TimerWheel::TimerWheel(Clock::duration tick)
+        : m_tick{tick > Clock::duration::zero() ? tick : std::chrono::milliseconds(1)},
+          m_start{Clock::now()}
+    {
+        m_timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        m_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_timerFd < 0 || m_wakeFd < 0)
+        {
+            std::cerr << "[TimerWheel] Cannot create timerfd/eventfd" << std::endl;
+        }
+    }
+
+    TimerWheel::~TimerWheel()
+    {
+        stop();
+        if (m_timerFd >= 0)
+        {
+            close(m_timerFd);
+        }
+        if (m_wakeFd >= 0)
+        {
+            close(m_wakeFd);
+        }
+    }
+
+    uint64_t TimerWheel::tickFor(Clock::time_point deadline) const
+    {
+        if (deadline <= m_start)
+        {
+            return 0;
+        }
+        // Rounded up: a timer never fires before its deadline
+        auto elapsed = deadline - m_start;
+        return static_cast<uint64_t>((elapsed + m_tick - Clock::duration(1)) / m_tick);
+    }
+
+    void TimerWheel::link(Timer &timer)
+    {
+        // expiryTick == m_now only while cascading into the slot about to fire
+        uint64_t expiry = std::max(timer.expiryTick, m_now);
+        uint64_t delta = expiry - m_now;
+
+        std::size_t level = 0;
+        while (level + 1 < Levels && delta >= (uint64_t{1} << (LevelBits * (level + 1))))
+        {
+            ++level;
+        }
+        if (delta >= WheelSpan)
+        {
+            expiry = m_now + WheelSpan - 1;
+        }
+
+        timer.level = static_cast<uint8_t>(level);
+        timer.slot = static_cast<uint8_t>((expiry >> (LevelBits * level)) & SlotMask);
+        Timer *&head = m_slots[timer.level][timer.slot];
+        timer.prev = nullptr;
+        timer.next = head;
+        if (head != nullptr)
+        {
+            head->prev = &timer;
+        }
+        head = &timer;
+        timer.linked = true;
+        m_occupied[timer.level] |= uint64_t{1} << timer.slot;
+    }
+
+    void TimerWheel::unlink(Timer &timer)
+    {
+        if (!timer.linked)
+        {
+            return;
+        }
+        Timer *&head = m_slots[timer.level][timer.slot];
+        if (timer.prev != nullptr)
+        {
+            timer.prev->next = timer.next;
+        }
+        else
+        {
+            head = timer.next;
+        }
+        if (timer.next != nullptr)
+        {
+            timer.next->prev = timer.prev;
+        }
+        if (head == nullptr)
+        {
+            m_occupied[timer.level] &= ~(uint64_t{1} << timer.slot);
+        }
+        timer.prev = nullptr;
+        timer.next = nullptr;
+        timer.linked = false;
+    }
+
+    void TimerWheel::cascade(std::size_t level, std::size_t slot)
+    {
+        // Detach first: re-linking may land in a slot of this level again
+        m_cascade.clear();
+        for (Timer *timer = m_slots[level][slot]; timer != nullptr; timer = timer->next)
+        {
+            m_cascade.push_back(timer);
+        }
+        m_slots[level][slot] = nullptr;
+        m_occupied[level] &= ~(uint64_t{1} << slot);
+        for (Timer *timer : m_cascade)
+        {
+            timer->linked = false;
+            link(*timer);
+        }
+    }
+
+    void TimerWheel::expire(Timer &timer, Clock::time_point now)
+    {
+        auto found = m_timers.find(timer.id);
+        if (found == m_timers.end())
+        {
+            return;
+        }
+        m_fired.push_back({found->second, timer.deadline});
+
+        // Next deadline from the last one, not from now: no drift. Whole
+        // periods already past are skipped so the phase is kept.
+        timer.deadline += timer.period;
+        if (timer.deadline <= now)
+        {
+            auto behind = (now - timer.deadline) / timer.period + 1;
+            timer.missed.fetch_add(static_cast<uint64_t>(behind), std::memory_order_relaxed);
+            timer.deadline += behind * timer.period;
+        }
+        timer.expiryTick = std::max(tickFor(timer.deadline), m_now + 1);
+        link(timer);
+    }
+
+    void TimerWheel::advance(uint64_t target)
+    {
+        Clock::time_point now = Clock::now();
+        while (m_now < target)
+        {
+            uint64_t tick = ++m_now;
+            std::size_t slot = tick & SlotMask;
+
+            // Level 0 wrapped: bring the next slot of each coarser level
+            // down, as far up as their indexes wrap too
+            if (slot == 0)
+            {
+                for (std::size_t level = 1; level < Levels; ++level)
+                {
+                    std::size_t index = (tick >> (LevelBits * level)) & SlotMask;
+                    cascade(level, index);
+                    if (index != 0)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            if ((m_occupied[0] & (uint64_t{1} << slot)) == 0)
+            {
+                continue;
+            }
+            m_cascade.clear();
+            for (Timer *timer = m_slots[0][slot]; timer != nullptr; timer = timer->next)
+            {
+                m_cascade.push_back(timer);
+            }
+            m_slots[0][slot] = nullptr;
+            m_occupied[0] &= ~(uint64_t{1} << slot);
+            for (Timer *timer : m_cascade)
+            {
+                timer->linked = false;
+                if (timer->expiryTick > tick)
+                {
+                    link(*timer); // parked beyond the wheel span
+                    continue;
+                }
+                expire(*timer, now);
+            }
+        }
+    }
+
+    uint64_t TimerWheel::nextWakeTick() const
+    {
+        uint64_t next = 0;
+        if (m_occupied[0] != 0)
+        {
+            // First occupied level-0 slot after the current one
+            uint64_t ahead = rotateRight(m_occupied[0], static_cast<unsigned>((m_now + 1) & SlotMask));
+            next = m_now + 1 + static_cast<uint64_t>(__builtin_ctzll(ahead));
+        }
+        for (std::size_t level = 1; level < Levels; ++level)
+        {
+            if (m_occupied[level] != 0)
+            {
+                // Coarser timers need the next cascade
+                uint64_t boundary = ((m_now >> LevelBits) + 1) << LevelBits;
+                next = next == 0 ? boundary : std::min(next, boundary);
+                break;
+            }
+        }
+        return next;
+    }
+
+    void TimerWheel::arm(uint64_t tick)
+    {
+        if (tick == m_armedTick)
+        {
+            return;
+        }
+        m_armedTick = tick;
+
+        itimerspec spec{};
+        if (tick != 0)
+        {
+            auto deadline = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                (m_start + tick * m_tick).time_since_epoch());
+            spec.it_value.tv_sec = static_cast<time_t>(deadline.count() / 1000000000);
+            spec.it_value.tv_nsec = static_cast<long>(deadline.count() % 1000000000);
+        }
+        // steady_clock is CLOCK_MONOTONIC; a zero it_value disarms
+        timerfd_settime(m_timerFd, TFD_TIMER_ABSTIME, &spec, nullptr);
+    }
+
+    void TimerWheel::wake()
+    {
+        uint64_t one = 1;
+        ssize_t written = write(m_wakeFd, &one, sizeof(one));
+        (void)written; // counter overflow is impossible here
+    }
+
+    void TimerWheel::dispatch(const Fired &fired)
+    {
+        Timer &timer = *fired.timer;
+        if (timer.running.exchange(true, std::memory_order_acq_rel))
+        {
+            timer.overruns.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        auto task = [timer = fired.timer, deadline = fired.deadline]() {
+            auto late = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - deadline).count();
+            uint64_t lateUs = late > 0 ? static_cast<uint64_t>(late) : 0;
+            std::size_t bucket = lateUs == 0 ? 0 : static_cast<std::size_t>(64 - __builtin_clzll(lateUs));
+            timer->histogram[std::min(bucket, HistogramBuckets - 1)].fetch_add(1, std::memory_order_relaxed);
+            timer->latenessSumUs.fetch_add(lateUs, std::memory_order_relaxed);
+            uint64_t max = timer->latenessMaxUs.load(std::memory_order_relaxed);
+            while (lateUs > max && !timer->latenessMaxUs.compare_exchange_weak(max, lateUs, std::memory_order_relaxed))
+            {
+            }
+            timer->fires.fetch_add(1, std::memory_order_relaxed);
+
+            try
+            {
+                timer->callback();
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << "[TimerWheel] Timer " << timer->id << " callback failed: " << e.what() << std::endl;
+            }
+            timer->running.store(false, std::memory_order_release);
+        };
+
+        if (!timer.executor)
+        {
+            task();
+            return;
+        }
+        try
+        {
+            timer.executor(std::move(task));
+        }
+        catch (const std::exception &e)
+        {
+            // e.g. a stopped ThreadPool: try again at the next deadline
+            timer.running.store(false, std::memory_order_release);
+        }
+    }
+
+    void TimerWheel::run()
+    {
+        if (m_threadStartHook)
+        {
+            m_threadStartHook();
+        }
+
+        pollfd fds[2] = {{m_timerFd, POLLIN, 0}, {m_wakeFd, POLLIN, 0}};
+        while (m_running)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                arm(nextWakeTick());
+            }
+
+            if (poll(fds, 2, -1) < 0 && errno != EINTR)
+            {
+                std::cerr << "[TimerWheel] poll failed" << std::endl;
+                break;
+            }
+            uint64_t count = 0;
+            ssize_t bytes = read(m_timerFd, &count, sizeof(count));
+            bytes = read(m_wakeFd, &count, sizeof(count));
+            (void)bytes;
+            if (!m_running)
+            {
+                break;
+            }
+
+            uint64_t target = static_cast<uint64_t>((Clock::now() - m_start) / m_tick);
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                // The fd fired: it is no longer armed
+                if (m_armedTick != 0 && m_armedTick <= target)
+                {
+                    m_armedTick = 0;
+                }
+                m_fired.clear();
+                advance(target);
+            }
+
+            // Outside the lock: callbacks may schedule or cancel
+            for (const Fired &fired : m_fired)
+            {
+                dispatch(fired);
+            }
+            m_fired.clear();
+        }
+    }
+
+    TimerWheel::TimerId TimerWheel::schedule(Clock::duration period, Callback callback, Executor executor,
+                                             Clock::duration firstDelay)
+    {
+        if (period <= Clock::duration::zero() || !callback)
+        {
+            return 0;
+        }
+
+        auto timer = std::make_shared<Timer>();
+        timer->period = period;
+        timer->deadline = Clock::now() + std::max(firstDelay, Clock::duration::zero());
+        timer->callback = std::move(callback);
+        timer->executor = std::move(executor);
+
+        bool earlier = false;
+        TimerId id = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            id = m_nextId++;
+            timer->id = id;
+            timer->expiryTick = std::max(tickFor(timer->deadline), m_now + 1);
+            link(*timer);
+            earlier = m_armedTick == 0 || timer->expiryTick < m_armedTick;
+            m_timers.emplace(id, std::move(timer));
+        }
+        if (earlier && m_running)
+        {
+            wake();
+        }
+        return id;
+    }
+
+    bool TimerWheel::cancel(TimerId id)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto found = m_timers.find(id);
+        if (found == m_timers.end())
+        {
+            return false;
+        }
+        unlink(*found->second);
+        m_timers.erase(found);
+        return true;
+    }
+
+    void TimerWheel::setThreadStartHook(ThreadStartHook hook)
+    {
+        m_threadStartHook = std::move(hook);
+    }
+
+    bool TimerWheel::start()
+    {
+        if (m_timerFd < 0 || m_wakeFd < 0 || m_running.exchange(true))
+        {
+            return false;
+        }
+        m_thread = std::thread(&TimerWheel::run, this);
+        return true;
+    }
+
+    void TimerWheel::stop()
+    {
+        if (!m_running.exchange(false))
+        {
+            return;
+        }
+        wake();
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+    bool TimerWheel::isRunning() const
+    {
+        return m_running;
+    }
+
+    std::size_t TimerWheel::getTimerCount()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_timers.size();
+    }
+
+    TimerStats TimerWheel::getStats(TimerId id)
+    {
+        std::shared_ptr<Timer> timer;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto found = m_timers.find(id);
+            if (found == m_timers.end())
+            {
+                return {};
+            }
+            timer = found->second;
+        }
+
+        TimerStats stats;
+        stats.fires = timer->fires.load(std::memory_order_relaxed);
+        stats.missed = timer->missed.load(std::memory_order_relaxed);
+        stats.overruns = timer->overruns.load(std::memory_order_relaxed);
+        stats.maxLatenessUs = timer->latenessMaxUs.load(std::memory_order_relaxed);
+        if (stats.fires > 0)
+        {
+            stats.meanLatenessUs = static_cast<double>(timer->latenessSumUs.load(std::memory_order_relaxed)) /
+                                   static_cast<double>(stats.fires);
+        }
+
+        uint64_t seen = 0;
+        uint64_t wanted = (stats.fires * 99 + 99) / 100;
+        for (std::size_t bucket = 0; bucket < HistogramBuckets && stats.fires > 0; ++bucket)
+        {
+            seen += timer->histogram[bucket].load(std::memory_order_relaxed);
+            if (seen >= wanted)
+            {
+                uint64_t bound = bucket == 0 ? 0 : (uint64_t{1} << bucket) - 1;
+                stats.p99LatenessUs = std::min(bound, stats.maxLatenessUs);
+                break;
+            }
+        }
+        return stats;
+    }
+
+} // namespace SmartDataHub
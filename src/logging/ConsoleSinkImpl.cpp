@@ -4,7 +4,11 @@
 namespace logging {
 
     void ConsoleSinkImpl::write(const LogMessage & msg){
-    std::cout << msg << std::endl; 
+    std::cout << msg << '\n'; 
+}
+
+    void ConsoleSinkImpl::flush(){
+    std::cout.flush();
 }
 
 }
@@ -13,9 +13,16 @@ namespace logging
 
     void FileSinkImpl::write(const LogMessage &msg)
     {
+        // No per-message flush: callers use flush() as a durability barrier
         if (file.is_open())
-            file << msg << std::endl;
+            file << msg << '\n';
         else
             std::cerr << "Can not write, Failed to open: " << file_path << std::endl;
     }
+
+    void FileSinkImpl::flush()
+    {
+        if (file.is_open())
+            file.flush();
+    }
 }
\ No newline at end of file
@@ -33,6 +33,11 @@ void LogManager::flush()
             }
         }
     }
+
+    for (const auto& sink : sinks)
+    {
+        sink->flush();
+    }
 }
 
 }
\ No newline at end of file